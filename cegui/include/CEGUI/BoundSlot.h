@@ -29,6 +29,7 @@
 
 #include "CEGUI/Base.h"
 #include "CEGUI/SubscriberSlot.h"
+#include <cstdint>
 
 namespace CEGUI
 {
@@ -114,6 +115,7 @@ private:
     Group           d_group;        //! The group the slot subscription used.
     SubscriberSlot* d_subscriber;   //! The actual slot object.
     Event*          d_event;        //! The event to which the slot was attached
+    std::uint64_t   d_sequence;     //! Value of the subscription sequence when subscribed.
 };
 
 } // End of  CEGUI namespace section
@@ -38,6 +38,7 @@
 #include "CEGUI/BitmapImage.h"
 #include "CEGUI/text/BidiVisualMapping.h"
 #include "CEGUI/BoundSlot.h"
+#include "CEGUI/ChildHandle.h"
 #include "CEGUI/Clipboard.h"
 #include "CEGUI/Colour.h"
 #include "CEGUI/ColourRect.h"
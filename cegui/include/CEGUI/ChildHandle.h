@@ -0,0 +1,117 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIChildHandle_h_
+#define _CEGUIChildHandle_h_
+
+#include "CEGUI/Window.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Caches the result of looking up a child window by name path.
+
+    The path is resolved with Window::findChild when the handle is created,
+    and again only after the window hierarchy has changed in some way (see
+    Window::getHierarchyVersion). Checking for that is a single comparison,
+    which makes a ChildHandle suitable for code that needs to access the same
+    child every frame:
+
+    \code
+    // once
+    CEGUI::ChildHandle label(frame, "Panel/Label");
+
+    // every frame
+    if (CEGUI::Window* wnd = label.find())
+        wnd->setText(status);
+    \endcode
+
+    The window the path is relative to must outlive the handle.
+*/
+class CEGUIEXPORT ChildHandle
+{
+public:
+    //! Create a handle that does not reference any window.
+    ChildHandle();
+
+    //! Create a handle for the child at \a name_path relative to \a window.
+    ChildHandle(const Window* window, const String& name_path);
+
+    //! Make the handle reference the child at \a name_path relative to \a window.
+    void reset(const Window* window, const String& name_path);
+
+    /*!
+    \brief
+        Return the child window the handle references, or 0 if there is no
+        window at the name path at the moment.
+    */
+    Window* find() const
+    {
+        if (d_version != Window::getHierarchyVersion())
+            resolve();
+
+        return d_child;
+    }
+
+    /*!
+    \brief
+        Return the child window the handle references.
+
+    \exception UnknownObjectException
+        thrown if there is no window at the name path at the moment.
+    */
+    Window* get() const;
+
+    //! Return the window the name path is relative to.
+    const Window* getWindow() const { return d_window; }
+
+    //! Return the name path of the referenced child.
+    const String& getNamePath() const { return d_namePath; }
+
+private:
+    void resolve() const;
+
+    const Window* d_window;
+    String d_namePath;
+    //! result of the last lookup.
+    mutable Window* d_child;
+    //! Window::getHierarchyVersion at the time of the last lookup.
+    mutable std::uint64_t d_version;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIChildHandle_h_
@@ -51,7 +51,8 @@ public:
 	*/
     RawDataContainer()
       : mData(nullptr),
-        mSize(0)
+        mSize(0),
+        mMapped(false)
     {
     }
 
@@ -74,7 +75,32 @@ public:
 	\param data
         Pointer to the uint8 data buffer.
 	*/
-    void setData(std::uint8_t* data) { mData = data; }
+    void setData(std::uint8_t* data) { mData = data; mMapped = false; }
+
+    /*!
+    \brief
+        Set a pointer to data that was memory mapped from a file, so that it is
+        unmapped rather than deleted when released.
+
+    \param data
+        Pointer to the start of the mapping.
+
+    \param size
+        size_t containing the size of the mapping.
+    */
+    void setMappedData(std::uint8_t* data, size_t size)
+    {
+        mData = data;
+        mSize = size;
+        mMapped = true;
+    }
+
+    /*!
+    \brief
+        Return whether the data is a memory mapping of a file rather than a
+        buffer allocated with new[].
+    */
+    bool isMapped(void) const { return mMapped; }
 
 	/*!
 	\brief
@@ -116,6 +142,7 @@ private:
 	*************************************************************************/
     std::uint8_t* mData;
     size_t mSize;
+    bool mMapped;
 };
 
 } // End of  CEGUI namespace section
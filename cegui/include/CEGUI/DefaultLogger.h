@@ -33,6 +33,7 @@
 #include <vector>
 #include <fstream>
 #include <sstream>
+#include <mutex>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -48,6 +49,9 @@ namespace CEGUI
     If you want to redirect CEGUI logs to some place other than a text file,
     implement your own Logger implementation and create a object of the
     Logger type before creating the CEGUI::System singleton.
+
+    Events may be logged from several threads at once; each event is written
+    as a whole.
 */
 class CEGUIEXPORT DefaultLogger : public Logger
 {
@@ -71,6 +75,8 @@ protected:
     Cache d_cache;
     //! true while log entries are being cached (prior to logfile creation)
     bool d_caching;
+    //! serialises access to the members above.
+    std::mutex d_mutex;
 };
 
 }
@@ -45,6 +45,7 @@ namespace CEGUI
 class CEGUIEXPORT DefaultResourceProvider : public ResourceProvider
 {
 public:
+    DefaultResourceProvider();
 
     /*!
     \brief
@@ -93,6 +94,38 @@ public:
     */
     void clearResourceGroupDirectory(const String& resourceGroup);
 
+    /*!
+    \brief
+        Set whether files are memory mapped rather than read into a newly
+        allocated buffer.
+
+        Mapped data is read directly from the page cache, which avoids a copy
+        and keeps large, long lived data (such as fonts that FreeType holds on
+        to) from being resident twice. Mapping is only available on POSIX
+        systems; elsewhere, or if mapping a file fails, the data is read as
+        usual. Disabled by default.
+
+    \warning
+        A mapped file is read lazily for as long as the data is loaded. If the
+        file is truncated or replaced in place meanwhile, touching the missing
+        pages raises SIGBUS and terminates the application. Only enable this
+        for files that are not modified while they are in use.
+    */
+    void setMemoryMappingEnabled(bool setting) { d_memoryMappingEnabled = setting; }
+
+    //! Return whether files may be memory mapped.
+    bool isMemoryMappingEnabled() const { return d_memoryMappingEnabled; }
+
+    /*!
+    \brief
+        Set the size, in bytes, from which files are memory mapped. Smaller
+        files are cheaper to read than to map and are always read.
+    */
+    void setMemoryMappingThreshold(size_t bytes) { d_memoryMappingThreshold = bytes; }
+
+    //! Return the size, in bytes, from which files are memory mapped.
+    size_t getMemoryMappingThreshold() const { return d_memoryMappingThreshold; }
+
     void loadRawDataContainer(const String& filename, RawDataContainer& output, const String& resourceGroup) override;
     void unloadRawDataContainer(RawDataContainer& data) override;
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
@@ -110,6 +143,11 @@ protected:
 
     typedef std::unordered_map<String, String> ResourceGroupMap;
     ResourceGroupMap    d_resourceGroups;
+
+    //! whether files may be memory mapped.
+    bool d_memoryMappingEnabled;
+    //! size from which files are memory mapped.
+    size_t d_memoryMappingThreshold;
 };
 
 } // End of  CEGUI namespace section
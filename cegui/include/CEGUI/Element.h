@@ -86,6 +86,8 @@ class directly. You most likely want to use CEGUI::Window.
 class CEGUIEXPORT Element : public PropertySet, public EventSet
 {
 public:
+    CEGUI_TRACK_CLASS_ALLOCATIONS(MemoryTag::Window)
+
     //! Namespace for global events
     static const String EventNamespace;
 
@@ -250,6 +252,7 @@ public:
     Element();
     Element(const Element&) = delete;
     Element& operator=(const Element&) = delete;
+    virtual ~Element();
 
     /*!
     \brief Retrieves parent of this element
@@ -1037,6 +1040,56 @@ public:
     */
     void notifyScreenAreaChanged(bool adjust_size_to_content = true);
 
+    /*!
+    \brief
+        Start deferring area change notifications of all elements.
+
+        Until the matching endAreaChangeBatch call, notifyScreenAreaChanged
+        (and therefore setArea, setPosition, setSize and the like) only records
+        the element. Changes are coalesced per element, so an element that is
+        changed many times is updated and fires EventMoved and EventSized at
+        most once, and children of an element that gets resized are updated
+        only by their parent. Batches may be nested.
+
+    \note
+        While a batch is open, pixel sizes and screen rects of the changed
+        elements and their descendants are not updated yet. Code that reads
+        them back after changing an area must not run inside a batch.
+
+    \see Element::AreaChangeBatch
+    */
+    static void beginAreaChangeBatch();
+
+    /*!
+    \brief
+        End a batch started with beginAreaChangeBatch. When the outermost batch
+        ends, all recorded elements are updated, parents before children, and
+        their events are fired.
+
+    \exception InvalidRequestException
+        thrown if there is no batch to end.
+    */
+    static void endAreaChangeBatch();
+
+    //! Return whether area change notifications are currently deferred.
+    static bool isBatchingAreaChanges() { return d_areaChangeBatchDepth > 0; }
+
+    /*!
+    \brief
+        Opens an area change batch for the lifetime of the object.
+
+    \see Element::beginAreaChangeBatch
+    */
+    class CEGUIEXPORT AreaChangeBatch
+    {
+    public:
+        AreaChangeBatch() { beginAreaChangeBatch(); }
+        ~AreaChangeBatch() { endAreaChangeBatch(); }
+
+        AreaChangeBatch(const AreaChangeBatch&) = delete;
+        AreaChangeBatch& operator=(const AreaChangeBatch&) = delete;
+    };
+
     /*!
     \brief
         Layout child widgets inside our content areas.
@@ -1629,6 +1682,18 @@ protected:
 
     //! If true, the position and size are pixel aligned
     bool d_pixelAligned = true;
+
+    //! true if an area change of this element is recorded in an open batch.
+    bool d_areaChangePending = false;
+    //! whether the recorded area change should adjust size to content.
+    bool d_areaChangeAdjustSize = false;
+
+    //! nesting depth of area change batches.
+    static unsigned int d_areaChangeBatchDepth;
+    //! true while recorded area changes are being applied.
+    static bool d_applyingAreaChanges;
+    //! elements with area changes recorded in the current batch.
+    static std::vector<Element*> d_pendingAreaChanges;
 };
 
 } // End of  CEGUI namespace section
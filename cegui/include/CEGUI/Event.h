@@ -30,6 +30,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/BoundSlot.h"
 #include "CEGUI/RefCounted.h"
+#include "CEGUI/MemoryTracker.h"
 #include <map>
 
 #if defined(_MSC_VER)
@@ -55,6 +56,8 @@ namespace CEGUI
 class CEGUIEXPORT Event
 {
 public:
+    CEGUI_TRACK_CLASS_ALLOCATIONS(MemoryTag::EventSet)
+
     /*!
     \brief
         Connection object.  This is a thin 'smart pointer' wrapper around the
@@ -221,6 +224,20 @@ public:
     //! \brief Unsubscribes all listeners from this event
     void unsubscribeAll();
 
+    /*!
+    \brief
+        Return a number that grows with every subscription made to any Event.
+        This can be passed to unsubscribeAfter later on.
+    */
+    static std::uint64_t getSubscriptionSequence();
+
+    /*!
+    \brief
+        Unsubscribes all listeners that subscribed to this event after
+        getSubscriptionSequence returned \a sequence.
+    */
+    void unsubscribeAfter(std::uint64_t sequence);
+
     /*!
     \brief
         Fires the event.  All event subscribers get called in the appropriate
@@ -254,7 +271,8 @@ protected:
     Event(const Event&) = default;
     Event& operator =(const Event&) = delete;
 
-    std::multimap<Group, Connection, std::less<Group>> d_slots;  //!< Collection holding ref-counted bound slots
+    std::multimap<Group, Connection, std::less<Group>,
+                  TrackedAllocator<std::pair<const Group, Connection>, MemoryTag::EventSet>> d_slots;  //!< Collection holding ref-counted bound slots
     const String d_name;    //!< Name of this event
     bool d_isBeingInvoked = false;
 };
@@ -235,6 +235,14 @@ public:
     */
     void removeAllEvents() { d_events.clear(); }
 
+    /*!
+    \brief
+        Disconnect all subscriptions made to Events of this EventSet after
+        Event::getSubscriptionSequence returned \a sequence. The Event objects
+        themselves and earlier subscriptions are kept.
+    */
+    void unsubscribeAfter(std::uint64_t sequence);
+
     /*!
     \brief
         Checks to see if an Event with the given name is present in this
@@ -429,7 +437,11 @@ protected:
     //! Helper to return the script module pointer or throw.
     ScriptModule* getScriptModule() const;
 
-    std::unordered_map<String, std::unique_ptr<Event>> d_events;
+    //! Type of the collection holding the events of an EventSet.
+    typedef std::unordered_map<String, std::unique_ptr<Event>, std::hash<String>, std::equal_to<String>,
+                               TrackedAllocator<std::pair<const String, std::unique_ptr<Event>>, MemoryTag::EventSet>> EventMap;
+
+    EventMap d_events;
 
     bool d_muted = false;    //!< true if events for this EventSet have been muted.
 
@@ -437,7 +449,7 @@ public:
     /*************************************************************************
         Iterator stuff
     *************************************************************************/
-    typedef ConstMapIterator<std::unordered_map<String, std::unique_ptr<Event>>> EventIterator;
+    typedef ConstMapIterator<EventMap> EventIterator;
 
     /*!
     \brief
@@ -59,6 +59,7 @@ class Font;
 class FontGlyph;
 class FontManager;
 class GeometryBuffer;
+class GeometryRecorder;
 class GlobalEventSet;
 class GUIContext;
 class Image;
@@ -72,6 +73,7 @@ class LinkedEventArgs;
 class Logger;
 class Cursor;
 class NativeClipboardProvider;
+class ParallelGeometryGenerator;
 class Property;
 template<typename T> class PropertyHelper;
 class PropertyReceiver;
@@ -0,0 +1,260 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFrameProfiler_h_
+#define _CEGUIFrameProfiler_h_
+
+#include "CEGUI/String.h"
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Collects hierarchical timings of the work done for each GUI frame.
+
+    CEGUI code marks the interesting parts of a frame with the
+    CEGUI_PROFILE_SCOPE and CEGUI_PROFILE_SCOPE_DETAIL macros, for example
+    GUIContext::injectTimePulse, Window::update, Window::bufferGeometry,
+    Falagard imagery, text layout, RenderingSurface::draw and the upload of
+    geometry to the renderer. The macros only expand to code when CEGUI is
+    built with the CEGUI_ENABLE_PROFILER option, and then only cost a
+    relaxed atomic load while the profiler is not active.
+
+    While active, each scope is recorded as an Event of the current frame.
+    Scopes per Window pass the window type as detail, so the time spent can
+    be broken down per window type. A frame ends with markFrameEnd, which
+    System::renderAllGUIContexts calls after drawing. Ended frames are
+    aggregated into a call tree and kept in a ring buffer holding the most
+    recent frames, which can be inspected or exported in the Chrome trace
+    event format (loadable in chrome://tracing and Perfetto).
+
+    Scopes may be recorded from any thread; scopes of threads other than the
+    one that opened their parent scope are roots of the call tree.
+*/
+class CEGUIEXPORT FrameProfiler
+{
+public:
+    //! Value of Event::d_parent and ScopeStatistics::d_parent for roots.
+    static const std::uint32_t NoParent = 0xFFFFFFFF;
+    //! Value of Event::d_detail and ScopeStatistics::d_detail without detail.
+    static const std::uint32_t NoDetail = 0xFFFFFFFF;
+
+    //! One execution of a profiled scope.
+    struct Event
+    {
+        //! Name of the scope; points to a string literal.
+        const char* d_name;
+        //! Index of the detail as passed to getDetail, or NoDetail.
+        std::uint32_t d_detail;
+        //! Index of the enclosing Event in the same frame, or NoParent.
+        std::uint32_t d_parent;
+        //! Number identifying the thread that executed the scope.
+        std::uint32_t d_thread;
+        //! Start time in nanoseconds since the profiler was first activated.
+        std::uint64_t d_start;
+        //! Duration in nanoseconds.
+        std::uint64_t d_duration;
+    };
+
+    //! Time spent in a scope, aggregated over all its executions in a frame.
+    struct ScopeStatistics
+    {
+        const char* d_name;
+        std::uint32_t d_detail;
+        //! Index of the enclosing node in the call tree, or NoParent.
+        std::uint32_t d_parent;
+        //! Number of times the scope was executed.
+        std::uint32_t d_calls;
+        //! Total time in nanoseconds, including the time of nested scopes.
+        std::uint64_t d_totalTime;
+        //! Time in nanoseconds not spent in nested scopes.
+        std::uint64_t d_selfTime;
+    };
+
+    //! Everything recorded between two calls of markFrameEnd.
+    struct Frame
+    {
+        //! Number of the frame since the profiler was first activated.
+        std::uint64_t d_number;
+        //! Start time in nanoseconds since the profiler was first activated.
+        std::uint64_t d_start;
+        //! Duration in nanoseconds.
+        std::uint64_t d_duration;
+        //! Recorded scopes, in the order they were entered.
+        std::vector<Event> d_events;
+        /*!
+            Aggregated scopes; a node for every distinct scope name and detail
+            per parent node. Parents come before their children.
+        */
+        std::vector<ScopeStatistics> d_callTree;
+        //! Number of scopes not recorded because the frame was full.
+        std::uint32_t d_droppedEvents;
+    };
+
+    //! Return whether profiling scopes are compiled into this build of CEGUI.
+    static bool isAvailable()
+    {
+#ifdef CEGUI_ENABLE_PROFILER
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    //! Return whether scopes are currently being recorded.
+    static bool isActive() { return s_active.load(std::memory_order_relaxed); }
+
+    /*!
+    \brief
+        Start or stop recording. Starting begins a new frame, stopping
+        discards the frame in progress; recorded frames are kept.
+    */
+    static void setActive(bool setting);
+
+    //! End the current frame and begin the next one, if active.
+    static void markFrameEnd();
+
+    //! Set how many of the most recent frames are kept (default 120).
+    static void setFrameHistorySize(size_t frames);
+    static size_t getFrameHistorySize();
+
+    //! Set how many scopes may be recorded per frame (default 1 << 20).
+    static void setMaxEventsPerFrame(size_t events);
+    static size_t getMaxEventsPerFrame();
+
+    //! Return a copy of the kept frames, oldest first.
+    static std::vector<Frame> getFrames();
+
+    //! Discard all kept frames.
+    static void clearFrames();
+
+    //! Return the detail string with the given index.
+    static String getDetail(std::uint32_t index);
+
+    /*!
+    \brief
+        Return the time spent in each distinct scope name and detail in \a
+        frame, regardless of where it was called from. This gives, for
+        example, the time spent per window type.
+
+        Nested executions of the same scope are included in the total time
+        of each of them, so for recursive scopes like Window::update only the
+        self time adds up to the frame time.
+    */
+    static std::vector<ScopeStatistics> getScopeTotals(const Frame& frame);
+
+    //! Write the kept frames to \a out in the Chrome trace event format.
+    static void writeChromeTrace(std::ostream& out);
+
+    /*!
+    \brief
+        Write the kept frames to the file \a filename in the Chrome trace
+        event format.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    static void saveChromeTrace(const String& filename);
+
+    //! Begin recording a scope; use ProfileScope instead.
+    static std::uint64_t beginScope(const char* name, const String* detail);
+    //! End recording a scope begun by beginScope; use ProfileScope instead.
+    static void endScope(std::uint64_t scope);
+
+    //! Returned by beginScope when the scope is not recorded.
+    static const std::uint64_t InvalidScope = ~std::uint64_t(0);
+
+private:
+    static std::atomic<bool> s_active;
+};
+
+/*!
+\brief
+    Records the lifetime of the object as a scope of the FrameProfiler, if it
+    is active. Normally used through CEGUI_PROFILE_SCOPE.
+*/
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name) :
+        d_scope(FrameProfiler::isActive() ?
+                FrameProfiler::beginScope(name, nullptr) : FrameProfiler::InvalidScope)
+    {}
+
+    ProfileScope(const char* name, const String& detail) :
+        d_scope(FrameProfiler::isActive() ?
+                FrameProfiler::beginScope(name, &detail) : FrameProfiler::InvalidScope)
+    {}
+
+    ~ProfileScope()
+    {
+        if (d_scope != FrameProfiler::InvalidScope)
+            FrameProfiler::endScope(d_scope);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    std::uint64_t d_scope;
+};
+
+} // End of  CEGUI namespace section
+
+#define CEGUI_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CEGUI_PROFILE_CONCAT(a, b) CEGUI_PROFILE_CONCAT_IMPL(a, b)
+
+/*!
+\brief
+    Profile the rest of the enclosing block as a scope called \a name (a
+    string literal), optionally with the String \a detail. These expand to
+    nothing unless CEGUI is built with CEGUI_ENABLE_PROFILER.
+*/
+#ifdef CEGUI_ENABLE_PROFILER
+#   define CEGUI_PROFILE_SCOPE(name) \
+    ::CEGUI::ProfileScope CEGUI_PROFILE_CONCAT(ceguiProfileScope, __LINE__)(name)
+#   define CEGUI_PROFILE_SCOPE_DETAIL(name, detail) \
+    ::CEGUI::ProfileScope CEGUI_PROFILE_CONCAT(ceguiProfileScope, __LINE__)(name, detail)
+#else
+#   define CEGUI_PROFILE_SCOPE(name)
+#   define CEGUI_PROFILE_SCOPE_DETAIL(name, detail)
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIFrameProfiler_h_
@@ -29,8 +29,12 @@
 
 #include "CEGUI/RenderingSurface.h"
 #include "CEGUI/InjectedInputReceiver.h"
+#include "CEGUI/InputQueue.h"
 #include "CEGUI/URect.h"
+#include <algorithm>
 #include <chrono>
+#include <memory>
+#include <unordered_set>
 
 #if defined (_MSC_VER)
 #   pragma warning(push)
@@ -106,7 +110,159 @@ public:
     void setRenderTarget(RenderTarget& target);
 
     //! call to indicate that some redrawing is required.
-    void markAsDirty(std::uint32_t drawModeMask = DrawModeMaskAll) { d_dirtyDrawModeMask |= drawModeMask; }
+    void markAsDirty(std::uint32_t drawModeMask = DrawModeMaskAll)
+    {
+        d_dirtyDrawModeMask |= drawModeMask;
+
+        if (d_drawListValid)
+            invalidateDrawList();
+    }
+
+    /*!
+    \brief
+        Call to indicate that the geometry of \a window must be regenerated,
+        while nothing else about the window hierarchy has changed. This is
+        what Window::invalidate uses.
+    */
+    void markWindowForRedraw(Window& window);
+
+    /*!
+    \brief
+        Set whether the geometry drawn for the windows of this context is
+        retained between frames.
+
+        Normally every redraw clears the context and visits all visible
+        windows to queue their geometry again. When the draw list is retained,
+        the queues of the context keep references to the geometry of each
+        window, and a redraw caused only by windows being invalidated just
+        regenerates the geometry of those windows, without visiting the rest
+        of the hierarchy. Anything that changes which windows are drawn or in
+        which order (attaching, detaching, showing, hiding, z-order changes,
+        changing draw mode masks or rendering surfaces, calls to markAsDirty)
+        still causes a full redraw.
+
+        Windows rendered to a texture (see Window::setUsingAutoRenderingSurface)
+        are always drawn the regular way.
+    */
+    void setRetainedDrawListEnabled(bool setting);
+
+    //! Return whether the draw list is retained between frames.
+    bool isRetainedDrawListEnabled() const { return d_retainedDrawList; }
+
+    /*!
+    \brief
+        Set whether the geometry of windows that need redrawing is generated
+        on several threads at once before the window hierarchy is drawn.
+
+        This speeds up frames in which many windows are invalidated at once,
+        such as after a change of the display size. Only windows whose
+        WindowRenderer reports WindowRenderer::isGeometryGenerationThreadSafe
+        are handled this way; the result is identical to regular drawing.
+
+    \param threadCount
+        Number of threads generating geometry, including the thread drawing
+        the context, or 0 to use one per hardware thread. This is used when
+        enabling.
+
+    \see ParallelGeometryGenerator
+    */
+    void setParallelGeometryGenerationEnabled(bool setting, unsigned int threadCount = 0);
+
+    //! Return whether geometry is generated on several threads at once.
+    bool isParallelGeometryGenerationEnabled() const { return d_geometryGenerator != nullptr; }
+
+    /*!
+    \brief
+        Queue the geometry of \a window for drawing in \a ctx. This is used by
+        Window::drawSelf.
+    */
+    void queueWindowGeometry(Window& window, const RenderingContext& ctx);
+
+    /*!
+    \brief
+        Return the GeometryRecorder that windows record their new geometry
+        with when they already have geometry buffers, so that updating those
+        buffers in place is the only upload. This is used by
+        Window::bufferGeometry.
+    */
+    GeometryRecorder& getGeometryRecorder();
+
+    //! Describes how automatic texture caching judged a window.
+    struct AutoCacheEntry
+    {
+        Window* window;
+        //! whether the window is rendered to a texture by automatic caching.
+        bool cached;
+        //! number of vertices drawn for the window and its descendants.
+        size_t vertexCount;
+        //! estimated size of the texture needed to cache the window, in bytes.
+        size_t textureBytes;
+        //! number of redraws of the window or its descendants in the last interval.
+        std::uint32_t changes;
+        //! number of consecutive intervals without any such redraw.
+        std::uint32_t stableIntervals;
+    };
+
+    /*!
+    \brief
+        Set whether subtrees of the window hierarchy are cached in textures
+        automatically.
+
+        When enabled, the context counts how often each window and its
+        descendants are redrawn. Every few frames (see
+        setAutoCacheEvaluationInterval) windows whose subtree draws a lot of
+        geometry but has not changed for a while are switched to an automatic
+        RenderingWindow (as with Window::setUsingAutoRenderingSurface), so that
+        drawing them costs a single quad. Cached windows whose content keeps
+        changing are switched back, and the total size of the textures used is
+        kept within the budget set with setAutoCacheTextureBudget.
+
+        Windows that already have a RenderingSurface of their own, and their
+        descendants, are left alone. So is a cached window once
+        Window::setUsingAutoRenderingSurface is called for it. Disabling
+        automatic caching releases all the textures it allocated.
+    */
+    void setAutoCachingEnabled(bool setting);
+
+    //! Return whether subtrees are cached in textures automatically.
+    bool isAutoCachingEnabled() const { return d_autoCaching; }
+
+    //! Set the maximum size of all textures allocated by automatic caching, in bytes.
+    void setAutoCacheTextureBudget(size_t bytes) { d_autoCacheTextureBudget = bytes; }
+    //! Return the maximum size of all textures allocated by automatic caching.
+    size_t getAutoCacheTextureBudget() const { return d_autoCacheTextureBudget; }
+
+    //! Set the minimum number of vertices a subtree must draw to be cached.
+    void setAutoCacheMinVertexCount(size_t count) { d_autoCacheMinVertexCount = count; }
+    //! Return the minimum number of vertices a subtree must draw to be cached.
+    size_t getAutoCacheMinVertexCount() const { return d_autoCacheMinVertexCount; }
+
+    //! Set the number of frames between two evaluations of automatic caching.
+    void setAutoCacheEvaluationInterval(std::uint32_t frames) { d_autoCacheInterval = std::max(frames, 1u); }
+    //! Return the number of frames between two evaluations of automatic caching.
+    std::uint32_t getAutoCacheEvaluationInterval() const { return d_autoCacheInterval; }
+
+    //! Set the number of unchanged intervals after which a subtree is cached.
+    void setAutoCachePromotionDelay(std::uint32_t intervals) { d_autoCachePromotionDelay = intervals; }
+    //! Return the number of unchanged intervals after which a subtree is cached.
+    std::uint32_t getAutoCachePromotionDelay() const { return d_autoCachePromotionDelay; }
+
+    //! Set the number of redraws within one interval that make a cached subtree uncached.
+    void setAutoCacheDemotionThreshold(std::uint32_t changes) { d_autoCacheDemotionThreshold = std::max(changes, 1u); }
+    //! Return the number of redraws within one interval that make a cached subtree uncached.
+    std::uint32_t getAutoCacheDemotionThreshold() const { return d_autoCacheDemotionThreshold; }
+
+    /*!
+    \brief
+        Return the windows considered by the last evaluation of automatic
+        caching: all cached windows, and all windows drawing at least the
+        minimum number of vertices that could be cached.
+    */
+    const std::vector<AutoCacheEntry>& getAutoCacheEntries() const { return d_autoCacheEntries; }
+
+    //! Return the size of all textures currently allocated by automatic caching.
+    size_t getAutoCacheTextureMemory() const { return d_autoCacheTextureMemory; }
+
     bool isDirty() const { return d_dirtyDrawModeMask != 0; }
     std::uint32_t getDirtyDrawModeMask() const { return d_dirtyDrawModeMask; }
 
@@ -136,6 +292,24 @@ public:
     bool injectKeyUp(Key::Scan scanCode) override;
     bool injectChar(char32_t codePoint) override;
 
+    /*!
+    \brief
+        Set whether this context has an InputQueue.
+
+        Input injected into the queue, from any thread, is delivered to this
+        context at the start of the next injectTimePulse call. Disabling the
+        queue delivers any input still in it before destroying it. Both must
+        be done on the thread using the context while no other thread is
+        injecting into the queue.
+
+    \param capacity
+        Number of input events the queue can hold, used when creating it.
+    */
+    void setInputQueueEnabled(bool setting, size_t capacity = InputQueue::DefaultCapacity);
+
+    //! Return the InputQueue of this context, or nullptr if it has none.
+    InputQueue* getInputQueue() const { return d_inputQueue.get(); }
+
     /*!
     \brief
         Set automatic mouse button click event generation mode. Click is generated when the same window
@@ -363,6 +537,18 @@ protected:
     bool sendScrollEvent(float delta, Window* window);
 
     void drawWindowContentToTarget(std::uint32_t drawModeMask);
+    //! regenerate the geometry of d_redrawWindows; false if a full redraw is needed.
+    bool redrawRetainedWindows(std::uint32_t drawModeMask);
+    void invalidateDrawList();
+    //! generate the geometry of windows about to be drawn with d_geometryGenerator.
+    void generateGeometryInParallel(std::uint32_t drawModeMask);
+    void collectWindowsToRedraw(Window& window, std::uint32_t drawModeMask,
+                                std::vector<Window*>& windows) const;
+    //! promote and demote windows for automatic caching.
+    void evaluateAutoCache();
+    size_t collectAutoCacheEntries(Window& window, bool underSurface,
+                                   std::uint32_t& changes);
+    void setWindowAutoCached(Window& window, bool setting);
     void drawContent(std::uint32_t drawModeMask = DrawModeMaskAll) override;
 
     //! call some function for a chain of windows: (top, bottom]
@@ -426,6 +612,27 @@ protected:
 
     std::uint32_t d_dirtyDrawModeMask = 0; //!< the mask of draw modes that must be redrawn
 
+    //! windows invalidated since the retained draw list was built.
+    std::vector<Window*> d_redrawWindows;
+    std::unordered_set<const Window*> d_redrawWindowSet;
+    //! incremented each time the retained draw list is built.
+    std::uint64_t d_drawListGeneration = 0;
+    //! draw modes the retained draw list was built for.
+    std::uint32_t d_drawListDrawModeMask = 0;
+    //! window queued last while redrawing d_redrawWindows.
+    const Window* d_lastQueuedWindow = nullptr;
+
+    //! results of the last evaluation of automatic caching.
+    std::vector<AutoCacheEntry> d_autoCacheEntries;
+    size_t d_autoCacheTextureBudget = 16 * 1024 * 1024;
+    size_t d_autoCacheTextureMemory = 0;
+    size_t d_autoCacheMinVertexCount = 256;
+    std::uint32_t d_autoCacheInterval = 30;
+    std::uint32_t d_autoCachePromotionDelay = 4;
+    std::uint32_t d_autoCacheDemotionThreshold = 3;
+    //! frames drawn since automatic caching was last evaluated.
+    std::uint32_t d_autoCacheFrames = 0;
+
     float d_tooltipTimer = 0.f;
     float d_tooltipHoverTime = 0.4f;   //!< seconds cursor must stay stationary before tip shows
     float d_tooltipDisplayTime = 7.5f; //!< seconds that tip is shown for
@@ -434,6 +641,15 @@ protected:
     Event::ScopedConnection d_fontRenderSizeChangeConnection;
     std::vector<Event::ScopedConnection> d_tooltipEventConnections;
 
+    //! queue of input injected from other threads, drained in injectTimePulse.
+    std::unique_ptr<InputQueue> d_inputQueue;
+    //! generates window geometry on several threads, if enabled.
+    std::unique_ptr<ParallelGeometryGenerator> d_geometryGenerator;
+    //! windows handed to d_geometryGenerator; kept to reuse its storage.
+    std::vector<Window*> d_windowsToRedraw;
+    //! records the geometry of windows redrawn on the calling thread.
+    std::unique_ptr<GeometryRecorder> d_geometryRecorder;
+
     float d_autoRepeatElapsed = 0.f;
     MouseButton d_autoRepeatMouseButton = MouseButton::Invalid;
     bool d_autoRepeating = false;
@@ -443,6 +659,12 @@ protected:
     bool d_windowContainingCursorIsUpToDate = true;
     bool d_tooltipFollowsCursor = false;
     bool d_moveToFrontOnActivateAllowed = true;
+    bool d_retainedDrawList = false;
+    bool d_autoCaching = false;
+    //! whether the queues hold the retained draw list of the window hierarchy.
+    bool d_drawListValid = false;
+    //! whether queueWindowGeometry is called while redrawing d_redrawWindows.
+    bool d_redrawingRetainedWindows = false;
 };
 
 }
@@ -31,6 +31,7 @@
 #include "CEGUI/Rectf.h"
 #include "CEGUI/RefCounted.h"
 #include "CEGUI/Vertex.h"
+#include "CEGUI/MemoryTracker.h"
 #include <glm/gtc/quaternion.hpp>
 #include <vector>
 
@@ -168,6 +169,9 @@ public:
     */
     void setCustomTransform(const glm::mat4x4& transformation);
 
+    //! Return the custom transformation matrix set with setCustomTransform.
+    const glm::mat4x4& getCustomTransform() const { return d_customTransform; }
+
     /*!
     \brief
         Set the clipping region to be used when rendering this buffer. The
@@ -191,6 +195,9 @@ public:
     */
     void setStencilRenderingActive(PolygonFillRule fill_rule) { d_polygonFillRule = fill_rule; }
 
+    //! Return the fill rule used when rendering the geometry.
+    PolygonFillRule getStencilRenderingFillRule() const { return d_polygonFillRule; }
+
     /*!
     \brief
         Sets the number of vertices that should be rendered after the stencil buffer was filled.
@@ -200,6 +207,9 @@ public:
     */
     void setStencilPostRenderingVertexCount(unsigned int vertex_count) { d_postStencilVertexCount = vertex_count; }
 
+    //! Return the number of vertices that are rendered after the stencil buffer was filled.
+    unsigned int getStencilPostRenderingVertexCount() const { return d_postStencilVertexCount; }
+
     /*!
     \brief
         Append the geometry data to the existing data
@@ -213,6 +223,66 @@ public:
     */
     void appendGeometry(const float* vertex_data, size_t array_size);
 
+    /*!
+    \brief
+        Overwrite existing vertices in place, without changing the number or
+        layout of the vertices in the buffer.
+
+        Only the range of vertices that actually differs from the current data
+        is reported to the renderer, which allows it to update just that part
+        of its vertex buffer instead of uploading everything again.
+
+    \param first_vertex
+        Index of the first vertex to overwrite.
+
+    \param vertex_data
+        Pointer to an array of floats laid out according to the vertex
+        attributes of this GeometryBuffer.
+
+    \param array_size
+        The number of elements in the passed array. This must be a multiple of
+        getVertexAttributeElementCount.
+
+    \exception InvalidRequestException
+        thrown if the range does not lie within the existing vertex data.
+    */
+    void updateVertices(size_t first_vertex, const float* vertex_data, size_t array_size);
+
+    /*!
+    \brief
+        Return whether the geometry of \a other could be copied into this
+        GeometryBuffer with updateFrom, which is the case when both buffers use
+        the same shader and contain the same number of vertices with the same
+        layout. The parameters of the RenderMaterial, such as the textures,
+        may differ since updateFrom copies them.
+    */
+    bool isLayoutCompatible(const GeometryBuffer& other) const;
+
+    /*!
+    \brief
+        Make this GeometryBuffer render the same as \a other by overwriting
+        its vertices in place (see updateVertices), copying the shader
+        parameters of its RenderMaterial (see RenderMaterial::copyParametersFrom)
+        and copying the blending, fill rule, clipping, transformation, alpha
+        and RenderEffect settings.
+
+        This lets the owner of a GeometryBuffer keep it (and the renderer's
+        vertex buffer behind it) alive across redraws that produce geometry
+        with an unchanged layout. Since the RenderMaterial of this buffer is
+        modified, it should not be shared with other GeometryBuffers.
+
+    \exception InvalidRequestException
+        thrown if isLayoutCompatible(other) is false.
+    */
+    void updateFrom(const GeometryBuffer& other);
+
+    /*!
+    \brief
+        Copy the blending, fill rule, clipping, transformation, alpha and
+        RenderEffect settings of \a other, leaving the vertices unchanged.
+    */
+    void copyRenderSettings(const GeometryBuffer& other);
+
     /*!
     \brief
         Append the geometry for the solid colored rectangle to the existing data
@@ -504,7 +574,10 @@ public:
     */
     glm::mat4 getModelMatrix() const;
 
-    const std::vector<float>& getVertexData() const { return d_vertexData; }
+    //! Type of the container in which the vertex data is stored.
+    typedef std::vector<float, TrackedAllocator<float, MemoryTag::GeometryBuffer>> VertexData;
+
+    const VertexData& getVertexData() const { return d_vertexData; }
 
 protected:
 
@@ -512,6 +585,15 @@ protected:
 
     virtual void onGeometryChanged() {}
 
+    /*!
+    \brief
+        Called when the vertices in the given range were overwritten by
+        updateVertices while the total number of vertices stayed the same.
+        The default implementation treats this like any other change.
+    */
+    virtual void onGeometryRangeChanged(size_t /*first_vertex*/, size_t /*vertex_count*/)
+        { onGeometryChanged(); }
+
     //! Reference to the RenderMaterial used for this GeometryBuffer
     RefCounted<RenderMaterial>  d_renderMaterial;
     //! RenderEffect that will be used by the GeometryBuffer
@@ -520,7 +602,7 @@ protected:
     mutable const RenderTarget* d_lastRenderTarget = nullptr;
 
     //! The container in which the vertex data is stored.
-    std::vector<float>          d_vertexData;
+    VertexData                  d_vertexData;
     /*
     \brief
         A vector of the attributes of the vertices of this GeometryBuffer. The order
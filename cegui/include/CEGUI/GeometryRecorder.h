@@ -0,0 +1,125 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGeometryRecorder_h_
+#define _CEGUIGeometryRecorder_h_
+
+#include "CEGUI/Base.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class GeometryBuffer;
+class Renderer;
+class ShaderWrapper;
+
+/*!
+\brief
+    Records geometry into CPU-side GeometryBuffers on any thread.
+
+    While a GeometryRecorder is current on a thread (see setCurrent),
+    Renderer::createGeometryBufferTextured() and
+    Renderer::createGeometryBufferColoured() called on that thread return
+    buffers owned by the recorder instead of buffers created by the Renderer.
+    Such buffers hold vertices and render settings only and can not be drawn;
+    materialise replaces them with equivalent buffers created by the Renderer,
+    which must then be done on the thread that is allowed to use it.
+
+    This lets code that generates geometry through the regular GeometryBuffer
+    API run on worker threads, as done by ParallelGeometryGenerator. Since
+    recorded buffers never reach the graphics API, Window::bufferGeometry also
+    records the new geometry of windows whose existing buffers it can update
+    in place.
+*/
+class CEGUIEXPORT GeometryRecorder
+{
+public:
+    /*!
+    \brief
+        Constructor. This must be called on the thread that is allowed to use
+        \a renderer.
+    */
+    explicit GeometryRecorder(Renderer& renderer);
+    ~GeometryRecorder();
+
+    GeometryRecorder(const GeometryRecorder&) = delete;
+    GeometryRecorder& operator=(const GeometryRecorder&) = delete;
+
+    //! Make \a recorder current on the calling thread; nullptr stops recording.
+    static void setCurrent(GeometryRecorder* recorder);
+    //! Return the recorder current on the calling thread, or nullptr.
+    static GeometryRecorder* getCurrent();
+
+    //! Return a new recorded buffer for textured geometry.
+    GeometryBuffer& createGeometryBufferTextured();
+    //! Return a new recorded buffer for coloured geometry.
+    GeometryBuffer& createGeometryBufferColoured();
+
+    //! Return whether \a buffer was created by this recorder and is in use.
+    bool isRecorded(const GeometryBuffer& buffer) const;
+
+    /*!
+    \brief
+        Replace each buffer in \a buffers that was created by this recorder
+        with a buffer created by the Renderer that has the same vertices,
+        material parameters and render settings.
+    */
+    void materialise(std::vector<GeometryBuffer*>& buffers) const;
+
+    /*!
+    \brief
+        Release all recorded buffers. Their storage is kept and reused by the
+        buffers recorded next.
+    */
+    void clear();
+
+private:
+    class RecordedGeometryBuffer;
+
+    GeometryBuffer& createGeometryBuffer(bool textured);
+
+    Renderer& d_renderer;
+    ShaderWrapper* d_texturedShader;
+    ShaderWrapper* d_colouredShader;
+    //! recorded buffers in use.
+    std::vector<RecordedGeometryBuffer*> d_buffers;
+    //! released buffers kept for reuse, for textured and coloured geometry.
+    std::vector<RecordedGeometryBuffer*> d_freeTexturedBuffers;
+    std::vector<RecordedGeometryBuffer*> d_freeColouredBuffers;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIGeometryRecorder_h_
@@ -34,7 +34,10 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/ImageFactory.h"
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -144,13 +147,138 @@ public:
     void loadImageset(const String& filename, const String& resource_group = "");
     void loadImagesetFromString(const String& source);
 
+    /*!
+    \brief
+        Release an imageset loaded with loadImageset.
+
+        The ImageManager counts how many times the image collection created by
+        each imageset was loaded successfully, whatever file it was loaded
+        from. When this has been called as many times, the collection is
+        destroyed along with its texture, as with destroyImageCollection.
+
+        The caller must make sure that no window still uses any image of the
+        collection. Schemes do not call this when they are unloaded, since
+        they do not know which of their images are still in use.
+    */
+    void unloadImageset(const String& filename, const String& resource_group = "");
+
+    /*!
+    \brief
+        Destroy all images whose name starts with \a prefix followed by a '/',
+        such as the images of an imageset named \a prefix.
+
+        The ImageManager keeps an index of the images in each collection, so
+        this takes time proportional to the size of the collection rather than
+        to the number of images defined.
+
+    \param delete_texture
+        Whether to also destroy the texture named \a prefix.
+    */
     void destroyImageCollection(const String& prefix,
                                 const bool delete_texture = true);
 
+    /*!
+    \brief
+        Start creating images of the collection \a prefix in bulk.
+
+        Until endImageCollection is called, images created whose name is
+        \a prefix followed by a '/' and a name without further '/' are added to
+        the collection index directly. This is used while loading imagesets.
+
+    \param expectedCount
+        Number of images that are about to be created, if known, so that
+        storage for them is only allocated once.
+    */
+    void beginImageCollection(const String& prefix, size_t expectedCount = 0);
+    //! End creating images in bulk started by beginImageCollection.
+    void endImageCollection();
+
+    //! Return the number of images in the collection \a prefix.
+    size_t getImageCollectionSize(const String& prefix) const;
+
     void addBitmapImageFromFile(const String& name,
                           const String& filename,
                           const String& resource_group = "");
 
+    //! Statistics about the texture atlas pages built by the ImageManager.
+    struct AtlasStatistics
+    {
+        //! number of atlas page textures currently in use.
+        size_t d_pageCount = 0;
+        //! number of images currently placed on atlas pages.
+        size_t d_imageCount = 0;
+        //! number of images placed from a loaded atlas layout without packing.
+        size_t d_layoutPlacements = 0;
+        //! number of images that could not be packed and got their own texture.
+        size_t d_rejectedImages = 0;
+        //! pixels of atlas pages occupied by images, including padding.
+        size_t d_usedPixels = 0;
+        //! total pixels of all atlas pages in use.
+        size_t d_totalPixels = 0;
+    };
+
+    /*!
+    \brief
+        Set whether images loaded with addBitmapImageFromFile (including the
+        image file imagesets of a Scheme) are packed into shared atlas textures.
+
+        When enabled, images in a format that can be packed and no larger than
+        getAtlasMaxImageSize are decoded into memory and copied into atlas page
+        textures, and their BitmapImage refers to the page and the area of the
+        page it occupies. Fewer textures means that BitmapImage can combine the
+        geometry of more images into the same GeometryBuffer. Images that are
+        not packed get their own texture named after the image, as usual.
+
+        This is disabled by default. It only affects images loaded afterwards.
+    */
+    void setAtlasPackingEnabled(bool setting) { d_atlasPackingEnabled = setting; }
+    //! Return whether images loaded from files are packed into atlas pages.
+    bool isAtlasPackingEnabled() const { return d_atlasPackingEnabled; }
+
+    /*!
+    \brief
+        Set the width and height of new atlas page textures, in pixels. This is
+        limited to the maximum texture size supported by the Renderer.
+    */
+    void setAtlasPageSize(unsigned int size);
+    //! Return the width and height of new atlas page textures, in pixels.
+    unsigned int getAtlasPageSize() const { return d_atlasPageSize; }
+
+    /*!
+    \brief
+        Set the largest width or height an image may have to be packed into an
+        atlas page, in pixels.
+    */
+    void setAtlasMaxImageSize(unsigned int size) { d_atlasMaxImageSize = size; }
+    //! Return the largest width or height of images packed into atlas pages.
+    unsigned int getAtlasMaxImageSize() const { return d_atlasMaxImageSize; }
+
+    //! Return statistics about the atlas pages currently in use.
+    AtlasStatistics getAtlasStatistics() const;
+
+    /*!
+    \brief
+        Write the placement of all images currently packed into atlas pages
+        to the file \a filename, so that it can be loaded on subsequent runs
+        with loadAtlasLayout.
+
+    \exception FileIOException
+        thrown if the file can not be written.
+    */
+    void saveAtlasLayout(const String& filename) const;
+
+    /*!
+    \brief
+        Load an atlas layout written by saveAtlasLayout.
+
+        Images listed in the layout are placed at their recorded page and
+        position when they are loaded, instead of being packed. Images that
+        are not listed, or whose size does not match the layout, are packed
+        into pages after those of the layout. Must be called before any
+        images are packed.
+    */
+    void loadAtlasLayout(const String& filename, const String& resourceGroup = "");
+
     /*!
     \brief
         Notify the ImageManager that the display size may have changed.
@@ -212,6 +340,16 @@ private:
     //! helper to delete an image given an map iterator.
     void destroy(ImageMap::iterator& iter);
 
+    //! set of names (keys of d_images) of the images in a collection.
+    typedef std::unordered_set<const String*> ImageCollection;
+    //! container type used to index the images by collection.
+    typedef std::unordered_map<String, ImageCollection> ImageCollectionMap;
+
+    //! add an image from d_images to the collections it belongs to.
+    void addToCollections(const String& name);
+    //! remove an image from d_images from the collections it belongs to.
+    void removeFromCollections(const String& name);
+
     // XML parsing helper functions.
     void elementImagesetStart(const XMLAttributes& attributes);
 
@@ -232,6 +370,64 @@ private:
     ImageFactoryRegistry d_factories;
     //! container holding the images.
     ImageMap d_images;
+    //! index of images by every prefix of their name ending before a '/'.
+    ImageCollectionMap d_collections;
+    //! collection opened with beginImageCollection, or nullptr.
+    ImageCollection* d_openCollection = nullptr;
+    //! name of the collection opened with beginImageCollection.
+    String d_openCollectionName;
+
+    //! image collection created by each imageset file loaded with loadImageset, by resource group and filename.
+    std::map<std::pair<String, String>, String> d_imagesetCollections;
+    //! number of successful loadImageset calls for each image collection.
+    std::unordered_map<String, unsigned int> d_imagesetLoadCounts;
+
+    //! One atlas page texture and the state of packing images into it.
+    struct AtlasPage
+    {
+        //! page texture, nullptr until the first image is placed on the page.
+        Texture* d_texture = nullptr;
+        //! width and height of the page texture.
+        unsigned int d_size = 0;
+        //! number of images currently placed on the page.
+        size_t d_imageCount = 0;
+        //! pixels occupied by images, including padding.
+        size_t d_usedPixels = 0;
+        //! top of the shelf images are currently added to.
+        unsigned int d_shelfTop = 0;
+        //! height of the current shelf.
+        unsigned int d_shelfHeight = 0;
+        //! horizontal position of the next image on the current shelf.
+        unsigned int d_shelfRight = 0;
+        //! whether this page is reserved for images of a loaded layout.
+        bool d_fromLayout = false;
+    };
+
+    //! Placement of an image on an atlas page.
+    struct AtlasPlacement
+    {
+        size_t d_page;
+        //! area of the image itself, excluding padding.
+        Rectf d_area;
+    };
+
+    bool addBitmapImageToAtlas(const String& name, const String& filename,
+                               const String& resource_group);
+    bool findAtlasSpace(unsigned int width, unsigned int height,
+                        size_t& page, glm::vec2& position);
+    Texture& getAtlasPageTexture(size_t page);
+    void releaseAtlasPlacement(const String& name);
+
+    bool d_atlasPackingEnabled = false;
+    unsigned int d_atlasPageSize = 1024;
+    unsigned int d_atlasMaxImageSize = 256;
+    size_t d_atlasLayoutPlacements = 0;
+    size_t d_atlasRejectedImages = 0;
+    std::vector<AtlasPage> d_atlasPages;
+    //! placements of images currently on atlas pages, by image name.
+    std::unordered_map<String, AtlasPlacement> d_atlasPlacements;
+    //! placements read by loadAtlasLayout, by image name.
+    std::unordered_map<String, AtlasPlacement> d_atlasLayout;
 };
 
 //---------------------------------------------------------------------------//
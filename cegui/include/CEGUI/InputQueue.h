@@ -0,0 +1,186 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIInputQueue_h_
+#define _CEGUIInputQueue_h_
+
+#include "CEGUI/InjectedInputReceiver.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Thread-safe queue of raw input for an InjectedInputReceiver.
+
+    Any number of threads may inject input into the queue at the same time
+    using the regular InjectedInputReceiver interface. The input is stored in
+    a fixed size lock-free ring buffer and delivered to the receiver, in the
+    order it was injected, when the consuming thread calls drain. GUIContext
+    owns such a queue when GUIContext::setInputQueueEnabled is used, and
+    drains it in GUIContext::injectTimePulse.
+
+    Consecutive cursor moves and consecutive wheel changes can be coalesced
+    while draining, so that high frequency mice cause a single cursor move
+    (and therefore a single hit test) per run of moves. Any other input ends
+    a run, so the order of cursor moves relative to buttons, keys and
+    characters is preserved.
+
+\note
+    Injecting into the queue returns whether the input was queued, not whether
+    it was handled. Input injected while the queue is full is dropped and
+    counted, see getDroppedCount.
+*/
+class CEGUIEXPORT InputQueue : public InjectedInputReceiver
+{
+public:
+    //! Default number of input events the queue can hold.
+    static const size_t DefaultCapacity;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param capacity
+        Number of input events the queue can hold. It is rounded up to a power
+        of two.
+    */
+    explicit InputQueue(size_t capacity = DefaultCapacity);
+
+    // Implementation of InjectedInputReceiver interface, may be called from any thread
+    bool injectMouseMove(float dx, float dy) override;
+    bool injectMouseLeaves() override;
+    bool injectMouseButtonDown(MouseButton button) override;
+    bool injectMouseButtonUp(MouseButton button) override;
+    bool injectKeyDown(Key::Scan scanCode) override;
+    bool injectKeyUp(Key::Scan scanCode) override;
+    bool injectChar(char32_t codePoint) override;
+    bool injectMouseWheelChange(float delta) override;
+    bool injectMousePosition(float x, float y) override;
+    bool injectMouseButtonClick(MouseButton button) override;
+    bool injectMouseButtonDoubleClick(MouseButton button) override;
+    bool injectMouseButtonTripleClick(MouseButton button) override;
+
+    /*!
+    \brief
+        Deliver the queued input to \a receiver, in the order it was injected.
+
+        Only one thread may drain the queue at a time. Input injected while
+        draining may or may not be delivered by this call; at most getCapacity
+        events are taken from the queue, so producers can't keep it busy.
+
+    \return
+        The number of inject calls made on \a receiver.
+    */
+    size_t drain(InjectedInputReceiver& receiver);
+
+    /*!
+    \brief
+        Set whether consecutive cursor moves and positions are merged into a
+        single cursor move when draining. Enabled by default.
+
+    \note
+        Cursor constraints are applied to the merged move, so a run of moves
+        that leaves the constraint area and comes back may end at a slightly
+        different place than the same moves injected one by one.
+    */
+    void setCursorMoveCoalescing(bool setting) { d_coalesceCursorMoves = setting; }
+    //! Return whether consecutive cursor moves are merged when draining.
+    bool isCursorMoveCoalescing() const { return d_coalesceCursorMoves; }
+
+    //! Set whether consecutive wheel changes are summed when draining. Enabled by default.
+    void setWheelCoalescing(bool setting) { d_coalesceWheel = setting; }
+    //! Return whether consecutive wheel changes are summed when draining.
+    bool isWheelCoalescing() const { return d_coalesceWheel; }
+
+    //! Return the number of input events the queue can hold.
+    size_t getCapacity() const { return d_mask + 1; }
+
+    //! Return the number of input events dropped because the queue was full.
+    size_t getDroppedCount() const { return d_dropped.load(std::memory_order_relaxed); }
+
+private:
+    enum class InputType : std::uint8_t
+    {
+        MouseMove,
+        MousePosition,
+        MouseLeaves,
+        MouseWheel,
+        MouseButtonDown,
+        MouseButtonUp,
+        MouseButtonClick,
+        MouseButtonDoubleClick,
+        MouseButtonTripleClick,
+        KeyDown,
+        KeyUp,
+        Char
+    };
+
+    struct Input
+    {
+        InputType type;
+        float x;
+        float y;
+        std::uint32_t code;
+    };
+
+    //! ring buffer cell, see push and pop for the use of the sequence number.
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        Input input;
+    };
+
+    bool push(InputType type, float x, float y, std::uint32_t code);
+    bool pop(Input& input);
+    static void dispatch(InjectedInputReceiver& receiver, const Input& input);
+
+    std::unique_ptr<Slot[]> d_slots;
+    size_t d_mask;
+    //! position of the next push, shared by the producers.
+    std::atomic<size_t> d_enqueuePos;
+    //! position of the next pop, only used by the consumer.
+    size_t d_dequeuePos;
+    std::atomic<size_t> d_dropped;
+
+    bool d_coalesceCursorMoves;
+    bool d_coalesceWheel;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIInputQueue_h_
@@ -101,6 +101,10 @@ public:
 	\brief
 		Add an event to the log.
 
+		This may be called from several threads at once, for example when an
+		Exception is constructed on a worker thread of the
+		ParallelResourceLoader, so implementations must serialise it.
+
 	\param message
 		String object containing the message to be added to the event log.
 
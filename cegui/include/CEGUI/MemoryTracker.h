@@ -0,0 +1,207 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIMemoryTracker_h_
+#define _CEGUIMemoryTracker_h_
+
+#include "CEGUI/Base.h"
+#include <cstddef>
+#include <memory>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Subsystems whose memory use is counted by the MemoryTracker.
+enum class MemoryTag : int
+{
+    //! Window and other Element objects.
+    Window,
+    //! The property registries of PropertySet objects.
+    PropertySet,
+    //! Event objects and the event maps of EventSet objects.
+    EventSet,
+    //! Vertex data held by GeometryBuffer objects.
+    GeometryBuffer,
+    //! Laid out text held by RenderedText objects.
+    RenderedText,
+    //! CPU side copies of font glyph atlas textures.
+    Font,
+    //! Attributes and compiled blobs produced while parsing XML.
+    XML,
+
+    //! Number of tags; not a valid tag.
+    Count
+};
+
+//! Memory use counted for a MemoryTag.
+struct MemoryStatistics
+{
+    //! Number of bytes currently allocated.
+    size_t d_liveBytes = 0;
+    //! Number of allocations not yet freed.
+    size_t d_liveAllocations = 0;
+    //! Highest value of d_liveBytes since start up or MemoryTracker::resetPeaks.
+    size_t d_peakBytes = 0;
+    //! Number of allocations made since start up.
+    size_t d_totalAllocations = 0;
+};
+
+/*!
+\brief
+    Counts the memory allocated by the main CEGUI subsystems, per subsystem.
+
+    Counting is only performed when CEGUI is built with the
+    CEGUI_TRACK_ALLOCATIONS option. The tracked classes and containers then
+    allocate through MemoryTracker::allocate, either via the class operators
+    added by CEGUI_TRACK_CLASS_ALLOCATIONS or via TrackedAllocator. In other
+    builds the tracked types use the normal allocation functions and all
+    statistics stay zero.
+
+    Counters are updated atomically, so allocations may be made from any
+    thread.
+
+\see System::getMemoryStatistics
+*/
+class CEGUIEXPORT MemoryTracker
+{
+public:
+    //! Return whether this build of CEGUI counts allocations.
+    static bool isEnabled()
+    {
+#ifdef CEGUI_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /*!
+    \brief
+        Allocate \a size bytes with the global operator new and count them
+        against \a tag.
+
+    \exception std::bad_alloc
+        thrown if the memory could not be allocated.
+    */
+    static void* allocate(MemoryTag tag, size_t size);
+
+    //! Free memory returned by allocate that was counted against \a tag.
+    static void deallocate(MemoryTag tag, void* p, size_t size) noexcept;
+
+    //! Return the statistics currently counted for \a tag.
+    static MemoryStatistics getStatistics(MemoryTag tag);
+
+    //! Set the peak of every tag to its current number of live bytes.
+    static void resetPeaks();
+
+    //! Return the name of \a tag, as used in log output.
+    static const char* getTagName(MemoryTag tag);
+};
+
+/*!
+\brief
+    Standard library allocator that allocates through the MemoryTracker,
+    counting the memory against \a Tag.
+*/
+template<typename T, MemoryTag Tag>
+class MemoryTrackingAllocator
+{
+public:
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind { typedef MemoryTrackingAllocator<U, Tag> other; };
+
+    MemoryTrackingAllocator() noexcept {}
+
+    template<typename U>
+    MemoryTrackingAllocator(const MemoryTrackingAllocator<U, Tag>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(MemoryTracker::allocate(Tag, n * sizeof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        MemoryTracker::deallocate(Tag, p, n * sizeof(T));
+    }
+};
+
+template<typename T, typename U, MemoryTag Tag>
+inline bool operator==(const MemoryTrackingAllocator<T, Tag>&,
+                       const MemoryTrackingAllocator<U, Tag>&)
+{
+    return true;
+}
+
+template<typename T, typename U, MemoryTag Tag>
+inline bool operator!=(const MemoryTrackingAllocator<T, Tag>&,
+                       const MemoryTrackingAllocator<U, Tag>&)
+{
+    return false;
+}
+
+/*!
+\brief
+    Allocator used by containers whose memory is counted against \a Tag. This
+    is MemoryTrackingAllocator when CEGUI_TRACK_ALLOCATIONS is defined and
+    std::allocator otherwise.
+*/
+#ifdef CEGUI_TRACK_ALLOCATIONS
+template<typename T, MemoryTag Tag>
+using TrackedAllocator = MemoryTrackingAllocator<T, Tag>;
+#else
+template<typename T, MemoryTag Tag>
+using TrackedAllocator = std::allocator<T>;
+#endif
+
+} // End of  CEGUI namespace section
+
+/*!
+\brief
+    Declares class specific operator new and delete that count instances of
+    the class and of all classes derived from it against \a tag. Expands to
+    nothing when CEGUI_TRACK_ALLOCATIONS is not defined.
+
+    This must be used in the public section of the class declaration, and the
+    class must have a virtual destructor if instances are deleted through a
+    pointer to a base class.
+*/
+#ifdef CEGUI_TRACK_ALLOCATIONS
+#   define CEGUI_TRACK_CLASS_ALLOCATIONS(tag) \
+    static void* operator new(size_t size) \
+    { return ::CEGUI::MemoryTracker::allocate(tag, size); } \
+    static void operator delete(void* p, size_t size) noexcept \
+    { ::CEGUI::MemoryTracker::deallocate(tag, p, size); } \
+    static void* operator new(size_t, void* where) noexcept \
+    { return where; } \
+    static void operator delete(void*, void*) noexcept {}
+#else
+#   define CEGUI_TRACK_CLASS_ALLOCATIONS(tag)
+#endif
+
+#endif  // end of guard _CEGUIMemoryTracker_h_
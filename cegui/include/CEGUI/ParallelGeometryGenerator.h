@@ -0,0 +1,149 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIParallelGeometryGenerator_h_
+#define _CEGUIParallelGeometryGenerator_h_
+
+#include "CEGUI/Base.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class GeometryBuffer;
+class GeometryRecorder;
+class Window;
+
+/*!
+\brief
+    Generates the geometry of many windows at once using a pool of threads.
+
+    Generating geometry is split in three steps. The windows are prepared on
+    the calling thread, which fires Window::EventRenderingStarted and updates
+    the cached areas the window renderers read. Then
+    WindowRenderer::createRenderGeometry runs on the worker threads and the
+    calling thread, with each thread recording the geometry into CPU-side
+    buffers (see GeometryRecorder). Each thread works through its own share of
+    the windows and then takes windows from the back of the other threads'
+    shares, so uneven windows don't leave threads idle. Finally, on the
+    calling thread and in the order the windows were given, the recorded
+    geometry either updates the previous buffers of the window in place or is
+    copied into new buffers created by the Renderer, and
+    Window::EventRenderingEnded is fired.
+
+    The result is identical to drawing the windows one after another. Only
+    windows whose WindowRenderer reports
+    WindowRenderer::isGeometryGenerationThreadSafe are handled; others are
+    left to be drawn the regular way.
+
+\see GUIContext::setParallelGeometryGenerationEnabled
+*/
+class CEGUIEXPORT ParallelGeometryGenerator
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param threadCount
+        Number of threads generating geometry, including the thread calling
+        generate, or 0 to use one per hardware thread.
+    */
+    explicit ParallelGeometryGenerator(unsigned int threadCount = 0);
+    ~ParallelGeometryGenerator();
+
+    ParallelGeometryGenerator(const ParallelGeometryGenerator&) = delete;
+    ParallelGeometryGenerator& operator=(const ParallelGeometryGenerator&) = delete;
+
+    //! Return the number of threads generating geometry.
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(d_queues.size()); }
+
+    /*!
+    \brief
+        Generate the geometry of those \a windows that need redrawing and can
+        do so on other threads, as Window::bufferGeometry would. This must be
+        called from the thread that is allowed to use the Renderer.
+
+    \exception
+        Any exception thrown while generating geometry is rethrown once all
+        the windows have been completed.
+    */
+    void generate(const std::vector<Window*>& windows);
+
+private:
+    struct Task
+    {
+        Window* d_window;
+        std::vector<GeometryBuffer*> d_previousBuffers;
+        //! index of the thread that generated the geometry.
+        unsigned int d_thread;
+        std::exception_ptr d_error;
+    };
+
+    //! tasks of one thread; the owner takes from the front, others steal from the back.
+    struct TaskQueue
+    {
+        std::mutex d_mutex;
+        std::deque<size_t> d_tasks;
+        std::unique_ptr<GeometryRecorder> d_recorder;
+    };
+
+    void workerMain(unsigned int thread);
+    void runTasks(unsigned int thread);
+    bool takeTask(unsigned int thread, size_t& task);
+
+    std::vector<Task> d_tasks;
+    std::vector<std::unique_ptr<TaskQueue> > d_queues;
+    std::vector<std::thread> d_workers;
+
+    std::mutex d_mutex;
+    std::condition_variable d_batchStarted;
+    std::condition_variable d_batchDone;
+    //! incremented for every batch of tasks handed to the workers.
+    std::uint64_t d_batch = 0;
+    //! number of workers still working on the current batch.
+    unsigned int d_busyWorkers = 0;
+    bool d_stopping = false;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIParallelGeometryGenerator_h_
@@ -0,0 +1,168 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIParallelResourceLoader_h_
+#define _CEGUIParallelResourceLoader_h_
+
+#include "CEGUI/String.h"
+#include "CEGUI/Texture.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class RawDataContainer;
+class Scheme;
+
+/*!
+\brief
+    Loads the resources of a Scheme using a pool of worker threads.
+
+    Loading a scheme is dominated by two kinds of CPU work that do not depend
+    on any GUI state: parsing XML (imagesets, fonts, looknfeels) and decoding
+    image files. This class runs that work as a small task graph on worker
+    threads - parsing an XML imageset produces a task that decodes the image
+    file it refers to - and keeps the results in memory.
+
+    The results are then committed on the calling thread by running the
+    regular Scheme::loadResources, with parsed XML supplied through
+    XMLBinaryCache::addPreparedBlob and decoded images supplied through
+    System::setImageCodecOverride. Textures, images, fonts and looks are
+    therefore created by the same code, in the same order, as with sequential
+    loading and the result is identical. Anything that could not be prepared
+    (because of an error, or because the data changed in between) is simply
+    loaded the normal way, so errors are reported exactly as before.
+
+    Replaying parsed XML skips schema validation, so XML is only prepared
+    ahead of time while the XMLBinaryCache is enabled. Otherwise imagesets
+    are still parsed on the workers to find their image files, but all XML
+    is parsed again, with validation, when the resources are committed.
+
+    Worker threads only access the ResourceProvider while holding a lock, so
+    any ResourceProvider may be used. When the XMLParser does not report
+    XMLParser::isThreadSafe (e.g. Libxml2 and Xerces) the resources are
+    loaded sequentially instead. The ImageCodec must support being used from
+    several threads at once, which is the case for the codecs that keep no
+    global state (such as STB and TGA) but not, for example, for DevIL.
+    Errors on the worker threads construct Exceptions, which log, so the
+    Logger must be thread-safe as well; DefaultLogger is.
+
+\see SchemeManager::setParallelLoadingEnabled
+*/
+class CEGUIEXPORT ParallelResourceLoader
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param threadCount
+        Number of worker threads to use, or 0 to use one per hardware thread.
+    */
+    explicit ParallelResourceLoader(unsigned int threadCount = 0);
+    ~ParallelResourceLoader();
+
+    //! Return the number of worker threads used.
+    unsigned int getThreadCount() const { return d_threadCount; }
+
+    /*!
+    \brief
+        Load all resources of \a scheme. This is equivalent to calling
+        Scheme::loadResources, and must be called from the thread that is
+        allowed to use the Renderer.
+    */
+    void loadResources(Scheme& scheme);
+
+private:
+    //! pixel data of an image file that was decoded ahead of time.
+    struct DecodedImage
+    {
+        size_t d_sourceSize;
+        std::vector<std::uint8_t> d_pixels;
+        float d_width;
+        float d_height;
+        Texture::PixelFormat d_format;
+    };
+
+    typedef std::unordered_map<std::uint64_t, DecodedImage> DecodedImageMap;
+
+    class PreparedImageCodec;
+
+    void queueTask(std::function<void()> task);
+    void runTasks();
+    void workerMain();
+
+    void prepareXML(const String& filename, const String& resourceGroup,
+                    const String& schemaName, bool isImageset);
+    void prepareImage(const String& filename, const String& resourceGroup);
+    bool loadRawData(const String& filename, const String& resourceGroup,
+                     RawDataContainer& output);
+    void unloadRawData(RawDataContainer& data);
+
+    void commit(Scheme& scheme);
+
+    unsigned int d_threadCount;
+    //! whether parsed XML is handed to the XMLBinaryCache.
+    bool d_keepBlobs;
+
+    //! tasks that are waiting for a worker.
+    std::deque<std::function<void()> > d_tasks;
+    //! number of tasks queued or running.
+    size_t d_pendingTasks;
+    //! tells the workers to exit once the queue is empty.
+    bool d_stopping;
+    std::mutex d_taskMutex;
+    std::condition_variable d_taskAdded;
+    std::condition_variable d_tasksDone;
+
+    //! serialises access to the ResourceProvider.
+    std::mutex d_resourceMutex;
+
+    //! guards the results below.
+    std::mutex d_resultMutex;
+    //! parsed XML files; pairs of file name / resource group and the blob.
+    std::vector<std::pair<std::pair<String, String>, std::vector<std::uint8_t> > > d_blobs;
+    //! decoded images keyed by the hash of the image file data.
+    DecodedImageMap d_images;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIParallelResourceLoader_h_
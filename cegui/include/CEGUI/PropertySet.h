@@ -31,8 +31,10 @@
 
 #include "CEGUI/Property.h"
 #include "CEGUI/IteratorBase.h"
+#include "CEGUI/MemoryTracker.h"
 #include "CEGUI/TplWindowProperty.h" // for CEGUI_DEFINE_PROPERTY, see below //???move both out of here?
 #include <unordered_map>
+#include <memory>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -105,6 +107,15 @@ public:
 	*/
     PropertySet(void) {}
 
+    /*!
+    \brief
+        Copy constructor. A shared property table stays shared, otherwise
+        the copy gets its own table.
+    */
+    PropertySet(const PropertySet& other);
+
+    PropertySet& operator=(const PropertySet& other);
+
 
     /*!
 	\brief
@@ -211,14 +222,13 @@ public:
     template<typename T>
     typename PropertyHelper<T>::return_type getProperty(const String& name) const
     {
-        PropertyRegistry::const_iterator pos = d_properties.find(name);
+        Property* baseProperty = findProperty(name);
 
-        if (pos == d_properties.end())
+        if (!baseProperty)
         {
             throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
         }
 
-        Property* baseProperty = pos->second;
         TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
 
         if (typedProperty)
@@ -257,14 +267,13 @@ public:
     template<typename T>
     void    setProperty(const String& name, typename PropertyHelper<T>::pass_type value)
     {
-        PropertyRegistry::iterator pos = d_properties.find(name);
+        Property* baseProperty = findProperty(name);
 
-        if (pos == d_properties.end())
+        if (!baseProperty)
         {
             throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
         }
 
-        Property* baseProperty = pos->second;
         TypedProperty<T>* typedProperty = dynamic_cast<TypedProperty<T>* >(baseProperty);
 
         if (typedProperty)
@@ -305,9 +314,38 @@ public:
 	*/
     String getPropertyDefault(const String& name) const;
 
+    /*!
+    \brief
+        Replace the table of Properties of this PropertySet with a shared table
+        holding exactly the same Properties.
+
+        Every PropertySet normally keeps its own table, although sets of the
+        same class (e.g. Windows of the same type and look) contain the same
+        Property objects. After calling this, all PropertySets with the same
+        Properties use a single immutable table. Adding or removing a Property
+        later gives the set its own copy of the table again.
+
+        This is done for every Window once its type and look are set up, there
+        is normally no need to call it from client code.
+    */
+    void sharePropertyTable();
+
+    //! Return whether this PropertySet uses a table shared by sharePropertyTable.
+    bool isPropertyTableShared() const { return d_propertiesShared; }
+
 private:
-    typedef std::unordered_map<String, Property*> PropertyRegistry;
-    PropertyRegistry	d_properties;
+    typedef std::unordered_map<String, Property*, std::hash<String>, std::equal_to<String>,
+                               TrackedAllocator<std::pair<const String, Property*>, MemoryTag::PropertySet>> PropertyRegistry;
+
+    //! Return the Property named \a name or nullptr if there is no such Property.
+    Property* findProperty(const String& name) const;
+    //! Return the table for modification, making a private copy if it is shared.
+    PropertyRegistry& getWritablePropertyTable();
+
+    //! table of Properties; may be shared and is nullptr while empty.
+    std::shared_ptr<PropertyRegistry> d_properties;
+    //! whether d_properties was obtained from the shared table pool.
+    bool d_propertiesShared = false;
 
 
 public:
@@ -66,6 +66,13 @@ public:
 	*/
     const ShaderWrapper* getShaderWrapper() const { return d_shaderWrapper; }
 
+    /*!
+    \brief
+        Copies all the shader parameters of \a other, including the main
+        texture, into this material (see ShaderParameterBindings::copyFrom).
+    */
+    void copyParametersFrom(const RenderMaterial& other);
+
     //! \brief Applies the shader parameter bindings to the shader of this material.
     void prepareForRendering() const;
 
@@ -28,6 +28,7 @@
 #define _CEGUIRenderQueue_h_
 
 #include "CEGUI/Base.h"
+#include <utility>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -52,6 +53,9 @@ namespace CEGUI
 class CEGUIEXPORT RenderQueue 
 {
 public:
+    //! Type to use for the GeometryBuffer collection.
+    typedef std::vector<GeometryBuffer*> BufferList;
+
     /*!
     \brief
         Draw all GeometryBuffer objects currently listed in the RenderQueue.
@@ -80,6 +84,29 @@ public:
     */
     void addGeometryBuffer(GeometryBuffer& geometry_buffer);
 
+    /*!
+    \brief
+        Add a list of GeometryBuffers to the RenderQueue by reference.
+
+        Unlike addGeometryBuffers, the queue keeps a pointer to the list itself
+        and draws whatever the list contains at the time of drawing, so the
+        owner of the list can replace its GeometryBuffers without touching the
+        queue. The list must stay alive until the queue is reset.
+
+    \param geometry_buffers
+        List of GeometryBuffers that is to be drawn at this position in the
+        RenderQueue.
+    */
+    void addGeometryBufferList(const BufferList& geometry_buffers);
+
+    /*!
+    \brief
+        Replace the lists added with addGeometryBufferList by the
+        GeometryBuffers they currently contain, so the queue no longer refers to
+        the lists themselves.
+    */
+    void resolveGeometryBufferLists();
+
     /*!
     \brief
         Remove a GeometryBuffer previously queued for drawing.  If the specified
@@ -99,14 +126,22 @@ public:
     */
     void reset();
 
-    //! Type to use for the GeometryBuffer collection.
-    typedef std::vector<GeometryBuffer*> BufferList;
-    BufferList& getBuffers()         {return d_buffers;}
+    /*!
+    \brief
+        Return all GeometryBuffers in the queue, in drawing order. When lists
+        were added with addGeometryBufferList, this is a copy that includes
+        their current content.
+    */
+    BufferList& getBuffers();
 
 private:
 
     //! Collection of GeometryBuffer objects that comprise this RenderQueue.
     BufferList d_buffers;
+    //! lists added by reference, with the position in d_buffers they precede.
+    std::vector<std::pair<size_t, const BufferList*> > d_bufferLists;
+    //! d_buffers merged with the content of d_bufferLists; see getBuffers.
+    BufferList d_mergedBuffers;
 };
 
 } // End of  CEGUI namespace section
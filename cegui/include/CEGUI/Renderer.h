@@ -32,6 +32,7 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/RefCounted.h"
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <map>
 #include <vector>
 #include <set>
@@ -133,6 +134,9 @@ public:
         You should remove the GeometryBuffer from any RenderQueues and call destroyGeometryBuffer
         when you want to destroy the GeometryBuffer.
 
+        While a GeometryRecorder is current on the calling thread, the buffer
+        is created by that recorder instead.
+
     \return
         GeometryBuffer object.
     */
@@ -156,6 +160,9 @@ public:
         You should remove the GeometryBuffer from any RenderQueues and call destroyGeometryBuffer
         when you want to destroy the GeometryBuffer.
 
+        While a GeometryRecorder is current on the calling thread, the buffer
+        is created by that recorder instead.
+
     \return
         GeometryBuffer object.
     */
@@ -213,6 +220,62 @@ public:
     */
     virtual void destroyAllTextureTargets() = 0;
 
+    //! Statistics of the pool used by acquireTextureTarget.
+    struct TextureTargetPoolStats
+    {
+        //! number of TextureTargets currently waiting in the pool.
+        size_t pooledTargets = 0;
+        //! number of calls to acquireTextureTarget.
+        size_t acquisitions = 0;
+        //! number of acquisitions that were served from the pool.
+        size_t hits = 0;
+        //! number of released TextureTargets destroyed because the pool was full.
+        size_t evictions = 0;
+
+        //! Return the fraction of acquisitions that were served from the pool.
+        float getHitRate() const
+        { return acquisitions ? static_cast<float>(hits) / acquisitions : 0.0f; }
+    };
+
+    /*!
+    \brief
+        Return a TextureTarget able to hold at least \a size pixels, reusing
+        one released with releaseTextureTarget if possible.
+
+        Pooled TextureTargets are kept in buckets by size class (the size
+        rounded up to powers of two, see getTextureTargetSizeClass) and stencil
+        requirement. The smallest pooled target that is large enough is
+        returned; new targets are created with the full size of their class, so
+        that they can be reused for any size within it. Users of the target
+        should therefore only use the part they need, as RenderingWindow does.
+
+    \return
+        Pointer to a TextureTarget, or nullptr if the renderer is unable to
+        offer such a thing.
+    */
+    TextureTarget* acquireTextureTarget(const Sizef& size, bool addStencilBuffer);
+
+    /*!
+    \brief
+        Return a TextureTarget obtained from acquireTextureTarget to the pool,
+        or destroy it if the pool is full.
+    */
+    void releaseTextureTarget(TextureTarget* target);
+
+    //! Destroy all TextureTargets waiting in the pool.
+    void clearTextureTargetPool();
+
+    //! Set the maximum number of TextureTargets kept in the pool.
+    void setTextureTargetPoolCapacity(size_t capacity);
+    //! Return the maximum number of TextureTargets kept in the pool.
+    size_t getTextureTargetPoolCapacity() const { return d_textureTargetPoolCapacity; }
+
+    //! Return statistics of the TextureTarget pool.
+    const TextureTargetPoolStats& getTextureTargetPoolStats() const { return d_textureTargetPoolStats; }
+
+    //! Return \a size rounded up to the size class used to pool TextureTargets.
+    static Sizef getTextureTargetSizeClass(const Sizef& size);
+
     /*!
     \brief
         Creates a 'null' Texture object.
@@ -533,6 +596,15 @@ protected:
     */
     void addGeometryBuffer(GeometryBuffer& buffer);
 
+    /*!
+    \brief
+        Deletes all GeometryBuffers created by this Renderer, including the
+        pooled ones. This happens automatically in the Renderer destructor;
+        renderers whose GeometryBuffers refer to data members of the derived
+        class call it from their own destructor instead.
+    */
+    void deleteAllGeometryBuffers();
+
     //! The currently active RenderTarget
     RenderTarget* d_activeRenderTarget = nullptr;
 
@@ -550,6 +622,10 @@ private:
     std::set<GeometryBuffer*> d_geometryBuffers;
     //! Pool of reusable geometry buffers
     std::map<const ShaderWrapper*, std::vector<GeometryBuffer*>> d_geomeryBufferPool;
+    //! Pool of reusable texture targets, keyed by size class and stencil usage
+    std::map<std::uint32_t, std::vector<TextureTarget*>> d_textureTargetPool;
+    size_t d_textureTargetPoolCapacity = 8;
+    TextureTargetPoolStats d_textureTargetPoolStats;
     //! The Font scale factor to be used when rendering Fonts (except Bitmap Fonts).
     float d_fontScale;
 };
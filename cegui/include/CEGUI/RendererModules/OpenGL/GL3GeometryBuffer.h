@@ -29,6 +29,7 @@
 
 #include "CEGUI/RendererModules/OpenGL/GeometryBufferBase.h"
 #include "CEGUI/RefCounted.h"
+#include "CEGUI/VertexBufferArena.h"
 
 namespace CEGUI
 {
@@ -53,12 +54,21 @@ public:
 
     std::size_t d_verticesVBOPosition = 0;
 
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    //! The arena of the renderer holding the vertices, if any.
+    VertexBufferArena* d_arena = nullptr;
+    //! The part of d_arena owned by this GeometryBuffer.
+    VertexBufferArena::Allocation d_arenaAllocation;
+#endif
+
 protected:
 
     void initialiseVertexBuffers();
     void deinitialiseOpenGLBuffers();
     //! Update the OpenGL buffer objects containing the vertex data.
     void onGeometryChanged() override;
+    //! Update only the given range of vertices in the OpenGL buffer objects.
+    void onGeometryRangeChanged(size_t first_vertex, size_t vertex_count) override;
     //! Draws the vertex data depending on the fill rule that was set for this object.
     void drawDependingOnFillRule() const;
 
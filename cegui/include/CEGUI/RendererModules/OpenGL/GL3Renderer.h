@@ -28,6 +28,7 @@
 #define _CEGUIOpenGL3Renderer_h_
 
 #include "RendererBase.h"
+#include "CEGUI/VertexBufferArena.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -186,9 +187,21 @@ public:
     //! OpenGL vbo containing all vertex data
     GLuint d_verticesSolidVBO = 0;
     GLuint d_verticesTexturedVBO = 0;
-    //! Size of the vertex data buffer that is currently in use
-    GLuint d_verticesSolidVBOSize = 0;
-    GLuint d_verticesTexturedVBOSize = 0;
+
+    /*!
+    \brief
+        Return the arena that places the vertices of coloured GeometryBuffers
+        in d_verticesSolidVBO. Its statistics tell how much vertex data was
+        copied and uploaded.
+    */
+    VertexBufferArena& getSolidVertexArena() { return d_vertexArenaSolid; }
+
+    /*!
+    \brief
+        Return the arena that places the vertices of textured GeometryBuffers
+        in d_verticesTexturedVBO.
+    */
+    VertexBufferArena& getTexturedVertexArena() { return d_vertexArenaTextured; }
 #endif
 
 protected:
@@ -244,8 +257,10 @@ private:
     //! restores all relevant OpenGL States CEGUI touches to their default value
     void restoreChangedStatesToDefaults(bool isAfterRendering);
 
+#ifdef CEGUI_OPENGL_BIG_BUFFER
     void addGeometry(const std::vector<GeometryBuffer*>& buffers);
-    void uploadVertexData(std::vector<float>& vertex_data, GLuint vbo_id, GLuint& vbo_max_size);
+    void uploadVertexData(VertexBufferArena& arena, GLuint vbo_id);
+#endif
 
     //! Wrapper of the OpenGL shader we will use for textured geometry
     OpenGLBaseShaderWrapper* d_shaderWrapperTextured = nullptr;
@@ -259,8 +274,11 @@ private:
     //! pointer to a helper that creates TextureTargets supported by the system.
     OGLTextureTargetFactory* d_textureTargetFactory = nullptr;
 
-    std::vector<float> d_vertex_data_solid;
-    std::vector<float> d_vertex_data_textured;
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    //! Persistent placement of all coloured / textured vertices in the VBOs.
+    VertexBufferArena d_vertexArenaSolid{3 + 4};
+    VertexBufferArena d_vertexArenaTextured{3 + 4 + 2};
+#endif
 };
 
 }
@@ -0,0 +1,79 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareGeometryBuffer_h_
+#define _CEGUISoftwareGeometryBuffer_h_
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+
+#include <glm/glm.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of CEGUI::GeometryBuffer for the SoftwareRenderer.
+
+    Drawing transforms the vertices to pixel coordinates of the active
+    RenderTarget and records them there; they are rasterised later by the
+    SoftwareRasteriser.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareGeometryBuffer : public GeometryBuffer
+{
+public:
+    SoftwareGeometryBuffer(SoftwareRenderer& owner,
+                           CEGUI::RefCounted<RenderMaterial> renderMaterial);
+
+    // Implementation/overrides of member functions inherited from GeometryBuffer
+    void draw(std::uint32_t drawModeMask = DrawModeMaskAll) const override;
+
+protected:
+    //! update the cached model view projection matrix if required.
+    void updateMatrix() const;
+    //! transform and record the geometry into \a commands.
+    void recordCommand(SoftwareRasteriser::CommandList& commands,
+                       const SoftwareTexture* texture, int clipLeft,
+                       int clipTop, int clipRight, int clipBottom) const;
+
+    //! SoftwareRenderer that owns this buffer.
+    SoftwareRenderer& d_owner;
+    //! cached model view projection matrix.
+    mutable glm::mat4 d_matrix;
+};
+
+}
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareGeometryBuffer_h_
@@ -0,0 +1,218 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRasteriser_h_
+#define _CEGUISoftwareRasteriser_h_
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/GeometryBuffer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Tile based triangle rasteriser used by the SoftwareRenderer.
+
+    Draw calls are collected in a CommandList and rasterised in one go by
+    execute. Triangles are set up and sorted into bins of TileSize x TileSize
+    pixels first; the bins are then rendered in parallel, with each bin
+    processed by a single thread in submission order. Blending and the stencil
+    based fill rules therefore behave exactly as if the triangles were drawn
+    one after another, regardless of the number of threads.
+
+    Coverage is determined for four pixels at a time using SSE2 where
+    available (with a portable fallback). Pixels are sampled at their centre
+    and edges shared by two triangles are owned by exactly one of them, so
+    adjacent triangles never blend a pixel twice.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRasteriser
+{
+public:
+    //! Width and height of the tiles in pixels.
+    static const int TileSize = 64;
+
+    //! A vertex transformed to pixel coordinates of the RenderTarget.
+    struct Vertex
+    {
+        float x;
+        float y;
+        //! reciprocal of the clip space w, used for perspective correction.
+        float invW;
+        float colour[4];
+        float u;
+        float v;
+    };
+
+    //! A triangle of a draw call.
+    struct Triangle
+    {
+        Vertex v[3];
+    };
+
+    //! A draw call, referring to a range of triangles of its CommandList.
+    struct Command
+    {
+        //! texture to sample or nullptr for solid colour geometry.
+        const SoftwareTexture* texture;
+        BlendMode blendMode;
+        PolygonFillRule fillRule;
+        //! scissor rectangle in pixels; right and bottom are exclusive.
+        int clipLeft;
+        int clipTop;
+        int clipRight;
+        int clipBottom;
+        std::uint32_t firstTriangle;
+        //! number of leading triangles that only update the stencil.
+        std::uint32_t stencilTriangleCount;
+        std::uint32_t triangleCount;
+    };
+
+    //! Draw calls recorded for a RenderTarget.
+    struct CommandList
+    {
+        std::vector<Command> commands;
+        std::vector<Triangle> triangles;
+
+        bool empty() const { return commands.empty(); }
+        void clear() { commands.clear(); triangles.clear(); }
+    };
+
+    /*!
+    \brief
+        Constructor.
+
+    \param threadCount
+        Number of threads to use, or 0 to use one per hardware thread. The
+        calling thread is always one of them.
+    */
+    explicit SoftwareRasteriser(unsigned int threadCount);
+    ~SoftwareRasteriser();
+
+    //! Set the number of threads to use (0 for one per hardware thread).
+    void setThreadCount(unsigned int threadCount);
+
+    //! Return the number of threads used, including the calling thread.
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(d_threads.size()) + 1; }
+
+    /*!
+    \brief
+        Rasterise all draw calls of \a commands into \a target, which must not
+        be sampled by any of the draw calls.
+    */
+    void execute(const CommandList& commands, SoftwareTexture& target);
+
+private:
+    //! per-triangle data computed once before binning.
+    struct TriangleSetup
+    {
+        //! edge functions (a * x + b * y + c) for the three edges.
+        float edgeA[3];
+        float edgeB[3];
+        float edgeC[3];
+        //! whether pixels exactly on the edge are covered.
+        bool edgeInclusive[3];
+        //! interpolation planes for colour, u, v and 1/w (or 1), relative
+        //! to the origin.
+        float planeX[7];
+        float planeY[7];
+        float planeC[7];
+        float originX;
+        float originY;
+        //! bounding box in pixels, right and bottom exclusive.
+        int minX;
+        int minY;
+        int maxX;
+        int maxY;
+        //! +1 or -1 depending on the winding of the triangle.
+        int winding;
+        //! whether the attributes need to be divided by the interpolated 1/w.
+        bool perspective;
+        //! whether only the stencil is updated.
+        bool stencilOnly;
+        std::uint32_t command;
+    };
+
+    bool setupTriangle(const Command& command, const Triangle& triangle,
+                       TriangleSetup& setup) const;
+    void binTriangles();
+    void renderTiles(std::vector<std::int32_t>& stencil);
+    void renderTile(size_t tile, std::vector<std::int32_t>& stencil) const;
+    void renderTriangle(const TriangleSetup& setup, int tileX, int tileY,
+                        std::int32_t* stencil) const;
+
+    void startThreads(unsigned int threadCount);
+    void stopThreads();
+    void workerMain(std::uint64_t generation);
+
+    //! worker threads, in addition to the calling thread.
+    std::vector<std::thread> d_threads;
+    std::mutex d_mutex;
+    std::condition_variable d_workAvailable;
+    std::condition_variable d_workDone;
+    //! incremented for every execute, wakes the workers.
+    std::uint64_t d_generation;
+    //! number of workers that did not finish the current execute yet.
+    unsigned int d_busyWorkers;
+    bool d_stopping;
+
+    //! the job being executed.
+    const CommandList* d_commands;
+    SoftwareTexture* d_target;
+    int d_targetWidth;
+    int d_targetHeight;
+    int d_tilesX;
+    int d_tilesY;
+    std::vector<TriangleSetup> d_setups;
+    //! per tile, indices into d_setups.
+    std::vector<std::vector<std::uint32_t> > d_bins;
+    //! indices of tiles that have something to render.
+    std::vector<std::uint32_t> d_activeTiles;
+    //! next entry of d_activeTiles to be rendered.
+    std::atomic<size_t> d_nextTile;
+    //! stencil scratch buffer of the calling thread.
+    std::vector<std::int32_t> d_stencil;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRasteriser_h_
@@ -0,0 +1,93 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderTarget_h_
+#define _CEGUISoftwareRenderTarget_h_
+
+#include "../../RenderTarget.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "../../Rectf.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    RenderTarget for the SoftwareRenderer.
+
+    Draw calls made while the target is active are recorded and rasterised
+    into the target's pixels when the target is deactivated or flushed.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderTarget : virtual public RenderTarget
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param pixels
+        Texture holding the pixels rendered to. This may be nullptr if the
+        texture is set by a subclass.
+    */
+    SoftwareRenderTarget(SoftwareRenderer& owner, SoftwareTexture* pixels);
+    //! Destructor
+    virtual ~SoftwareRenderTarget();
+
+    //! Return the draw calls recorded and not rasterised yet.
+    SoftwareRasteriser::CommandList& getPendingCommands() { return d_commands; }
+
+    //! Rasterise all recorded draw calls.
+    void flush();
+
+    // implement parts of CEGUI::RenderTarget interface
+    void activate() override;
+    void deactivate() override;
+    void updateMatrix() const override;
+    bool isImageryCache() const override;
+    // implementing the virtual function with a covariant return type
+    SoftwareRenderer& getOwner() override;
+
+protected:
+    //! SoftwareRenderer object that owns this RenderTarget
+    SoftwareRenderer& d_owner;
+    //! texture holding the pixels rendered to.
+    SoftwareTexture* d_pixels;
+    //! draw calls recorded and not rasterised yet.
+    SoftwareRasteriser::CommandList d_commands;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderTarget_h_
@@ -0,0 +1,285 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderer_h_
+#define _CEGUISoftwareRenderer_h_
+
+#include "../../Renderer.h"
+#include "../../Sizef.h"
+#include "../../Colour.h"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <unordered_map>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUISOFTWARERENDERER_EXPORTS
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllexport)
+#   else
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllimport)
+#   endif
+#else
+#   define SOFTWARE_GUIRENDERER_API
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class SoftwareGeometryBuffer;
+class SoftwareRasteriser;
+class SoftwareRenderTarget;
+class SoftwareShaderWrapper;
+class SoftwareTexture;
+
+/*!
+\brief
+    CEGUI::Renderer implementation that rasterises everything on the CPU.
+
+    The renderer does not need a graphics API, window or display, which makes
+    it suitable for headless rendering: server side rendering of UIs,
+    golden-image tests and benchmarks that should produce identical output on
+    every machine.
+
+    Draw calls are recorded per RenderTarget and rasterised when the target is
+    deactivated (or at the end of the frame) by a SoftwareRasteriser that
+    splits the target into tiles and distributes them over a pool of worker
+    threads. Every tile is rendered by exactly one thread in submission order,
+    so the result does not depend on the number of threads used.
+
+    The default RenderTarget renders to an RGBA frame buffer of the display
+    size, which is cleared to the clear colour in beginRendering and can be
+    read back with getFrameBuffer or written to a PNG file with
+    saveFrameBuffer.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderer : public Renderer
+{
+public:
+    /*!
+    \brief
+        Convenience function that creates all the necessary objects
+        then initialises the CEGUI system with them.
+
+        This will create and initialise the following objects for you:
+        - CEGUI::SoftwareRenderer
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::System
+
+    \param displaySize
+        Size of the frame buffer rendered to by the default RenderTarget.
+
+    \param threadCount
+        Number of threads used for rasterisation, or 0 to use one per
+        hardware thread.
+
+    \param abi
+        This must be set to CEGUI_VERSION_ABI
+
+    \return
+        Reference to the CEGUI::SoftwareRenderer object that was created.
+    */
+    static SoftwareRenderer& bootstrapSystem(const Sizef& displaySize,
+                                             unsigned int threadCount = 0,
+                                             const int abi = CEGUI_VERSION_ABI);
+
+    /*!
+    \brief
+        Convenience function to cleanup the CEGUI system and related objects
+        that were created by calling the bootstrapSystem function.
+
+        This function will destroy the following objects for you:
+        - CEGUI::System
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::SoftwareRenderer
+
+    \note
+        If you did not initialise CEGUI by calling the bootstrapSystem function,
+        you should \e not call this, but rather delete any objects you created
+        manually.
+    */
+    static void destroySystem();
+
+    /*!
+    \brief
+        Create a SoftwareRenderer object.
+
+    \param displaySize
+        Size of the frame buffer rendered to by the default RenderTarget.
+
+    \param threadCount
+        Number of threads used for rasterisation, or 0 to use one per
+        hardware thread.
+    */
+    static SoftwareRenderer& create(const Sizef& displaySize,
+                                    unsigned int threadCount = 0,
+                                    const int abi = CEGUI_VERSION_ABI);
+
+    //! destroy a SoftwareRenderer object.
+    static void destroy(SoftwareRenderer& renderer);
+
+    /*!
+    \brief
+        Set the number of threads used for rasterisation. 0 uses one thread
+        per hardware thread and 1 rasterises on the calling thread only.
+    */
+    void setThreadCount(unsigned int threadCount);
+
+    //! Return the number of threads used for rasterisation.
+    unsigned int getThreadCount() const;
+
+    //! Set the colour the frame buffer is cleared to in beginRendering.
+    void setClearColour(const Colour& colour) { d_clearColour = colour; }
+
+    //! Return the colour the frame buffer is cleared to in beginRendering.
+    const Colour& getClearColour() const { return d_clearColour; }
+
+    /*!
+    \brief
+        Return the texture holding the frame buffer rendered to by the default
+        RenderTarget. Pending draw calls are rasterised first.
+    */
+    const SoftwareTexture& getFrameBuffer();
+
+    /*!
+    \brief
+        Write the frame buffer rendered to by the default RenderTarget to a
+        PNG file. Pending draw calls are rasterised first.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void saveFrameBuffer(const String& filename);
+
+    /*!
+    \brief
+        Rasterise the draw calls that were recorded for all RenderTargets of
+        this renderer and not rasterised yet. This is done automatically when
+        a RenderTarget is deactivated, at the end of the frame and before the
+        pixels of a texture are changed or read back.
+    */
+    void flushRendering();
+
+    //! Return the rasteriser shared by all RenderTargets of this renderer.
+    SoftwareRasteriser& getRasteriser() { return *d_rasteriser; }
+
+    //! Set the RenderTarget that draw calls are recorded for.
+    void setActiveSoftwareRenderTarget(SoftwareRenderTarget* target) { d_activeSoftwareTarget = target; }
+
+    //! Return the RenderTarget that draw calls are recorded for.
+    SoftwareRenderTarget* getActiveSoftwareRenderTarget() const { return d_activeSoftwareTarget; }
+
+    //! Set the view projection matrix of the active RenderTarget.
+    void setViewProjectionMatrix(const glm::mat4& matrix) { d_viewProjectionMatrix = matrix; }
+
+    //! Return the view projection matrix of the active RenderTarget.
+    const glm::mat4& getViewProjectionMatrix() const { return d_viewProjectionMatrix; }
+
+    // implement CEGUI::Renderer interface
+    RenderTarget& getDefaultRenderTarget() override;
+    RefCounted<RenderMaterial> createRenderMaterial(const DefaultShaderType shaderType) const override;
+    GeometryBuffer& createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial) override;
+    GeometryBuffer& createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial) override;
+    TextureTarget* createTextureTarget(bool addStencilBuffer) override;
+    void destroyTextureTarget(TextureTarget* target) override;
+    void destroyAllTextureTargets() override;
+    Texture& createTexture(const String& name) override;
+    Texture& createTexture(const String& name,
+                           const String& filename,
+                           const String& resourceGroup) override;
+    Texture& createTexture(const String& name, const Sizef& size) override;
+    void destroyTexture(Texture& texture) override;
+    void destroyTexture(const String& name) override;
+    void destroyAllTextures() override;
+    Texture& getTexture(const String& name) const override;
+    bool isTextureDefined(const String& name) const override;
+    void beginRendering() override;
+    void endRendering() override;
+    void setDisplaySize(const Sizef& sz) override;
+    const Sizef& getDisplaySize() const override;
+    unsigned int getMaxTextureSize() const override;
+    const String& getIdentifierString() const override;
+    bool isTexCoordSystemFlipped() const override;
+
+protected:
+    //! constructor.
+    SoftwareRenderer(const Sizef& displaySize, unsigned int threadCount);
+    //! destructor.
+    virtual ~SoftwareRenderer();
+
+    //! helper to throw exception if name is already used.
+    void throwIfNameExists(const String& name) const;
+    //! helper to safely log the creation of a named texture
+    static void logTextureCreation(const String& name);
+    //! helper to safely log the destruction of a named texture
+    static void logTextureDestruction(const String& name);
+
+    //! String holding the renderer identification text.
+    static String d_rendererID;
+    //! What the renderer considers to be the current display size.
+    Sizef d_displaySize;
+    //! Colour the frame buffer is cleared to in beginRendering.
+    Colour d_clearColour;
+    //! Pixels of the default RenderTarget.
+    SoftwareTexture* d_frameBuffer;
+    //! The default RenderTarget
+    SoftwareRenderTarget* d_defaultTarget;
+    //! RenderTarget that draw calls are currently recorded for.
+    SoftwareRenderTarget* d_activeSoftwareTarget;
+    //! view projection matrix of the active RenderTarget.
+    glm::mat4 d_viewProjectionMatrix;
+    //! Rasteriser shared by all RenderTargets.
+    SoftwareRasteriser* d_rasteriser;
+    //! container type used to hold TextureTargets we create.
+    typedef std::vector<TextureTarget*> TextureTargetList;
+    //! Container used to track texture targets.
+    TextureTargetList d_textureTargets;
+    //! container type used to hold Textures we create.
+    typedef std::unordered_map<String, SoftwareTexture*> TextureMap;
+    //! Container used to track textures.
+    TextureMap d_textures;
+    //! What the renderer thinks the max texture size is.
+    unsigned int d_maxTextureSize;
+
+    //! Shaderwrapper for textured & coloured vertices
+    SoftwareShaderWrapper* d_shaderWrapperTextured;
+    //! Shaderwrapper for coloured vertices
+    SoftwareShaderWrapper* d_shaderWrapperSolid;
+};
+
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderer_h_
@@ -0,0 +1,181 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareTexture_h_
+#define _CEGUISoftwareTexture_h_
+
+#include "../../Texture.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of the CEGUI::Texture class for the SoftwareRenderer.
+
+    Pixels are kept in memory as 8 bit RGBA, top row first, regardless of the
+    format they were loaded from. blitFromMemory expects data in the format
+    the texture was loaded with, while blitToMemory always writes RGBA.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareTexture : public Texture
+{
+public:
+    // implement CEGUI::Texture interface
+    const String& getName() const override;
+    const Sizef& getSize() const override;
+    const Sizef& getOriginalDataSize() const override;
+    const glm::vec2& getTexelScaling() const override;
+    void loadFromFile(const String& filename, const String& resourceGroup) override;
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                                PixelFormat pixel_format) override;
+    void blitFromMemory(const void* sourceData, const Rectf& area) override;
+    void blitToMemory(void* targetData) override;
+    bool isPixelFormatSupported(const PixelFormat fmt) const override;
+
+    //! Return the width of the pixel data.
+    int getPixelWidth() const { return d_width; }
+
+    //! Return the height of the pixel data.
+    int getPixelHeight() const { return d_height; }
+
+    //! Return the RGBA pixel data, top row first.
+    const std::uint8_t* getPixels() const { return d_pixels.data(); }
+
+    //! Return the RGBA pixel data, top row first.
+    std::uint8_t* getPixels() { return d_pixels.data(); }
+
+    /*!
+    \brief
+        Resize the pixel data to \a sz, discarding its contents and setting all
+        pixels to transparent black.
+    */
+    void resize(const Sizef& sz);
+
+    //! Set all pixels to \a colour.
+    void clear(const Colour& colour);
+
+    /*!
+    \brief
+        Write the pixel data to a PNG file.
+
+    \exception FileIOException
+        thrown if the file could not be written.
+    */
+    void saveToPNG(const String& filename) const;
+
+    /*!
+    \brief
+        Sample the texture at texture coordinates \a u, \a v using bilinear
+        filtering and clamping to the edges, writing the RGBA result (in the
+        range 0 to 1) to \a rgba.
+    */
+    void sample(float u, float v, float* rgba) const
+    {
+        const float x = u * d_width - 0.5f;
+        const float y = v * d_height - 0.5f;
+        const float fx = std::floor(x);
+        const float fy = std::floor(y);
+        const float wx = x - fx;
+        const float wy = y - fy;
+
+        const int x0 = clampCoord(static_cast<int>(fx), d_width);
+        const int x1 = clampCoord(static_cast<int>(fx) + 1, d_width);
+        const int y0 = clampCoord(static_cast<int>(fy), d_height);
+        const int y1 = clampCoord(static_cast<int>(fy) + 1, d_height);
+
+        const std::uint8_t* p00 = &d_pixels[(y0 * d_width + x0) * 4];
+        const std::uint8_t* p10 = &d_pixels[(y0 * d_width + x1) * 4];
+        const std::uint8_t* p01 = &d_pixels[(y1 * d_width + x0) * 4];
+        const std::uint8_t* p11 = &d_pixels[(y1 * d_width + x1) * 4];
+
+        const float w00 = (1.0f - wx) * (1.0f - wy) * (1.0f / 255.0f);
+        const float w10 = wx * (1.0f - wy) * (1.0f / 255.0f);
+        const float w01 = (1.0f - wx) * wy * (1.0f / 255.0f);
+        const float w11 = wx * wy * (1.0f / 255.0f);
+
+        for (int i = 0; i < 4; ++i)
+            rgba[i] = p00[i] * w00 + p10[i] * w10 + p01[i] * w01 + p11[i] * w11;
+    }
+
+    //! Return whether the texture has any pixels that can be sampled.
+    bool hasPixels() const { return d_width > 0 && d_height > 0; }
+
+protected:
+    // we all need a little help from out friends ;)
+    friend class SoftwareRenderer;
+
+    //! standard constructor
+    SoftwareTexture(SoftwareRenderer& owner, const String& name);
+    //! construct texture via an image file.
+    SoftwareTexture(SoftwareRenderer& owner, const String& name,
+                    const String& filename, const String& resourceGroup);
+    //! construct texture with a specified initial size.
+    SoftwareTexture(SoftwareRenderer& owner, const String& name,
+                    const Sizef& sz);
+    //! destructor.
+    virtual ~SoftwareTexture();
+
+    static int clampCoord(int value, int size)
+    {
+        return value < 0 ? 0 : (value >= size ? size - 1 : value);
+    }
+
+    //! SoftwareRenderer that created this texture.
+    SoftwareRenderer& d_owner;
+    //! Size of the texture.
+    Sizef d_size;
+    //! original pixel of size data loaded into texture
+    Sizef d_dataSize;
+    //! cached pixel to texel mapping scale values.
+    glm::vec2 d_texelScaling;
+    //! Name this texture was created with.
+    const String d_name;
+    //! size of the pixel data.
+    int d_width;
+    int d_height;
+    //! format of the data passed to loadFromMemory and blitFromMemory.
+    PixelFormat d_format;
+    //! RGBA pixel data, top row first.
+    std::vector<std::uint8_t> d_pixels;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareTexture_h_
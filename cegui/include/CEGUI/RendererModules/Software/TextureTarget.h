@@ -0,0 +1,73 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareTextureTarget_h_
+#define _CEGUISoftwareTextureTarget_h_
+
+#include "../../TextureTarget.h"
+#include "CEGUI/RendererModules/Software/RenderTarget.h"
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4250)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! CEGUI::TextureTarget implementation for the SoftwareRenderer.
+class SOFTWARE_GUIRENDERER_API SoftwareTextureTarget : public SoftwareRenderTarget, public TextureTarget
+{
+public:
+    //! Constructor.
+    SoftwareTextureTarget(SoftwareRenderer& owner, bool addStencilBuffer);
+
+    //! Destructor.
+    virtual ~SoftwareTextureTarget();
+
+    // implementation of RenderTarget interface
+    bool isImageryCache() const override;
+    // implement CEGUI::TextureTarget interface.
+    void clear() override;
+    Texture& getTexture() const override;
+    void declareRenderSize(const Sizef& sz) override;
+
+protected:
+    //! helper to generate unique texture names
+    static String generateTextureName();
+    //! static data used for creating texture names
+    static std::uint32_t s_textureNumber;
+    //! default / initial size for the underlying texture.
+    static const float DEFAULT_SIZE;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareTextureTarget_h_
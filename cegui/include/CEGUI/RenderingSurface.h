@@ -193,6 +193,22 @@ public:
     void addGeometryBuffer(const RenderQueueID queue,
                            GeometryBuffer& geometry_buffer);
 
+    /*!
+    \brief
+        Add a list of GeometryBuffers to the specified queue by reference; see
+        RenderQueue::addGeometryBufferList.
+
+    \param queue
+        One of the RenderQueueID enumerated values indicating which prioritised
+        queue the GeometryBuffers should be added to.
+
+    \param geometry_buffers
+        List of GeometryBuffers that will be drawn with its content at the
+        time the RenderingSurface is drawn.
+    */
+    void addGeometryBufferList(const RenderQueueID queue,
+                               const std::vector<GeometryBuffer*>& geometry_buffers);
+
     /*!
     \brief
         Remove the specified GeometryBuffer from the specified queue.
@@ -189,7 +189,11 @@ public:
 
     /*!
     \brief
-        Unload all XML based imagesets created by the scheme.
+        Unload all XML based imagesets created by the scheme, see
+        ImageManager::unloadImageset.
+
+        unloadResources does not call this, since windows may still use the
+        images. Call it once no window uses them any more.
     */
     void unloadXMLImagesets();
 
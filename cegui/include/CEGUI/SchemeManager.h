@@ -199,6 +199,31 @@ public:
     */
     bool getAutoLoadResources() const;
 
+    /*!
+    \brief
+        Set whether the resources of Schemes are prepared on worker threads
+        when they are loaded automatically after creation.
+
+        When enabled, image files are decoded and, if the XMLBinaryCache is
+        enabled, XML files are parsed by a ParallelResourceLoader before the
+        resources are created on the calling thread, in the same order and
+        with the same result as when loading sequentially. This requires an
+        ImageCodec that may be used from several threads at once; with an
+        XMLParser that may not (see XMLParser::isThreadSafe) resources are
+        loaded sequentially. This is disabled by default.
+
+    \see ParallelResourceLoader
+    */
+    void setParallelLoadingEnabled(bool enabled);
+
+    /*!
+    \brief
+        Return whether the resources of Schemes are prepared on worker threads.
+
+    \see SchemeManager::setParallelLoadingEnabled
+    */
+    bool isParallelLoadingEnabled() const;
+
 protected:
     //! implementation of object destruction.
     void destroyObject(SchemeRegistry::iterator ob);
@@ -219,6 +244,8 @@ protected:
 
     //! If true, Scheme::loadResources is called after "create" is called for it
     bool d_autoLoadResources;
+    //! If true, resources are prepared by a ParallelResourceLoader.
+    bool d_parallelLoading;
 };
 
 } // End of  CEGUI namespace section
@@ -30,6 +30,7 @@
 #define _CEGUILuaFunctor_h_
 
 #include "CEGUI/EventSet.h"
+#include <memory>
 
 struct lua_State;
 
@@ -39,6 +40,20 @@ namespace CEGUI
 
 // forward declaration
 class LuaScriptModule;
+class LuaFunctor;
+
+/*!
+\brief
+    A call of a batched Lua event handler that is waiting for
+    LuaScriptModule::flushBatchedEvents.
+*/
+struct LuaBatchedCall
+{
+    //! functor to invoke, or 0 if it was destroyed in the mean time.
+    const LuaFunctor* d_functor;
+    //! copy of the most recent arguments the event was fired with.
+    std::unique_ptr<EventArgs> d_args;
+};
 
 /*!
 \brief
@@ -62,8 +77,16 @@ public:
     LuaFunctor(const LuaFunctor& cp);
     ~LuaFunctor();
 
+    /*!
+    \brief
+        Invoke the Lua handler, or queue it if the functor is batched (see
+        LuaScriptModule::setEventBatched).
+    */
     bool operator()(const EventArgs& args) const;
 
+    //! Invoke the Lua handler with \a args right away.
+    bool invoke(const EventArgs& args) const;
+
     /*!
     \brief
         function used to subscribe any Lua function as event handler.
@@ -93,6 +116,17 @@ private:
     */
     void invalidateLuaRefs();
 
+    /*!
+    \brief
+        Resolve everything needed to call the handler: bind the named error
+        handler and late bound function, and create the userdata used to pass
+        EventArgs. Done once, on the first call.
+    */
+    void prepare() const;
+
+    //! Make the functor batched if handlers of \a eventName should be.
+    void initBatching(const String& eventName);
+
     lua_State* L;
     mutable int index;
     int self;
@@ -106,6 +140,17 @@ private:
     //! signfies whether we made the reference index at d_errFuncIndex.
     mutable bool d_ourErrFuncIndex;
 
+    //! whether prepare has been done.
+    mutable bool d_prepared;
+    /** registry index of the userdata that is reused for passing the EventArgs
+        to the handler, rather than having tolua++ box every EventArgs anew.
+    */
+    mutable int d_argsRef;
+    //! whether calls are queued until LuaScriptModule::flushBatchedEvents.
+    bool d_batched;
+    //! queued call for this functor, if there is one.
+    mutable LuaBatchedCall* d_batchedCall;
+
     friend class LuaScriptModule;
 };
 
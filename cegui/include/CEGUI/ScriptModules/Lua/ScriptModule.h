@@ -45,6 +45,9 @@
 
 
 #include "CEGUI/ScriptModule.h"
+#include "CEGUI/ScriptModules/Lua/Functor.h"
+#include <deque>
+#include <unordered_set>
 
 struct lua_State;
 
@@ -479,6 +482,64 @@ public:
                                      const String& subscriber_name,
                                      const int error_handler);
 
+    /*************************************************************************
+        Event batching
+    *************************************************************************/
+    /*!
+    \brief
+        Set whether Lua handlers that are subscribed to events named
+        \a event_name from now on are batched.
+
+        A batched handler is not invoked when the event fires. Instead the
+        call is queued, and made by the next call to flushBatchedEvents, with
+        a copy of the most recent arguments the event was fired with (for
+        CursorMoveEventArgs, the move deltas are accumulated). However often
+        the event fired, the handler runs at most once per flush. This is meant
+        for high frequency events such as Window::EventCursorMove or
+        Window::EventUpdated.
+
+        The value returned by a batched handler is ignored: the event is not
+        marked as handled by it, so it keeps propagating (for example to parent
+        windows) as if the handler was not subscribed. Only batch events whose
+        handlers do not need to stop that. Events with argument types that can
+        not be copied (anything other than EventArgs, WindowEventArgs,
+        UpdateEventArgs, CursorInputEventArgs and CursorMoveEventArgs) are
+        still handled right away. Queued calls whose arguments refer to a
+        window are dropped when that window is destroyed.
+
+    \param event_name
+        Name of the event, for example "CursorMove".
+
+    \param batched
+        true to batch handlers subscribed to \a event_name, false to invoke
+        them right away (the default).
+    */
+    void setEventBatched(const String& event_name, bool batched);
+
+    //! Return whether Lua handlers subscribed to \a event_name are batched.
+    bool isEventBatched(const String& event_name) const;
+
+    /*!
+    \brief
+        Invoke all queued batched handlers. This should be called once per
+        frame, for example right after System::injectTimePulse.
+
+        Errors raised by the handlers are logged and do not stop the remaining
+        handlers from being called. Handlers queued while flushing are called
+        by the next flush.
+    */
+    void flushBatchedEvents();
+
+    /*!
+    \brief
+        Queue a call of the batched \a functor. Returns false if \a args can
+        not be copied and the functor should be invoked right away.
+
+    \note
+        This function is intended for use internally by LuaFunctor.
+    */
+    bool queueBatchedCall(const LuaFunctor& functor, const EventArgs& args);
+
     /*************************************************************************
         Bindings creation / destruction
     *************************************************************************/
@@ -647,6 +708,9 @@ private:
     //! Implementation function that executes script contained in a String.
     void executeString_impl(const String& str, const int err_idx, const int top);
 
+    //! Drop queued batched calls whose arguments refer to a destroyed window.
+    bool handleWindowDestroyed(const EventArgs& e);
+
     /*************************************************************************
         Implementation Data
     *************************************************************************/
@@ -666,6 +730,13 @@ private:
         call to initErrorHandlerFunc)
     */
     int d_activeErrFuncIndex;
+
+    //! names of events whose handlers are batched.
+    std::unordered_set<String> d_batchedEvents;
+    //! queued calls of batched handlers; a deque keeps them at a fixed address.
+    std::deque<LuaBatchedCall> d_batchedCalls;
+    //! subscription to WindowManager::EventWindowDestroyed, made on first use.
+    Event::Connection d_windowDestroyedConnection;
 };
 
 } // namespace CEGUI
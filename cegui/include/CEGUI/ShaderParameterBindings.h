@@ -274,6 +274,18 @@ public:
 
     const std::map<std::string, ShaderParameter*>& getShaderParameterBindings() const { return d_shaderParameterBindings; }
 
+    /*!
+    \brief
+        Makes these bindings hold the same parameters with the same values as
+        \a other. Parameters that exist in both with the same type keep their
+        objects and only take over differing values, so pointers to them stay
+        valid. Parameters that \a other does not have are removed.
+
+    \param other
+        The ShaderParameterBindings to copy the parameters from
+    */
+    void copyFrom(const ShaderParameterBindings& other);
+
 protected:
 
     /*!
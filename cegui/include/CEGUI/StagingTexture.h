@@ -0,0 +1,93 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIStagingTexture_h_
+#define _CEGUIStagingTexture_h_
+
+#include "CEGUI/Texture.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Sizef.h"
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    Texture that just keeps the pixel data an ImageCodec loads into it, so
+    that images can be decoded into memory without involving the Renderer.
+
+    This is not a Renderer texture and can't be used for rendering; only
+    loadFromMemory is supported.
+*/
+class CEGUIEXPORT StagingTexture : public Texture
+{
+public:
+    StagingTexture();
+
+    //! Return the size in bytes of pixel data of the given size and format.
+    static size_t calculateDataSize(const Sizef& size, PixelFormat format);
+
+    //! Return the pixel data that was loaded.
+    std::vector<std::uint8_t>& getPixelData() { return d_pixels; }
+    //! Return the pixel data that was loaded.
+    const std::vector<std::uint8_t>& getPixelData() const { return d_pixels; }
+    //! Return the format of the pixel data that was loaded.
+    PixelFormat getPixelFormat() const { return d_format; }
+
+    // Implement Texture interface
+    const String& getName() const override { return d_name; }
+    const Sizef& getSize() const override { return d_size; }
+    const Sizef& getOriginalDataSize() const override { return d_size; }
+    const glm::vec2& getTexelScaling() const override { return d_texelScaling; }
+    void loadFromFile(const String& filename, const String& resourceGroup) override;
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format) override;
+    void blitFromMemory(const void* sourceData, const Rectf& area) override;
+    void blitToMemory(void* targetData) override;
+    //! Any format is accepted, it must be checked when the data is used.
+    bool isPixelFormatSupported(const PixelFormat format) const override;
+
+private:
+    std::vector<std::uint8_t> d_pixels;
+    Sizef d_size;
+    glm::vec2 d_texelScaling;
+    PixelFormat d_format;
+    String d_name;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIStagingTexture_h_
@@ -31,6 +31,8 @@
 
 #include "CEGUI/Singleton.h"
 #include "CEGUI/EventSet.h"
+#include "CEGUI/MemoryTracker.h"
+#include <array>
 #include <vector>
 
 #if defined(__WIN32__) || defined(_WIN32)
@@ -48,6 +50,7 @@ namespace CEGUI
 {
 class TextParser;
 class LegacyTextParser;
+class XMLBinaryCache;
 
 /*!
 \brief
@@ -219,6 +222,8 @@ public:
         Depending upon the internal state, for each GUIContext this may either
         re-use cached rendering from last time or trigger a full re-draw of all
         elements.
+
+        This also ends the current frame of the FrameProfiler.
     */
     void renderAllGUIContexts();
 
@@ -341,6 +346,15 @@ public:
      */
     XMLParser* getXMLParser(void) const     { return d_xmlParser; }
 
+    /*!
+    \brief
+        Return the cache of compiled XML resources.
+
+        The cache is disabled until a cache directory is set on it, see
+        XMLBinaryCache::setCacheDirectory.
+    */
+    XMLBinaryCache& getXMLBinaryCache() const   { return *d_xmlBinaryCache; }
+
 
     /*!
     \brief
@@ -423,6 +437,17 @@ public:
     */
     void setImageCodec(ImageCodec& codec);
 
+    /*!
+    \brief
+        Temporarily route image loading through \a codec.
+
+        Unlike setImageCodec, the current image codec is kept (and not
+        released) while the override is active, so \a codec may delegate to
+        it. Pass nullptr to remove the override. The system does not take
+        ownership of \a codec.
+    */
+    void setImageCodecOverride(ImageCodec* codec);
+
     /*!
     \brief
         Set the name of the default image codec to be used.
@@ -520,6 +545,47 @@ public:
     */
     void invalidateAllCachedRendering();
 
+    /*!
+    \brief
+        Return the memory currently used by the subsystem identified by \a tag.
+
+        Memory is only counted when CEGUI is built with the
+        CEGUI_TRACK_ALLOCATIONS option (see MemoryTracker::isEnabled); in other
+        builds all statistics are zero.
+    */
+    MemoryStatistics getMemoryStatistics(MemoryTag tag) const;
+
+    /*!
+    \brief
+        Set the number of bytes the subsystem identified by \a tag is allowed
+        to use at its peak, or 0 for no limit. Budgets are only checked by
+        isMemoryBudgetExceeded and reported by logMemoryStatistics, exceeding
+        them has no other effect.
+    */
+    void setMemoryBudget(MemoryTag tag, size_t bytes);
+
+    //! Return the budget set for \a tag by setMemoryBudget.
+    size_t getMemoryBudget(MemoryTag tag) const;
+
+    /*!
+    \brief
+        Return whether the peak memory use of any subsystem exceeds its
+        budget. Peaks are counted since start up or the last call to
+        resetMemoryPeaks, so that a test can check the budgets of a
+        particular workload.
+    */
+    bool isMemoryBudgetExceeded() const;
+
+    //! Set the peak memory use of every subsystem to its current use.
+    void resetMemoryPeaks();
+
+    /*!
+    \brief
+        Write the memory statistics and budgets of all subsystems to the log.
+        Subsystems over budget are reported as errors.
+    */
+    void logMemoryStatistics() const;
+
     //! call this to ensure system-level time based updates occur.
     bool injectTimePulse(float timeElapsed);
 
@@ -642,16 +708,24 @@ protected:
      *  are not owner of the image codec object
      */
     DynamicModule* d_imageCodecModule;
+    //! Image codec used instead of d_imageCodec when set.
+    ImageCodec* d_imageCodecOverride;
     //! Holds the name of the default codec to use.
     static String d_defaultImageCodecName;
     //! true when we created the CEGUI::Logger based object.
     bool d_ourLogger;
 
+    //! Cache of compiled XML resources used by XMLParser::parseXMLFile.
+    std::unique_ptr<XMLBinaryCache> d_xmlBinaryCache;
+
     //! Shared instance of a parser to be used in CEGUI by default.
     std::unique_ptr<LegacyTextParser> d_fallbackTextParser;
     //! Currently set global text parser.
     TextParser* d_defaultTextParser = nullptr;
 
+    //! Peak memory budgets in bytes, indexed by MemoryTag; 0 for no limit.
+    std::array<size_t, static_cast<size_t>(MemoryTag::Count)> d_memoryBudgets {};
+
     String d_defaultFontName;
     String d_defaultCursorName;
     String d_defaultTooltipType;
@@ -0,0 +1,201 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIVertexBufferArena_h_
+#define _CEGUIVertexBufferArena_h_
+
+#include "CEGUI/Base.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+/*!
+\brief
+    CPU side bookkeeping for renderers that keep the vertices of many
+    GeometryBuffers in one big vertex buffer.
+
+    Every GeometryBuffer owns an Allocation: a range of the arena that stays
+    at the same place for as long as the vertex count of the buffer fits into
+    it. A shadow copy of the whole arena is kept in memory so that the GPU
+    buffer can be recreated when the arena grows. Buffers mark the vertices
+    they change as dirty, and update copies only those into the shadow copy
+    and records them as ranges to upload; the renderer then uploads the
+    (coalesced) ranges returned by getUploadRanges. A frame in which no
+    geometry changed therefore copies and uploads nothing.
+
+    The arena does not talk to any graphics API itself.
+*/
+class CEGUIEXPORT VertexBufferArena
+{
+public:
+    //! Range of vertices in the arena owned by one GeometryBuffer.
+    class Allocation
+    {
+    public:
+        //! Return whether the Allocation currently owns space in an arena.
+        bool isValid() const { return d_capacity != 0; }
+        //! Return the index of the first vertex of the Allocation in the arena.
+        size_t getFirstVertex() const { return d_firstVertex; }
+        //! Return the number of vertices the Allocation can hold.
+        size_t getCapacity() const { return d_capacity; }
+
+        //! Mark the given range of vertices as changed.
+        void markDirty(size_t firstVertex, size_t vertexCount)
+        {
+            d_dirtyBegin = std::min(d_dirtyBegin, firstVertex);
+            d_dirtyEnd = std::max(d_dirtyEnd, firstVertex + vertexCount);
+        }
+
+        //! Mark all vertices as changed.
+        void markAllDirty()
+        {
+            d_dirtyBegin = 0;
+            d_dirtyEnd = std::numeric_limits<size_t>::max();
+        }
+
+        //! Return whether any vertices were marked as changed.
+        bool isDirty() const { return d_dirtyBegin < d_dirtyEnd; }
+
+    private:
+        friend class VertexBufferArena;
+
+        size_t d_firstVertex = 0;
+        size_t d_capacity = 0;
+        size_t d_dirtyBegin = 0;
+        size_t d_dirtyEnd = std::numeric_limits<size_t>::max();
+    };
+
+    //! Counters describing the work done by update since the last reset.
+    struct Statistics
+    {
+        //! Number of bytes copied into the shadow copy.
+        size_t bytesCopied = 0;
+        //! Number of bytes in the ranges returned by getUploadRanges.
+        size_t bytesUploaded = 0;
+        //! Number of ranges returned by getUploadRanges.
+        size_t uploadRanges = 0;
+        //! Number of times the arena grew, requiring a full upload.
+        size_t growths = 0;
+    };
+
+    /*!
+    \brief
+        Dirty ranges closer than this many floats are uploaded as one range,
+        trading a few redundant bytes for fewer upload calls.
+    */
+    static const size_t UploadMergeDistance;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param floatsPerVertex
+        Number of floats used by each vertex stored in this arena.
+    */
+    explicit VertexBufferArena(size_t floatsPerVertex);
+
+    //! Return the number of floats used by each vertex.
+    size_t getFloatsPerVertex() const { return d_floatsPerVertex; }
+
+    /*!
+    \brief
+        Bring the part of the arena owned by \a allocation up to date with
+        the \a floatCount floats at \a vertexData.
+
+        If the allocation is too small for the data it is moved elsewhere in
+        the arena (which may grow) and all of its vertices are copied;
+        otherwise only the vertices marked as dirty are copied. The dirty
+        range of the allocation is cleared afterwards.
+
+    \return
+        true if \a floatCount is not zero, in which case it can be drawn from
+        Allocation::getFirstVertex in the arena.
+    */
+    bool update(Allocation& allocation, const float* vertexData, size_t floatCount);
+
+    //! Release the space owned by \a allocation.
+    void release(Allocation& allocation);
+
+    //! Return the shadow copy of the arena.
+    const std::vector<float>& getData() const { return d_data; }
+
+    /*!
+    \brief
+        Return whether the arena grew (or was never uploaded) since the last
+        call to clearUploadRanges, in which case the whole of getData must be
+        uploaded instead of the individual ranges.
+    */
+    bool isFullUploadNeeded() const { return d_fullUploadNeeded; }
+
+    /*!
+    \brief
+        Return the sorted and coalesced ranges of floats, as pairs of offset
+        and count, that changed since the last call to clearUploadRanges.
+    */
+    const std::vector<std::pair<size_t, size_t> >& getUploadRanges();
+
+    //! Forget the ranges to upload, after the renderer uploaded them.
+    void clearUploadRanges();
+
+    //! Return the statistics collected since the last resetStatistics.
+    const Statistics& getStatistics() const { return d_statistics; }
+    //! Reset the statistics to zero.
+    void resetStatistics() { d_statistics = Statistics(); }
+
+private:
+    void allocate(Allocation& allocation, size_t vertexCount);
+    void grow(size_t minimumVertexCount);
+
+    size_t d_floatsPerVertex;
+    //! shadow copy of the vertex data in the arena.
+    std::vector<float> d_data;
+    //! free ranges of vertices, keyed by first vertex.
+    std::map<size_t, size_t> d_freeRanges;
+    //! changed ranges of floats, not yet sorted or coalesced.
+    std::vector<std::pair<size_t, size_t> > d_uploadRanges;
+    bool d_uploadRangesCoalesced;
+    bool d_fullUploadNeeded;
+    Statistics d_statistics;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIVertexBufferArena_h_
@@ -31,6 +31,7 @@
 
 #include "CEGUI/Element.h"
 #include "CEGUI/InputEvent.h"
+#include <unordered_map>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -705,8 +706,14 @@ public:
     \return
         Pointer to the Window object referenced by \a name_path.
         If no child is found with the name \a name, 0 is returned.
+
+    \note
+        Each window keeps an index of its children by name, so the cost of
+        this function depends only on the number of segments in \a name_path,
+        and no memory is allocated. Code that resolves the same path
+        repeatedly can use a ChildHandle to skip even that.
     */
-    Window* findChild(const String& name_path) const { return findChildByNamePath_impl(name_path); }
+    Window* findChild(const String& name_path) const;
 
     /*!
     \brief
@@ -717,9 +724,10 @@ public:
         not throw an exception, but return 0 in case no child was found.
 
     \note
-        WARNING! This function can be very expensive and should only be used
-        when you have no other option available. If you decide to use it anyway,
-        make sure the window hierarchy from the entry point is small.
+        WARNING! This function visits every window below this one in the
+        worst case and should only be used when you have no other option
+        available. If you decide to use it anyway, make sure the window
+        hierarchy from the entry point is small.
 
     \param name
         String object holding the name of the window to return a pointer to.
@@ -731,6 +739,16 @@ public:
     */
     Window* getChildRecursive(const String& name) const;
 
+    /*!
+    \brief
+        Return a number that changes whenever a window is attached to or
+        detached from any other window, renamed or destroyed.
+
+        This allows the result of a child lookup to be cached and reused for as
+        long as the number stays the same. See ChildHandle.
+    */
+    static std::uint64_t getHierarchyVersion() { return s_hierarchyVersion; }
+
     /*!
     \brief Checks whether given name path references a Window that is attached to this Element.
 
@@ -2311,6 +2329,9 @@ public:
         different RenderingSurface to the Window, the existing automatically
         created RenderingSurface will be released and this setting will be
         disabled.
+    \par
+        Calling this function takes the setting over from GUIContext automatic
+        caching, which will not disable a RenderingSurface enabled here.
 
     \param setting
         - true to enable automatic use of an imagery caching RenderingSurface.
@@ -2586,6 +2607,7 @@ protected:
     // friend classes for construction / initialisation purposes (for now)
     friend class WindowManager; // FIXME for d_falagardType only
     friend class GUIContext;
+    friend class ParallelGeometryGenerator;
 
     /*************************************************************************
         Event trigger methods
@@ -3051,6 +3073,12 @@ protected:
         Perform drawing operations concerned with generating and buffering
         window geometry.
 
+        When the window already has geometry buffers and is attached to a
+        GUIContext, the new geometry is recorded on the CPU only (see
+        GeometryRecorder). If it has the same layout it is copied into the
+        existing buffers with GeometryBuffer::updateFrom, which uploads just
+        the vertices that changed; otherwise the buffers are replaced.
+
     \note
         This function is a sub-function of drawSelf; it is provided to make it
         easier to override drawSelf without needing to duplicate large sections
@@ -3115,6 +3143,40 @@ protected:
     //! \brief Cleanup child windows
     virtual void cleanupChildren();
 
+    //! Property values of a newly created window and its auto windows.
+    struct InitialState
+    {
+        std::vector<std::pair<Property*, String> > d_properties;
+        std::map<String, String> d_userStrings;
+        std::vector<std::pair<String, InitialState> > d_autoWindows;
+    };
+
+    //! Record the current state of the window as \a state.
+    void captureInitialState(InitialState& state) const;
+
+    /*!
+    \brief
+        Return the window to the state \a state captured from a new window of
+        the same type, so that WindowManager can reuse it rather than create
+        another window.
+
+        The window is detached, its children other than auto windows (also
+        those added to its auto windows) are destroyed, and for the window and
+        its auto windows all properties are
+        set back to their initial values, user strings and user data are reset
+        and all event subscriptions made after \a subscriptionSequence are
+        removed.
+    */
+    void resetForReuse(const InitialState& state,
+                       std::uint64_t subscriptionSequence);
+
+    //! helper for resetForReuse, removes children that are not auto windows.
+    void cleanupAddedChildren();
+
+    //! helper for resetForReuse, applied to the window and its auto windows.
+    void restoreInitialState(const InitialState& state,
+                             std::uint64_t subscriptionSequence);
+
     //! \copydoc Element::addChild_impl
     void addChild_impl(Element* element) override;
 
@@ -3178,9 +3240,29 @@ protected:
     //! handler function for when font render size changes.
     virtual bool handleFontRenderSizeChange(const Font& font);
 
-    // FIXME: this is needed only for very dirty HACK!
-    //! \brief Retrieves a child at \a name_path or 0 if none such exists
-    virtual Window* findChildByNamePath_impl(const String& name_path) const;
+    /*!
+    \brief
+        Return the window whose children are searched for the segment of a
+        name path that starts at \a pos, or 0 if there is none.
+
+        This returns the window itself, and is overridden by widgets that
+        attach client children to a content pane instead of to themselves.
+    */
+    virtual const Window* getChildLookupTarget(const String& name_path,
+                                               size_t pos) const;
+
+    /*!
+    \brief
+        Return the child attached directly to this window whose name is the
+        \a length code units of \a name_path starting at \a pos, or 0.
+    */
+    Window* findImmediateChild(const String& name_path, size_t pos,
+                               size_t length) const;
+
+    //! add \a wnd to the index used by findImmediateChild.
+    void addToChildNameIndex(Window& wnd);
+    //! remove \a wnd from the index used by findImmediateChild.
+    void removeFromChildNameIndex(const Window& wnd);
 
     Window* getChildAtPosition(const glm::vec2& position,
                                bool (Window::*hittestfunc)(const glm::vec2&, bool)
@@ -3244,6 +3326,9 @@ protected:
         Implementation Data
     *************************************************************************/
 
+    //! incremented on every change to the window hierarchy.
+    static std::uint64_t s_hierarchyVersion;
+
     //! GUIContext this window is currently living in.
     GUIContext* d_guiContext = nullptr;
     //! The WindowRenderer module that implements the Look'N'Feel specification
@@ -3259,6 +3344,18 @@ protected:
     AnimationInstance* d_hideAnimInst = nullptr;
     //! Holds pointer to some user assigned data.
     void* d_userData = nullptr;
+    //! Event subscription sequence recorded when the window was created.
+    std::uint64_t d_reuseSubscriptionSequence = 0;
+    //! whether the window was created to be reused by WindowManager.
+    bool d_reusable = false;
+    //! GUIContext draw list generation our geometry was last queued in.
+    std::uint64_t d_drawListGeneration = 0;
+    //! redraws counted for GUIContext automatic caching since its last evaluation.
+    std::uint32_t d_autoCacheChanges = 0;
+    //! consecutive automatic caching evaluations without redraws.
+    std::uint32_t d_autoCacheStableIntervals = 0;
+    //! whether our auto rendering surface was enabled by GUIContext automatic caching.
+    bool d_autoCached = false;
 
     Event::ScopedConnection d_visibilityAnimEndConnection;
 
@@ -3304,6 +3401,8 @@ protected:
     String d_lookName;
     //! The name of the window, unique in its parent
     String d_name;
+    //! attached children keyed by a hash of their names; see findImmediateChild.
+    std::unordered_multimap<std::size_t, Window*> d_childNameIndex;
     //! Type of the tooltip object used for this window.
     String d_tooltipType;
     //! Text string used as tooltip for this window.
@@ -3383,6 +3482,19 @@ private:
     void updateRenderingWindow(bool updateSize);
     void updateGeometryTransformAndClipping();
     void updateGeometryAlpha();
+    bool updateRetainedGeometry(std::vector<GeometryBuffer*>& previousBuffers);
+
+    /*
+        The steps of bufferGeometry. Only generateGeometry may run on another
+        thread, and only when isGeometryGenerationThreadSafe() is true.
+    */
+    bool beginGeometryGeneration(std::vector<GeometryBuffer*>& previousBuffers);
+    void generateGeometry();
+    void endGeometryGeneration(std::vector<GeometryBuffer*>& previousBuffers,
+                               const GeometryRecorder* recorder = nullptr);
+    bool isGeometryGenerationThreadSafe() const;
+    //! compute the lazily cached areas that generating geometry reads.
+    void updateRenderingAreaCaches() const;
 };
 
 } // End of  CEGUI namespace section
@@ -31,7 +31,9 @@
 
 #include "CEGUI/Singleton.h"
 #include "CEGUI/EventSet.h"
+#include "CEGUI/Window.h"
 
+#include <unordered_map>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -174,6 +176,48 @@ public:
     //! return whether Window is alive.
     bool isAlive(const Window* window) const;
 
+    /*!
+    \brief
+        Set how many destroyed windows of type \a type are kept for reuse.
+
+        When pooling is enabled for a type, destroyWindow resets windows of
+        that type (see below) and parks them, up to \a size windows, instead
+        of deleting them. createWindow then hands out a parked window, only
+        changing its name, which skips creating the window, its
+        WindowRenderer, look'n'feel and child widgets. This is meant for
+        types that are created and destroyed in large numbers, such as list
+        rows or tooltips.
+
+        A parked window is detached from its parent, its children other than
+        auto windows are destroyed, its properties (and those of its auto
+        windows) are set back to their initial values, and event
+        subscriptions made after it was created are removed. Its auto windows
+        are parked along with it, so like the window itself they are not
+        alive and not returned by getIterator until it is reused. Only windows
+        created while pooling was enabled for their type are pooled.
+
+        Parked windows use the look'n'feel and factory of their type, so
+        clearWindowPools must be called before those are removed; this is
+        done when a Scheme unloads its resources.
+
+    \param type
+        The type as passed to createWindow.
+
+    \param size
+        Maximum number of parked windows; 0 (the default) disables pooling
+        for the type and finally destroys any windows parked for it.
+    */
+    void setWindowPoolSize(const String& type, size_t size);
+
+    //! Return the maximum number of windows of \a type kept for reuse.
+    size_t getWindowPoolSize(const String& type) const;
+
+    //! Return the number of windows of \a type currently parked for reuse.
+    size_t getPooledWindowCount(const String& type) const;
+
+    //! Finally destroy all windows parked for reuse.
+    void clearWindowPools();
+
     /*!
     \brief
         Creates a set of windows (a GUI layout) from the information in the specified XML.
@@ -395,15 +439,53 @@ private:
     //! function to set up RenderEffect on a window
     void initialiseRenderEffect(Window* wnd, const String& effect) const;
 
+    //! add a window to the registry.
+    void registerWindow(Window* window);
+
+    //! remove a window from the registry.
+    void unregisterWindow(Window* window);
+
+    //! add the auto windows of \a window to the registry, recursively.
+    void registerAutoWindows(Window* window);
+
+    //! remove the auto windows of \a window from the registry, recursively.
+    void unregisterAutoWindows(Window* window);
+
+    //! remove the holes left in the registry by destroyed windows.
+    void compactWindowRegistry() const;
+
+    //! destroy the windows parked in \a pool.
+    void destroyPooledWindows(std::vector<Window*>& pool);
+
     /*************************************************************************
 		Implementation Data
 	*************************************************************************/
     typedef std::vector<Window*> WindowVector; //!< Type to use for a collection of Window pointers.
 
-    //! collection of created windows.
-	WindowVector d_windowRegistry;
+    /*!
+        collection of created windows, in order of creation. Destroyed windows
+        leave a nullptr behind, which is removed by compactWindowRegistry.
+    */
+    mutable WindowVector d_windowRegistry;
+    //! index of each window in d_windowRegistry.
+    mutable std::unordered_map<const Window*, size_t> d_windowIndices;
+    //! number of nullptr entries in d_windowRegistry.
+    mutable size_t d_registryHoles;
     WindowVector d_deathrow; //!< Collection of 'destroyed' windows.
 
+    //! windows kept for reuse by createWindow for one window type.
+    struct WindowPool
+    {
+        size_t d_maxSize = 0;
+        WindowVector d_windows;
+        //! whether d_initialState was captured yet.
+        bool d_hasInitialState = false;
+        //! state of a newly created window of the type.
+        Window::InitialState d_initialState;
+    };
+    //! pools of windows kept for reuse, by type.
+    std::unordered_map<String, WindowPool> d_windowPools;
+
     std::uint32_t d_uid_counter;  //!< Counter used to generate unique window names.
     static String d_defaultResourceGroup;   //!< holds default resource group
     //! count of times WM is locked against new window creation.
@@ -81,6 +81,27 @@ public:
     */
     virtual void createRenderGeometry() = 0;
 
+    /*!
+    \brief
+        Return whether createRenderGeometry may be called on a worker thread
+        while other windows generate their geometry on other threads (see
+        GUIContext::setParallelGeometryGenerationEnabled).
+
+        This is the case when createRenderGeometry only reads the window, its
+        ancestors and children and other state that is not modified while the
+        GUI is drawn, creates geometry through
+        Renderer::createGeometryBufferTextured() or
+        Renderer::createGeometryBufferColoured(), and does not fire events.
+        Rendering text is not thread-safe, since fonts rasterise glyphs on
+        demand and text components cache their layout in objects shared by
+        all windows using the same look.
+
+        The default implementation returns false. Window renderers whose
+        geometry comes from the assigned look only can override this to
+        return isLookGeometryGenerationThreadSafe().
+    */
+    virtual bool isGeometryGenerationThreadSafe() const;
+
     /*!
     \brief
         Returns the factory type name of this window renderer.
@@ -299,6 +320,15 @@ protected:
     */
     virtual void onLookNFeelUnassigned() {}
 
+    /*!
+    \brief
+        Return whether the look assigned to the window may be rendered on
+        several threads at once, see
+        WidgetLookManager::isGeometryGenerationThreadSafe. This is false when
+        no look is assigned.
+    */
+    bool isLookGeometryGenerationThreadSafe() const;
+
     /*************************************************************************
         Implementation data
     **************************************************************************/
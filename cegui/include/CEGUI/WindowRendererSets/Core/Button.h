@@ -58,6 +58,7 @@ namespace CEGUI
         FalagardButton(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         virtual String actualStateName(const String& name) const   {return name;}
     };
 
@@ -54,6 +54,7 @@ namespace CEGUI
         FalagardDefault(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
     };
 
 } // End of  CEGUI namespace section
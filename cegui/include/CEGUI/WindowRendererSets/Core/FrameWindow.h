@@ -70,6 +70,7 @@ namespace CEGUI
         FalagardFrameWindow(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         Rectf getUnclippedInnerRect(void) const override;
     };
 
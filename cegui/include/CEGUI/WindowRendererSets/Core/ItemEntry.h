@@ -66,6 +66,7 @@ namespace CEGUI
         FalagardItemEntry(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         Sizef getItemPixelSize() const override;
     };
 
@@ -67,6 +67,7 @@ namespace CEGUI
         void setSegmentWidgetType(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         ListHeaderSegment* createNewSegment(const String& name) const override;
         void destroyListSegment(ListHeaderSegment* segment) const override;
 
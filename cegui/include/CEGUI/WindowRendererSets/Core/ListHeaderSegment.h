@@ -66,6 +66,7 @@ namespace CEGUI
         FalagardListHeaderSegment(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
     };
 
 } // End of  CEGUI namespace section
@@ -71,6 +71,7 @@ namespace CEGUI
         FalagardMenuItem(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         Sizef getItemPixelSize(void) const override;
 
         // overridden from WindowRenderer
@@ -58,6 +58,7 @@ namespace CEGUI
         FalagardMenubar(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         Rectf getItemRenderArea(void) const override;
     };
 
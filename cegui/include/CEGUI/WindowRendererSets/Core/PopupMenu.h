@@ -58,6 +58,7 @@ namespace CEGUI
         FalagardPopupMenu(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         Rectf getItemRenderArea(void) const override;
     };
 
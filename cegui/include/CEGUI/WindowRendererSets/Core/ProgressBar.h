@@ -80,6 +80,7 @@ namespace CEGUI
         void setReversed(bool setting);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
 
     protected:
         // settings to make this class universal.
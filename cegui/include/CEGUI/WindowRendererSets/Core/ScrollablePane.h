@@ -66,6 +66,7 @@ namespace CEGUI
         FalagardScrollablePane(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         Rectf getViewableArea(void) const override;
         Rectf getUnclippedInnerRect() const override;
 
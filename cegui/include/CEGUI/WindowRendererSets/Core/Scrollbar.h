@@ -76,6 +76,7 @@ namespace CEGUI
         void setVertical(bool setting);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
         bool performChildWindowLayout() override;
 
     protected:
@@ -70,6 +70,7 @@ public:
     void setReversedDirection(bool setting) { d_reversed = setting; }
 
     void createRenderGeometry() override;
+    bool isGeometryGenerationThreadSafe() const override;
     bool performChildWindowLayout() override;
 
 protected:
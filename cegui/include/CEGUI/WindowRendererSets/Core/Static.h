@@ -101,6 +101,7 @@ namespace CEGUI
         void    setBackgroundEnabled(bool setting);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
 
         /*!
         \brief
@@ -303,6 +303,7 @@ public:
     // overridden from base class
     bool handleFontRenderSizeChange(const Font* const font) override;
     void createRenderGeometry() override;
+    bool isGeometryGenerationThreadSafe() const override;
 
     /*!
     \brief
@@ -53,6 +53,7 @@ public:
     FalagardTabButton(const String& type);
 
     void createRenderGeometry() override;
+    bool isGeometryGenerationThreadSafe() const override;
 
     virtual Sizef getContentSize() const override;
 };
@@ -76,6 +76,7 @@ namespace CEGUI
         void setTabButtonType(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
 
     protected:
         // overridden from TabControl base class.
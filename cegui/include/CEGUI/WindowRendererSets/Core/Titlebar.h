@@ -55,6 +55,7 @@ namespace CEGUI
         FalagardTitlebar(const String& type);
 
         void createRenderGeometry() override;
+        bool isGeometryGenerationThreadSafe() const override;
     };
 
 } // End of  CEGUI namespace section
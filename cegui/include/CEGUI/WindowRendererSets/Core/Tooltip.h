@@ -54,6 +54,7 @@ public:
     FalagardTooltip(const String& type) : WindowRenderer(type, "Tooltip") {}
 
     void createRenderGeometry() override;
+    bool isGeometryGenerationThreadSafe() const override;
     Sizef getContentSize() const override;
 
 protected:
@@ -28,6 +28,7 @@
 #define _CEGUIXMLAttributes_h_
 
 #include "CEGUI/String.h"
+#include "CEGUI/MemoryTracker.h"
 #include <unordered_map>
 
 #if defined(_MSC_VER)
@@ -221,7 +222,8 @@ namespace CEGUI
 
     protected:
 
-        std::unordered_map<String, String> d_attrs;
+        std::unordered_map<String, String, std::hash<String>, std::equal_to<String>,
+                           TrackedAllocator<std::pair<const String, String>, MemoryTag::XML>> d_attrs;
     };
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,231 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIXMLBinaryCache_h_
+#define _CEGUIXMLBinaryCache_h_
+
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/String.h"
+#include "CEGUI/MemoryTracker.h"
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+namespace CEGUI
+{
+class XMLAttributes;
+
+/*!
+\brief
+    Compiled binary representation of XML resources.
+
+    Every XML based resource in CEGUI (schemes, imagesets, looknfeels, fonts,
+    layouts, animations) is loaded by feeding the element stream produced by
+    an XMLParser into an XMLHandler. This class stores that element stream in
+    a flat, versioned binary blob that can be replayed into the same handler
+    without invoking the XMLParser (and therefore without any text parsing or
+    schema validation).
+
+    A blob consists of a fixed header, a table of unique UTF-8 strings and a
+    sequence of events referring to that table by index. All offsets are
+    relative to the start of the blob and all fields are naturally aligned,
+    so the format does not depend on where the blob is stored. Blob files
+    are currently read into memory in full before being replayed; they are
+    not memory mapped.
+
+    Each blob records a hash of the XML source it was compiled from. When the
+    cache is enabled (by setting a cache directory), XMLParser::parseXMLFile
+    will replay a matching blob if one exists and the hash of the current
+    source still matches, and will otherwise parse the XML normally and write
+    an updated blob for the next run.
+
+\note
+    Replaying a blob never validates the element stream against the schema
+    of the resource, even when the XMLParser in use supports validation. The
+    XML is only validated when it is parsed to compile the blob, so blobs in
+    the cache directory must come from a trusted source.
+*/
+class CEGUIEXPORT XMLBinaryCache
+{
+public:
+    //! Version of the binary format; blobs with another version are ignored.
+    static const std::uint32_t FormatVersion;
+    //! File extension used for compiled blobs.
+    static const String FileExtension;
+
+    XMLBinaryCache();
+
+    /*!
+    \brief
+        Set the filesystem directory used to read and write compiled blobs.
+        An empty string (the default) disables the cache.
+    */
+    void setCacheDirectory(const String& directory);
+    //! Return the directory used for compiled blobs (empty if disabled).
+    const String& getCacheDirectory() const { return d_cacheDirectory; }
+
+    //! Return whether the cache is enabled.
+    bool isEnabled() const { return !d_cacheDirectory.empty(); }
+
+    /*!
+    \brief
+        Add a blob held in memory for \a filename from \a resourceGroup.
+
+        Blobs added this way are tried before the cache directory. Like the
+        cache directory, they are only used while the cache is enabled, since
+        replaying a blob skips schema validation. This is how XML that was
+        parsed ahead of time (for example by ParallelResourceLoader on its
+        worker threads) is handed to the regular loading code.
+    */
+    void addPreparedBlob(const String& filename, const String& resourceGroup,
+                         std::vector<std::uint8_t> blob);
+
+    //! Remove all blobs added with addPreparedBlob.
+    void clearPreparedBlobs() { d_preparedBlobs.clear(); }
+
+    //! Return whether any blobs were added with addPreparedBlob.
+    bool hasPreparedBlobs() const { return !d_preparedBlobs.empty(); }
+
+    /*!
+    \brief
+        Set whether blobs are (re)written when the cached copy is missing or
+        stale. When disabled the cache is only read, which is useful when the
+        blobs are generated offline and shipped read-only.
+    */
+    void setWriteEnabled(bool setting) { d_writeEnabled = setting; }
+    //! Return whether blobs are (re)written on a cache miss.
+    bool isWriteEnabled() const { return d_writeEnabled; }
+
+    /*!
+    \brief
+        Try to handle \a filename from \a resourceGroup using a compiled blob.
+
+    \param handler
+        XMLHandler that will receive the recorded element stream.
+
+    \param source
+        Pointer to the XML source data that was loaded for \a filename. This is
+        only hashed to check whether the blob is still valid.
+
+    \return
+        true if a valid blob was found (in memory or in the cache directory)
+        and replayed into \a handler, false if the caller should parse the XML
+        source normally.
+
+    \note
+        The replayed elements are not validated against any schema.
+    */
+    bool replay(XMLHandler& handler, const String& filename,
+                const String& resourceGroup, const std::uint8_t* source,
+                size_t sourceSize) const;
+
+    /*!
+    \brief
+        Write a compiled blob for \a filename from \a resourceGroup to the
+        cache directory.
+    */
+    void store(const String& filename, const String& resourceGroup,
+               const std::vector<std::uint8_t>& blob) const;
+
+    //! Return the name of the blob file used for the given XML resource.
+    static String getCacheFileName(const String& filename,
+                                   const String& resourceGroup);
+
+    //! Return the hash value stored in blobs for the given XML source data.
+    static std::uint64_t hashSource(const std::uint8_t* data, size_t size);
+
+    /*!
+    \brief
+        Replay a compiled blob into \a handler.
+
+    \param sourceHash
+        Hash of the XML source the caller expects the blob to be compiled from.
+
+    \return
+        true if the blob was valid and replayed, false if it has an unexpected
+        version or source hash, or is malformed. Nothing is sent to the handler
+        when false is returned.
+    */
+    static bool replayBlob(XMLHandler& handler, const std::uint8_t* blob,
+                           size_t blobSize, std::uint64_t sourceHash);
+
+    /*!
+    \brief
+        XMLHandler that forwards everything to another handler and records the
+        element stream as a compiled blob.
+
+        The target handler may be nullptr, which is used by offline compilers
+        that only need the blob.
+    */
+    class CEGUIEXPORT Recorder : public XMLHandler
+    {
+    public:
+        Recorder(XMLHandler* target, std::uint64_t sourceHash);
+
+        const String& getSchemaName() const override;
+        const String& getDefaultResourceGroup() const override;
+        void elementStart(const String& element, const XMLAttributes& attributes) override;
+        void elementEnd(const String& element) override;
+        void text(const String& text) override;
+
+        //! Build the compiled blob from everything recorded so far.
+        std::vector<std::uint8_t> getBlob() const;
+
+    private:
+        std::uint32_t addString(const String& str);
+
+        XMLHandler* d_target;
+        std::uint64_t d_sourceHash;
+        //! recorded events; see XMLBinaryCache.cpp for the layout.
+        std::vector<std::uint32_t, TrackedAllocator<std::uint32_t, MemoryTag::XML>> d_events;
+        std::vector<std::string> d_strings;
+        std::unordered_map<std::string, std::uint32_t> d_stringIndices;
+    };
+
+private:
+    String getCacheFilePath(const String& filename,
+                            const String& resourceGroup) const;
+
+    typedef std::unordered_map<String, std::vector<std::uint8_t> > PreparedBlobMap;
+
+    String d_cacheDirectory;
+    bool d_writeEnabled;
+    //! blobs added with addPreparedBlob, keyed by getCacheFileName.
+    PreparedBlobMap d_preparedBlobs;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIXMLBinaryCache_h_
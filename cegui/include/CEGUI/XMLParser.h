@@ -124,6 +124,11 @@ namespace CEGUI
             defaulting to "true" to allow validation.
             Only needed if xml validation should be disallowed once.
 
+        \note
+            When the XMLBinaryCache holds an up to date compiled copy of the
+            file, that copy is replayed into \a handler instead and no schema
+            validation takes place.
+
         \return
             Nothing.
          */
@@ -163,6 +168,21 @@ namespace CEGUI
         */
         const String& getIdentifierString() const;
 
+        /*!
+        \brief
+            Return whether parseXML may be called from several threads at
+            once, with a different handler and source for each call.
+
+            This is false unless the parser module states otherwise. Of the
+            parser modules shipped with CEGUI, Expat, TinyXML2 and PugiXML
+            create all parser state per call and return true. Libxml2 keeps
+            global error state and Xerces loads schemas through the
+            ResourceProvider, so they return false.
+
+        \see ParallelResourceLoader
+        */
+        virtual bool isThreadSafe() const;
+
     protected:
         /*!
         \brief
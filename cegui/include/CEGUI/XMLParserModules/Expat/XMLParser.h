@@ -55,6 +55,7 @@ public:
 
     // Implementation of public abstract interface
     void parseXML(XMLHandler& handler, const RawDataContainer& source, const String& schemaName, bool /*allowXmlValidation*/) override;
+    bool isThreadSafe() const override;
 
 protected:
     // Implementation of protected abstract interface.
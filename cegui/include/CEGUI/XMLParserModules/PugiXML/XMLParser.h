@@ -51,6 +51,7 @@ public:
 
     void parseXML(XMLHandler& handler, const RawDataContainer& source,
                   const String& schemaName, bool /*allowXmlValidation*/);
+    bool isThreadSafe() const override;
 
 protected:
 
@@ -59,6 +59,7 @@ public:
     TinyXML2Parser();
 
     void parseXML(XMLHandler& handler, const RawDataContainer& filename, const String& schemaName, bool allowXmlValidation) override;
+    bool isThreadSafe() const override;
 
 protected:
 
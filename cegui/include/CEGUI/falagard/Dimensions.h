@@ -97,6 +97,13 @@ public:
     virtual bool handleFontRenderSizeChange(Window& window,
                                             const Font* font) const;
 
+    /*!
+    \brief
+        Return whether the value of this dimension is calculated from font
+        metrics, which may make the font load glyphs.
+    */
+    virtual bool usesFont() const;
+
     /*!
     \brief
         Get a lower bound for this dimension as an affine function of "type".
@@ -194,6 +201,7 @@ public:
     void setNextOperand(const BaseDim* operand);
 
     bool handleFontRenderSizeChange(Window& window, const Font* font) const override;
+    bool usesFont() const override;
 
     // Implementation of the base class interface
     float getValue(const Window& wnd) const override;
@@ -594,6 +602,7 @@ public:
     void setPadding(float padding);
 
     bool handleFontRenderSizeChange(Window& window, const Font* font) const override;
+    bool usesFont() const override;
 
     // Implementation of the base class interface
     float getValue(const Window& wnd) const override;
@@ -822,6 +831,9 @@ public:
     bool handleFontRenderSizeChange(Window& window,
                                     const Font* font) const;
 
+    //! Return whether the value is calculated from font metrics.
+    bool usesFont() const;
+
 private:
     //! Pointer to the value for this Dimension.
     BaseDim* d_value;
@@ -947,6 +959,13 @@ public:
     //! perform any processing required due to the given font having changed.
     bool handleFontRenderSizeChange(Window& window, const Font* font) const;
 
+    /*!
+    \brief
+        Return whether the area is calculated from font metrics, including
+        through a named area it is fetched from.
+    */
+    bool usesFont() const;
+
     /*!
     \brief
         Get a lower bound for the width of this area as an affine function of
@@ -438,6 +438,24 @@ public:
     */
     bool isAnimationPresent(const String& name, bool includeInheritedLook = true) const;
 
+    /*!
+    \brief
+        Returns whether rendering any StateImagery of this look (including
+        inherited ones) may happen on several threads at once. This is the
+        case when all the ImagerySections it uses can be found, none of them
+        contains a TextComponent, and neither their components nor the
+        NamedAreas of the look use a FontDim, since fonts load glyphs on
+        demand. Images, including SVGImage, may be rendered by several threads
+        at once.
+
+        This walks all the imagery of the look, callers that need the result
+        often should use WidgetLookManager::isGeometryGenerationThreadSafe,
+        which keeps it.
+
+    \see WindowRenderer::isGeometryGenerationThreadSafe
+    */
+    bool isGeometryGenerationThreadSafe() const;
+
     /*!
     \brief
         Adds a named area to the WidgetLookFeel.
@@ -147,6 +147,26 @@ namespace CEGUI
         */
         const WidgetLookFeel& getWidgetLook(const String& widget) const;
 
+        /*!
+        \brief
+            Return whether the geometry of the named WidgetLookFeel may be
+            generated on several threads at once, see
+            WidgetLookFeel::isGeometryGenerationThreadSafe.
+
+            The result is kept until a WidgetLookFeel is added or erased.
+            Changes made in place to looks obtained through
+            getWidgetLookPointerMap() are not noticed before that. Call this
+            from the thread that loads the looks only.
+
+        \param widget
+            String object holding the name of the widget look to check.
+
+        \return
+            - true if the look may be rendered on several threads at once.
+            - false if it may not, or no such look is available.
+        */
+        bool isGeometryGenerationThreadSafe(const String& widget) const;
+
 
         /*!
         \brief
@@ -290,9 +310,10 @@ namespace CEGUI
         */
         WidgetLookPointerMap getWidgetLookPointerMap();
 
-    private:
         //! Name of schema file used for XML validation.
-        static const String FalagardSchemaName; 
+        static const String FalagardSchemaName;
+
+    private:
         //! holds default resource group
         static String d_defaultResourceGroup;
 
@@ -302,6 +323,9 @@ namespace CEGUI
 
         //! List of WidgetLookFeels added to this Manager
         WidgetLookList  d_widgetLooks;  
+
+        //! Results of isGeometryGenerationThreadSafe, by look name
+        mutable std::unordered_map<String, bool> d_geometryGenerationThreadSafety;
     };
 
 } // End of  CEGUI namespace section
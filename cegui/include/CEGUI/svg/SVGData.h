@@ -32,6 +32,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/svg/SVGPaintStyle.h"
 
+#include <cstdint>
 #include <vector>
 
 #if defined(_MSC_VER)
@@ -142,6 +143,14 @@ public:
     */
     const std::vector<SVGBasicShape*>& getShapes() const;
 
+    /*!
+    \brief
+        Returns a counter that is incremented whenever shapes are added or
+        destroyed. SVGImage uses this to detect that its cached tessellation
+        is out of date.
+    */
+    std::uint32_t getRevision() const { return d_revision; }
+
     /*!
     \brief
         Returns the SVGData's width in pixels.
@@ -268,6 +277,8 @@ protected:
 
     //! The basic shapes that were added to the SVGData
     std::vector<SVGBasicShape*> d_svgBasicShapes;
+    //! Incremented whenever d_svgBasicShapes changes
+    std::uint32_t d_revision;
 
 private:
     /*!
@@ -28,8 +28,18 @@
 #define _SVGImage_h_
 
 #include "CEGUI/Image.h"
+#include "CEGUI/GeometryBuffer.h"
 
 #include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(_MSC_VER)
+#	pragma warning(push)
+#	pragma warning(disable : 4251)
+#endif
 
 namespace CEGUI
 {
@@ -106,7 +116,68 @@ public:
     */
     void setUseGeometryAntialiasing(bool use_geometry_antialiasing);
 
+    /*!
+    \brief
+        Discards all cached tessellations of the SVGData.
+
+        Tessellated geometry is cached per scale bucket and anti-aliasing
+        setting and is rebuilt automatically when shapes are added to or
+        removed from the SVGData. This function only needs to be called after
+        modifying the attributes of shapes that are already part of the SVGData.
+    */
+    void invalidateGeometryCache();
+
+    /*!
+    \brief
+        Number of scale buckets per doubling of the scale. Geometry is
+        tessellated once per bucket and reused for every scale that falls into
+        it; a higher value means less deviation of the curve tessellation and
+        anti-aliasing fringe from the exact scale at the cost of more cache
+        misses while an image is being resized.
+    */
+    static const int ScaleBucketsPerOctave;
+
+    //! Maximum number of tessellations kept per SVGImage.
+    static const size_t MaxCachedTessellations;
+
 protected:
+    /*!
+    \brief
+        Vertices of consecutive shapes that can be rendered with the same
+        GeometryBuffer state. Positions are in SVG document space with the
+        shape transformations already applied.
+    */
+    struct TessellationBatch
+    {
+        std::vector<float> d_vertexData;
+        //! Number of floats per vertex.
+        int d_vertexStride;
+        PolygonFillRule d_fillRule;
+        unsigned int d_postStencilVertexCount;
+        BlendMode d_blendMode;
+    };
+
+    //! The geometry of the whole SVGData tessellated for one scale bucket.
+    struct Tessellation
+    {
+        int d_scaleBucketX;
+        int d_scaleBucketY;
+        bool d_antiAliasing;
+        std::vector<TessellationBatch> d_batches;
+    };
+
+    /*!
+    \brief
+        Returns the cached tessellation for the given settings, creating it if
+        needed. The returned tessellation stays valid after it is evicted from
+        the cache, so this may be called from several threads at once.
+    */
+    std::shared_ptr<const Tessellation> getTessellation(const glm::vec2& scale,
+                                                        bool anti_aliasing) const;
+
+    //! Tessellates all shapes of the SVGData into \a tessellation.
+    void tessellate(Tessellation& tessellation) const;
+
     /*!
         \brief
         Reference to the SVGData used as basis for drawing. The SVGData can be shared
@@ -122,9 +193,21 @@ protected:
         an alpha-blended transition to defeat aliasing artefacts
     */
     bool d_useGeometryAntialiasing;
+
+    //! Cached tessellations, most recently used first.
+    mutable std::vector<std::shared_ptr<const Tessellation>> d_tessellations;
+    //! Guards the cached tessellations, as imagery may be rendered by worker threads.
+    mutable std::mutex d_tessellationMutex;
+    //! The SVGData and its revision the cached tessellations were created from.
+    mutable const SVGData* d_tessellatedData;
+    mutable std::uint32_t d_tessellatedRevision;
 };
 
 }
 
+#if defined(_MSC_VER)
+#	pragma warning(pop)
+#endif
+
 #endif
 
@@ -225,6 +225,15 @@ public:
     //! \brief Calculates and returns kerning between two glyphs (in pixels, not rounded)
     virtual float getKerning(const FontGlyph* /*prev*/, const FontGlyph& /*curr*/) const { return 0.f; }
 
+    /*!
+    \brief
+        Return a counter that is incremented whenever glyph geometry generated
+        earlier with this Font becomes invalid, i.e. when the render size
+        changes or the glyph textures are rebuilt or resized. This is used by
+        RenderedText to validate its cached geometry.
+    */
+    uint32_t getRenderRevision() const { return d_renderRevision; }
+
 
     /*!
     \brief
@@ -424,6 +433,8 @@ protected:
     float d_horzScaling;
     //! current vertical scaling factor.
     float d_vertScaling;
+    //! incremented whenever previously generated glyph geometry becomes invalid.
+    uint32_t d_renderRevision = 0;
 };
 
 
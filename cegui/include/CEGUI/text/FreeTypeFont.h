@@ -32,6 +32,7 @@
 #include "CEGUI/text/Font.h"
 #include "CEGUI/DataContainer.h"
 #include "CEGUI/text/FreeTypeFontGlyph.h"
+#include "CEGUI/MemoryTracker.h"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -214,7 +215,7 @@ protected:
         The pixel data of the subimage 
     */
     void updateTextureBufferSubImage(argb_t* buffer, uint32_t bitmapWidth,
-        uint32_t bitmapHeight, const std::vector<argb_t>& subImageData) const;
+        uint32_t bitmapHeight, const argb_t* subImageData) const;
 
     /*
     \brief
@@ -276,8 +277,11 @@ protected:
     uint32_t d_lastTextureSize = 0;
     //! Textures that hold the glyph imagery for this font.
     std::vector<Texture*> d_glyphTextures;
+    //! Type of the CPU side copy of a glyph atlas texture.
+    typedef std::vector<argb_t, TrackedAllocator<argb_t, MemoryTag::Font>> TextureBuffer;
+
     //! Memory buffer for rendering the glyphs, this contains the data of the latest texture
-    std::vector<argb_t> d_lastTextureBuffer;
+    TextureBuffer d_lastTextureBuffer;
     //! Contains information about the extents of each line of glyphs of the latest texture
     std::vector<TextureGlyphLine> d_textureGlyphLines;
 };
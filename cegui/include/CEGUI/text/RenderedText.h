@@ -26,6 +26,7 @@
  ***************************************************************************/
 #pragma once
 #include "CEGUI/text/RenderedTextParagraph.h"
+#include "CEGUI/GeometryBuffer.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -68,6 +69,22 @@ public:
     //! Explicit cloning method. Used instead of copy constructor and assignment operator.
     RenderedText clone() const;
 
+    /*!
+    \brief
+        Enable or disable reusing geometry between createRenderGeometry calls.
+
+        When enabled, the vertices generated for the text are kept and copied
+        into the output on the next call instead of being generated again, as
+        long as the formatting, the font revisions, the colours and the clip
+        rect relative to the text position are the same. A change of position
+        by a whole number of pixels only shifts the kept vertices. Rendering
+        with a selection always generates new geometry.
+    */
+    void setGeometryCachingEnabled(bool enable);
+    bool isGeometryCachingEnabled() const { return d_geometryCachingEnabled; }
+    //! Drop the kept geometry, e.g. after changing an embedded image externally
+    void invalidateGeometryCache() const;
+
     void setHorizontalFormatting(HorizontalTextFormatting fmt);
     HorizontalTextFormatting getHorizontalFormatting() const { return d_horzFormatting; }
     void setLastJustifiedLineFormatting(HorizontalTextFormatting fmt);
@@ -101,7 +118,33 @@ protected:
 
     size_t findParagraphIndex(size_t textIndex, float& offsetY) const;
 
-    std::vector<RenderedTextParagraph> d_paragraphs;
+    /*!
+    \brief
+        Vertices and state of one GeometryBuffer generated by createRenderGeometry
+        at d_geometryCachePosition. They are never changed afterwards; drawing the
+        text elsewhere prepends a translation to the custom transform instead.
+    */
+    struct CachedGeometry
+    {
+        std::vector<float, TrackedAllocator<float, MemoryTag::RenderedText>> vertexData;
+        const Texture* texture = nullptr;
+        Rectf clippingRegion;
+        glm::mat4 customTransform = glm::mat4(1.f);
+        float alpha = 1.f;
+        BlendMode blendMode;
+        PolygonFillRule fillRule = PolygonFillRule::NoFilling;
+        unsigned int postStencilVertexCount = 0;
+        bool textured = false;
+        bool clippingActive = false;
+    };
+
+    bool getGeometryCacheRevision(uint32_t& revision) const;
+    bool reuseCachedGeometry(std::vector<GeometryBuffer*>& out, const glm::vec2& position,
+        const ColourRect* modColours, const Rectf* clipRect, uint32_t revision) const;
+    void updateGeometryCache(const std::vector<GeometryBuffer*>& out, size_t firstBufferIdx,
+        const glm::vec2& position, const ColourRect* modColours, const Rectf* clipRect) const;
+
+    std::vector<RenderedTextParagraph, TrackedAllocator<RenderedTextParagraph, MemoryTag::RenderedText>> d_paragraphs;
     std::vector<RenderedTextElementPtr> d_elements;
     const Font* d_defaultFont = nullptr;
     Sizef d_extents;
@@ -110,6 +153,16 @@ protected:
     HorizontalTextFormatting d_horzFormatting = HorizontalTextFormatting::LeftAligned;
     HorizontalTextFormatting d_lastJustifiedLineFormatting = HorizontalTextFormatting::LeftAligned;
     bool d_wordWrap = false;
+
+    bool d_geometryCachingEnabled = true;
+    mutable bool d_geometryCacheValid = false;
+    mutable bool d_geometryCacheHasColours = false;
+    mutable bool d_geometryCacheHasClipRect = false;
+    mutable uint32_t d_geometryCacheRevision = 0;
+    mutable glm::vec2 d_geometryCachePosition;
+    mutable ColourRect d_geometryCacheColours;
+    mutable Rectf d_geometryCacheClipRect; //!< Relative to d_geometryCachePosition
+    mutable std::vector<CachedGeometry, TrackedAllocator<CachedGeometry, MemoryTag::RenderedText>> d_geometryCache;
 };
 
 }
@@ -62,6 +62,14 @@ public:
         size_t count, glm::vec2& penPosition, const ColourRect* modColours, const Rectf* clipRect,
         float lineHeight, float justifySpaceSize, size_t canCombineFromIdx, const SelectionInfo* selection) const = 0;
 
+    /*!
+    \brief
+        Return whether the geometry generated by this element depends only on
+        its arguments, font revisions and the element's own state, so that
+        RenderedText may reuse it instead of calling createRenderGeometry again.
+    */
+    virtual bool isGeometryCacheable() const { return true; }
+
     virtual RenderedTextElementPtr clone() const = 0;
 
     void setPadding(const Rectf& padding) { d_padding = padding; }
@@ -29,6 +29,7 @@
 #include "CEGUI/falagard/Enums.h"
 #include "CEGUI/ColourRect.h"
 #include "CEGUI/Rectf.h"
+#include "CEGUI/MemoryTracker.h"
 #include <vector>
 #include <memory>
 
@@ -70,6 +71,8 @@ public:
 
     static constexpr size_t npos = std::numeric_limits<size_t>().max();
 
+    typedef std::vector<RenderedGlyph, TrackedAllocator<RenderedGlyph, MemoryTag::RenderedText>> GlyphList;
+
     RenderedTextParagraph(uint32_t sourceStartIndex, uint32_t sourceEndIndex)
         : d_sourceStartIndex(sourceStartIndex)
         , d_sourceEndIndex(sourceEndIndex)
@@ -99,6 +102,8 @@ public:
     void updateLineHeights(const std::vector<RenderedTextElementPtr>& elements, float defaultFontHeight);
     //! Update horizontal alignment of lines
     void updateHorizontalFormatting(float areaWidth);
+    //! Check if any of the update functions above has work to do
+    bool isFormattingDirty() const;
 
     //! Extends a rect with total extents of this paragraph
     void accumulateExtents(Rectf& extents) const;
@@ -121,8 +126,8 @@ public:
     void setBidiDirection(DefaultParagraphDirection dir) { d_bidiDir = dir; }
     DefaultParagraphDirection getBidiDirection() const { return d_bidiDir; }
 
-    std::vector<RenderedGlyph>& glyphs() { return d_glyphs; }
-    const std::vector<RenderedGlyph>& glyphs() const { return d_glyphs; }
+    GlyphList& glyphs() { return d_glyphs; }
+    const GlyphList& glyphs() const { return d_glyphs; }
 
     uint32_t getSourceStartIndex() const { return d_sourceStartIndex; }
     uint32_t getSourceEndIndex() const { return d_sourceEndIndex; }
@@ -179,8 +184,8 @@ protected:
 
     size_t getGlyphLineIndex(size_t glyphIndex) const;
 
-    std::vector<RenderedGlyph> d_glyphs;
-    std::vector<Line> d_lines;
+    GlyphList d_glyphs;
+    std::vector<Line, TrackedAllocator<Line, MemoryTag::RenderedText>> d_lines;
 
     uint32_t d_sourceStartIndex = 0;  //!< Starting index of the paragraph in the logical text
     uint32_t d_sourceEndIndex = 0;  //!< Starting index of the paragraph in the logical text
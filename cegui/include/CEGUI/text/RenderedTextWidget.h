@@ -52,6 +52,9 @@ public:
         size_t count, glm::vec2& penPosition, const ColourRect* modColours, const Rectf* clipRect,
         float lineHeight, float justifySpaceSize, size_t canCombineFromIdx, const SelectionInfo* selection) const override;
 
+    //! Rendering positions the widget, so it must happen every time
+    virtual bool isGeometryCacheable() const override { return false; }
+
     virtual RenderedTextElementPtr clone() const override;
 
 protected:
@@ -30,12 +30,24 @@
 #define _CEGUIGridLayoutContainer_h_
 
 #include "LayoutContainer.h"
+#include <map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
 
 namespace CEGUI
 {
 /*!
 \brief
     A Layout Container window layouting it's children into a grid
+
+\par
+    Only occupied cells are stored, empty cells cost nothing. Functions of
+    this class taking a child index (such as addChildAtIndex, removeChildAtIndex
+    and moveChildToIndex) take a cell index as returned by mapCellToIndex,
+    which is not the same as the position of the child in the child list.
 */
 class CEGUIEXPORT GridLayoutContainer : public LayoutContainer
 {
@@ -46,7 +58,7 @@ public:
     //! Namespace for global events
     static const String EventNamespace;
 
-    //! Widget name for dummies.
+    //! Widget name used for empty cell placeholders in layout XML.
     static const String DummyName;
 
     GridLayoutContainer(const String& type, const String& name);
@@ -115,7 +127,7 @@ public:
 
     /*!
     \brief
-        Returns an actual layout child count not including auxiliary items (dummy placeholders)
+        Returns an actual layout child count not including auxiliary items
     */
     virtual size_t getActualChildCount() const override;
 
@@ -127,15 +139,22 @@ public:
 
     /*!
     \brief
-        Returns the first free index in a grid or an invalid index (>= child count).
+        Returns the first free index in a grid or an invalid index (>= cell count).
     */
     size_t getFirstFreeIndex(size_t start = 0) const;
 
     /*!
     \brief
-        Returns the last busy index in a grid or an invalid index (>= child count).
+        Returns the last busy index in a grid or an invalid index (>= cell count).
     */
     size_t getLastBusyIndex() const;
+
+    /*!
+    \brief
+        Returns the index of the cell containing \a child or an invalid index
+        (>= cell count) if \a child is not in the grid.
+    */
+    size_t getChildCellIndex(const Element* child) const;
     
     // Overridden to provide more appropriate implementation for the grid
     void addChildAtIndex(Element* element, size_t index) override;
@@ -198,6 +217,7 @@ public:
 
 protected:
 
+    //! create the window standing for empty cells while loading from XML.
     Window* createDummy();
     void validateGridCell(size_t gridX, size_t gridY);
     void growByOneLine();
@@ -210,13 +230,21 @@ protected:
 
     virtual void layout_impl() override;
 
+    typedef std::map<size_t, Window*> CellMap;
+
+    //! occupied cells keyed by cell index, empty cells have no entry.
+    CellMap d_cells;
+
     size_t d_gridWidth = 0;
     size_t d_gridHeight = 0;
     
     size_t d_requestedChildIdx;
     size_t d_freeSearchStart = 0; // Free cell search optimization
-    
-    size_t d_nextDummyIdx = 0;
+
+    //! cell index given to the next child loaded from XML.
+    size_t d_nextLoadIdx = 0;
+    //! placeholder returned for empty cells while loading from XML.
+    Window* d_loadPlaceholder = nullptr;
     
     bool d_rowMajor = true;
     bool d_autoGrow = false;
@@ -228,4 +256,8 @@ private:
 
 }
 
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
 #endif
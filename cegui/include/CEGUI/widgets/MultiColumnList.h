@@ -757,6 +757,38 @@ public:
     */
     float   getHighestRowItemHeight(unsigned int row_idx) const;
 
+    /*!
+    \brief
+        Return, in pixels, the distance from the top of the first row to the
+        top of the given row.
+
+        Row offsets are cached, so this is a constant time operation as long
+        as the list is not modified. Rendering and hit testing use these
+        offsets too, so after changing the size of an item directly
+        handleUpdatedItemData must be called.
+
+    \param row_idx
+        Zero based index of the row.  Passing getRowCount() returns the same
+        value as getTotalRowsHeight().
+
+    \exception InvalidRequestException
+        thrown if \a row_idx is greater than getRowCount().
+    */
+    float   getRowOffset(unsigned int row_idx) const;
+
+    /*!
+    \brief
+        Return the index of the row that contains the given vertical offset,
+        measured in pixels from the top of the first row.
+
+        This performs a binary search of the cached row offsets.
+
+    \return
+        Zero based index of the row containing \a offset, 0 if \a offset is
+        negative, or getRowCount() if \a offset is below the last row.
+    */
+    unsigned int getRowAtOffset(float offset) const;
+
     /*!
     \brief
         Get whether or not column auto-sizing (autoSizeColumnHeader()) will use
@@ -1239,6 +1271,9 @@ public:
 		Inform the list box that one or more attached ListboxItems have been externally modified, and
 		the list should re-sync its internal state and refresh the display as needed.
 
+		The row heights used for layout are cached (see getRowOffset), so this must be called
+		whenever an item changes in a way that may affect its size, such as a new text.
+
 	\return
 		Nothing.
 	*/
@@ -1570,6 +1605,16 @@ protected:
     */
     void resortList();
 
+    /*!
+    \brief
+        Discard the cached row offsets.  This must be called whenever rows are
+        added, removed or reordered, or the size of any item may have changed.
+    */
+    void invalidateRowOffsets();
+
+    //! Rebuild the cached row offsets if they are out of date.
+    void updateRowOffsets() const;
+
 	/*************************************************************************
 		New event handlers for multi column list
 	*************************************************************************/
@@ -1724,6 +1769,11 @@ protected:
     //! whether header size will be considered when auto-sizing columns.
     bool d_autoSizeColumnUsesHeader;
 
+    //! offset of the top of each row from the top of the first row, followed by the total height.
+    mutable std::vector<float> d_rowOffsets;
+    //! whether d_rowOffsets matches the current content of d_grid.
+    mutable bool d_rowOffsetsValid;
+
     friend class MultiColumnListWindowRenderer;
 
 protected:
@@ -557,8 +557,9 @@ protected:
     void onIsSizeAdjustedToContentChanged(ElementEventArgs& e) override;
     void adjustSizeToContent() override {}
 
-    //! \copydoc Window::findChildByNamePath_impl
-    Window* findChildByNamePath_impl(const String& name_path) const override;
+    //! \copydoc Window::getChildLookupTarget
+    const Window* getChildLookupTarget(const String& name_path,
+                                       size_t pos) const override;
 
     // Swipe scroll support
     void onMouseButtonDown(MouseButtonEventArgs& e) override;
@@ -493,8 +493,9 @@ protected:
     void addChild_impl(Element* element) override;
     void removeChild_impl(Element* element) override;
 
-    //! \copydoc Window::findChildByNamePath_impl
-    Window* findChildByNamePath_impl(const String& name_path) const override;
+    //! \copydoc Window::getChildLookupTarget
+    const Window* getChildLookupTarget(const String& name_path,
+                                       size_t pos) const override;
 
     /*************************************************************************
     Event handlers
@@ -33,7 +33,8 @@ namespace CEGUI
 BoundSlot::BoundSlot(Group group, const SubscriberSlot& subscriber, Event& event) :
     d_group(group),
     d_subscriber(new SubscriberSlot(subscriber)),
-    d_event(&event)
+    d_event(&event),
+    d_sequence(0)
 {}
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,74 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ChildHandle.h"
+#include "CEGUI/Exceptions.h"
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+ChildHandle::ChildHandle() :
+    d_window(nullptr),
+    d_child(nullptr),
+    d_version(Window::getHierarchyVersion())
+{
+}
+
+//----------------------------------------------------------------------------//
+ChildHandle::ChildHandle(const Window* window, const String& name_path) :
+    d_window(window),
+    d_namePath(name_path)
+{
+    resolve();
+}
+
+//----------------------------------------------------------------------------//
+void ChildHandle::reset(const Window* window, const String& name_path)
+{
+    d_window = window;
+    d_namePath = name_path;
+    resolve();
+}
+
+//----------------------------------------------------------------------------//
+Window* ChildHandle::get() const
+{
+    if (Window* wnd = find())
+        return wnd;
+
+    throw UnknownObjectException("The Element object referenced by '" +
+        d_namePath + "' is not attached to Element at '" +
+        (d_window ? d_window->getNamePath() : String()) + "'.");
+}
+
+//----------------------------------------------------------------------------//
+void ChildHandle::resolve() const
+{
+    d_child = d_window ? d_window->findChild(d_namePath) : nullptr;
+    d_version = Window::getHierarchyVersion();
+}
+
+} // End of  CEGUI namespace section
@@ -28,6 +28,10 @@
  ***************************************************************************/
 #include "CEGUI/DataContainer.h"
 
+#if !defined(__WIN32__) && !defined(_WIN32) && !defined(__ANDROID__)
+#   include <sys/mman.h>
+#endif
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -36,10 +40,16 @@ void RawDataContainer::release(void)
 {
     if (mData)
     {
-        delete[] mData;
+#if !defined(__WIN32__) && !defined(_WIN32) && !defined(__ANDROID__)
+        if (mMapped)
+            munmap(mData, mSize);
+        else
+#endif
+            delete[] mData;
 
         mData = nullptr;
         mSize = 0;
+        mMapped = false;
     }
 }
 
@@ -71,6 +71,8 @@ void DefaultLogger::logEvent(const String& message,
 {
     using namespace std;
 
+    lock_guard<mutex> lock(d_mutex);
+
     time_t et;
     time(&et);
     tm* etm = localtime(&et);
@@ -164,6 +166,8 @@ void DefaultLogger::logEvent(const String& message,
 //----------------------------------------------------------------------------//
 void DefaultLogger::setLogFilename(const String& filename, bool append)
 {
+    std::unique_lock<std::mutex> lock(d_mutex);
+
     // close current log file (if any)
     if (d_ostream.is_open())
         d_ostream.close();
@@ -186,8 +190,12 @@ void DefaultLogger::setLogFilename(const String& filename, bool append)
 #   endif
 
     if (!d_ostream)
+    {
+        // the exception logs itself
+        lock.unlock();
         throw FileIOException(
             "Failed to open file '" + filename + "' for writing");
+    }
 
     // initialise width for date & time alignment.
     d_ostream.width(2);
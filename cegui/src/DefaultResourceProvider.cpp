@@ -37,13 +37,60 @@
 #else
 #   include <sys/types.h>
 #   include <sys/stat.h>
+#   include <sys/mman.h>
 #   include <dirent.h>
 #   include <fnmatch.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#   define CEGUI_HAVE_MMAP
 #endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+#ifdef CEGUI_HAVE_MMAP
+//----------------------------------------------------------------------------//
+/*
+    Memory map the file \a path into \a output if it is at least \a threshold
+    bytes long. Returns false if the file should be read normally instead.
+*/
+static bool mapFile(const char* path, size_t threshold, RawDataContainer& output)
+{
+    const int fd = open(path, O_RDONLY);
+    if (fd == -1)
+        return false;
+
+    struct stat s;
+    if (fstat(fd, &s) != 0 || !S_ISREG(s.st_mode) || s.st_size == 0 ||
+        static_cast<size_t>(s.st_size) < threshold)
+    {
+        close(fd);
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(s.st_size);
+
+    // a private writable mapping keeps the RawDataContainer contract (a
+    // mutable buffer) intact; pages are only copied if somebody writes.
+    void* const data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE, fd, 0);
+    // the mapping holds its own reference to the file
+    close(fd);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    output.setMappedData(static_cast<std::uint8_t*>(data), size);
+    return true;
+}
+#endif
+
+//----------------------------------------------------------------------------//
+DefaultResourceProvider::DefaultResourceProvider() :
+    d_memoryMappingEnabled(false),
+    d_memoryMappingThreshold(64 * 1024)
+{
+}
 
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::loadRawDataContainer(const String& filename,
@@ -82,10 +129,16 @@ void DefaultResourceProvider::loadRawDataContainer(const String& filename,
     FILE* file = _wfopen(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), L"rb");
 #   else
 #       if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
-        FILE* file = fopen(String::convertUtf32ToUtf8(final_filename.getString()).c_str(), "rb");
+        const std::string native_filename(String::convertUtf32ToUtf8(final_filename.getString()));
 #       else
-        FILE* file = fopen(final_filename.c_str(), "rb");
+        const std::string native_filename(final_filename.c_str());
 #       endif
+
+    if (d_memoryMappingEnabled &&
+        mapFile(native_filename.c_str(), d_memoryMappingThreshold, output))
+        return;
+
+    FILE* file = fopen(native_filename.c_str(), "rb");
 #   endif
     
     if (file == nullptr)
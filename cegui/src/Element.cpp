@@ -35,6 +35,7 @@
 #include "CEGUI/System.h" // FIXME: only for root container size - display size
 #include "CEGUI/Renderer.h" // FIXME: only for root container size - display size
 #include "CEGUI/Logger.h"
+#include "CEGUI/Exceptions.h"
 
 #include <algorithm>
 
@@ -59,6 +60,10 @@ const String Element::EventZOrderChanged("ZOrderChanged");
 const String Element::EventNonClientChanged("NonClientChanged");
 const String Element::EventIsSizeAdjustedToContentChanged("IsSizeAdjustedToContentChanged");
 
+unsigned int Element::d_areaChangeBatchDepth = 0;
+bool Element::d_applyingAreaChanges = false;
+std::vector<Element*> Element::d_pendingAreaChanges;
+
 //----------------------------------------------------------------------------//
 // NB: we promised not to change incoming elements, but we don't want to prevent users from changing return values
 std::pair<Element*, Element*> Element::getSiblingsInCommonAncestor(const Element* e1, const Element* e2)
@@ -135,6 +140,87 @@ Element::Element():
     addElementProperties();
 }
 
+//----------------------------------------------------------------------------//
+Element::~Element()
+{
+    // Don't leave a dangling pointer in the batch. While changes are applied,
+    // the list may also hold elements whose changes were applied already.
+    if (d_areaChangePending || d_applyingAreaChanges)
+        std::replace(d_pendingAreaChanges.begin(), d_pendingAreaChanges.end(),
+                     this, static_cast<Element*>(nullptr));
+}
+
+//----------------------------------------------------------------------------//
+void Element::beginAreaChangeBatch()
+{
+    ++d_areaChangeBatchDepth;
+}
+
+//----------------------------------------------------------------------------//
+void Element::endAreaChangeBatch()
+{
+    if (!d_areaChangeBatchDepth)
+        throw InvalidRequestException("There is no area change batch to end.");
+
+    // Batches opened by event handlers while applying changes are applied by
+    // the outer loop, which is still running
+    if (--d_areaChangeBatchDepth || d_applyingAreaChanges)
+        return;
+
+    // Parents are updated first. When a parent gets resized it updates all
+    // its children, which clears their recorded changes, so they are skipped.
+    std::vector<std::pair<size_t, Element*>> ordered;
+    ordered.reserve(d_pendingAreaChanges.size());
+    for (Element* element : d_pendingAreaChanges)
+    {
+        if (!element)
+            continue;
+
+        size_t depth = 0;
+        for (const Element* curr = element->d_parent; curr; curr = curr->d_parent)
+            ++depth;
+
+        ordered.emplace_back(depth, element);
+    }
+
+    std::stable_sort(ordered.begin(), ordered.end(),
+        [](const std::pair<size_t, Element*>& a, const std::pair<size_t, Element*>& b)
+        {
+            return a.first < b.first;
+        });
+
+    d_pendingAreaChanges.clear();
+    for (const auto& entry : ordered)
+        d_pendingAreaChanges.push_back(entry.second);
+
+    d_applyingAreaChanges = true;
+
+    try
+    {
+        // New changes may be recorded by event handlers while we are here,
+        // so the list may grow and must be accessed by index
+        for (size_t i = 0; i < d_pendingAreaChanges.size(); ++i)
+        {
+            Element* element = d_pendingAreaChanges[i];
+            if (element && element->d_areaChangePending)
+                element->notifyScreenAreaChanged(element->d_areaChangeAdjustSize);
+        }
+    }
+    catch (...)
+    {
+        for (Element* element : d_pendingAreaChanges)
+            if (element)
+                element->d_areaChangePending = false;
+
+        d_pendingAreaChanges.clear();
+        d_applyingAreaChanges = false;
+        throw;
+    }
+
+    d_pendingAreaChanges.clear();
+    d_applyingAreaChanges = false;
+}
+
 //----------------------------------------------------------------------------//
 void Element::setArea(const UVector2& pos, const USize& size, bool adjust_size_to_content)
 {
@@ -148,6 +234,23 @@ void Element::setArea(const UVector2& pos, const USize& size, bool adjust_size_t
 //----------------------------------------------------------------------------//
 void Element::notifyScreenAreaChanged(bool adjust_size_to_content)
 {
+    // Only record the change while batching, it is applied when the batch ends
+    if (d_areaChangeBatchDepth)
+    {
+        if (!d_areaChangePending)
+        {
+            d_areaChangePending = true;
+            d_areaChangeAdjustSize = false;
+            d_pendingAreaChanges.push_back(this);
+        }
+
+        d_areaChangeAdjustSize |= adjust_size_to_content;
+        return;
+    }
+
+    // This supersedes a change recorded earlier, if any
+    d_areaChangePending = false;
+
     // Update pixel size and detect resizing
     const Sizef oldSize = d_pixelSize;
     d_pixelSize = calculatePixelSize();
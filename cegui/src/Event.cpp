@@ -31,6 +31,9 @@
 
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+// number of subscriptions made to any Event so far
+static std::uint64_t s_subscriptionSequence = 0;
 
 //----------------------------------------------------------------------------//
 Event::Event(const String& name) :
@@ -54,6 +57,7 @@ Event::Connection Event::subscribe(const Event::Subscriber& slot)
 Event::Connection Event::subscribe(Event::Group group, const Event::Subscriber& slot)
 {
     Event::Connection c(new BoundSlot(group, slot, *this));
+    c->d_sequence = ++s_subscriptionSequence;
     d_slots.insert(std::pair<Group, Connection>(group, c));
     return c;
 }
@@ -75,6 +79,37 @@ void Event::unsubscribeAll()
         d_slots.clear();
 }
 
+//----------------------------------------------------------------------------//
+std::uint64_t Event::getSubscriptionSequence()
+{
+    return s_subscriptionSequence;
+}
+
+//----------------------------------------------------------------------------//
+void Event::unsubscribeAfter(std::uint64_t sequence)
+{
+    for (auto it = d_slots.begin(); it != d_slots.end(); )
+    {
+        if (!it->second || it->second->d_sequence <= sequence)
+        {
+            ++it;
+            continue;
+        }
+
+        // same as unsubscribeAll, for this slot only
+        it->second->d_event = nullptr;
+        it->second->d_subscriber->cleanup();
+
+        if (d_isBeingInvoked)
+        {
+            it->second = nullptr;
+            ++it;
+        }
+        else
+            it = d_slots.erase(it);
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Event::operator()(EventArgs& args)
 {
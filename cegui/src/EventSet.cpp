@@ -59,6 +59,13 @@ void EventSet::addEvent(Event& event)
     d_events.emplace(event.getName(), &event);
 }
 
+//----------------------------------------------------------------------------//
+void EventSet::unsubscribeAfter(std::uint64_t sequence)
+{
+    for (auto& nameAndEvent : d_events)
+        nameAndEvent.second->unsubscribeAfter(sequence);
+}
+
 //----------------------------------------------------------------------------//
 Event::Connection EventSet::subscribeScriptedEvent(const String& name,
                                                    const String& subscriber_name)
@@ -0,0 +1,483 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/FrameProfiler.h"
+#include "CEGUI/Exceptions.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const std::uint32_t FrameProfiler::NoParent;
+const std::uint32_t FrameProfiler::NoDetail;
+const std::uint64_t FrameProfiler::InvalidScope;
+std::atomic<bool> FrameProfiler::s_active(false);
+
+namespace
+{
+//! duration of events that have not ended yet.
+const std::uint64_t OpenEventDuration = ~std::uint64_t(0);
+//! number of threads that have not recorded a scope yet.
+const std::uint32_t UnassignedThread = 0xFFFFFFFF;
+
+//! state of the profiler.
+struct ProfilerState
+{
+    std::mutex d_mutex;
+
+    std::chrono::steady_clock::time_point d_epoch;
+    bool d_epochSet = false;
+
+    //! incremented for every frame; identifies the frame a scope belongs to.
+    std::uint32_t d_frameSerial = 0;
+    FrameProfiler::Frame d_currentFrame;
+    std::uint64_t d_nextFrameNumber = 0;
+
+    std::deque<FrameProfiler::Frame> d_frames;
+    size_t d_frameHistorySize = 120;
+    size_t d_maxEventsPerFrame = 1 << 20;
+
+    std::vector<std::string> d_details;
+    std::unordered_map<String, std::uint32_t> d_detailIndices;
+
+    std::uint32_t d_nextThread = 0;
+};
+
+ProfilerState& getState()
+{
+    static ProfilerState state;
+    return state;
+}
+
+//! per thread scope nesting.
+struct ThreadState
+{
+    std::uint32_t d_thread = UnassignedThread;
+    std::uint32_t d_frameSerial = 0;
+    std::uint32_t d_currentEvent = FrameProfiler::NoParent;
+};
+
+thread_local ThreadState t_threadState;
+
+//! orders call tree nodes by parent, name and detail.
+struct CallTreeKey
+{
+    std::uint32_t d_parent;
+    const char* d_name;
+    std::uint32_t d_detail;
+
+    bool operator<(const CallTreeKey& other) const
+    {
+        if (d_parent != other.d_parent)
+            return d_parent < other.d_parent;
+        if (d_detail != other.d_detail)
+            return d_detail < other.d_detail;
+        return std::strcmp(d_name, other.d_name) < 0;
+    }
+};
+
+std::uint64_t now(ProfilerState& state)
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - state.d_epoch).count());
+}
+
+void beginFrame(ProfilerState& state, std::uint64_t time)
+{
+    ++state.d_frameSerial;
+    state.d_currentFrame.d_number = state.d_nextFrameNumber++;
+    state.d_currentFrame.d_start = time;
+    state.d_currentFrame.d_duration = 0;
+    state.d_currentFrame.d_events.clear();
+    state.d_currentFrame.d_callTree.clear();
+    state.d_currentFrame.d_droppedEvents = 0;
+}
+
+void buildCallTree(FrameProfiler::Frame& frame)
+{
+    std::map<CallTreeKey, std::uint32_t> nodes;
+    std::vector<std::uint32_t> eventNodes(frame.d_events.size());
+
+    // parents are always entered, and therefore recorded, before children
+    for (size_t i = 0; i < frame.d_events.size(); ++i)
+    {
+        const FrameProfiler::Event& event = frame.d_events[i];
+        const std::uint32_t parentNode = (event.d_parent == FrameProfiler::NoParent) ?
+            FrameProfiler::NoParent : eventNodes[event.d_parent];
+
+        const CallTreeKey key = { parentNode, event.d_name, event.d_detail };
+        auto it = nodes.find(key);
+        if (it == nodes.end())
+        {
+            const FrameProfiler::ScopeStatistics node =
+                { event.d_name, event.d_detail, parentNode, 0, 0, 0 };
+            frame.d_callTree.push_back(node);
+            it = nodes.emplace(key, static_cast<std::uint32_t>(frame.d_callTree.size() - 1)).first;
+        }
+
+        eventNodes[i] = it->second;
+
+        FrameProfiler::ScopeStatistics& node = frame.d_callTree[it->second];
+        ++node.d_calls;
+        node.d_totalTime += event.d_duration;
+        node.d_selfTime += event.d_duration;
+
+        if (parentNode != FrameProfiler::NoParent)
+        {
+            FrameProfiler::ScopeStatistics& parent = frame.d_callTree[parentNode];
+            parent.d_selfTime -= std::min(parent.d_selfTime, event.d_duration);
+        }
+    }
+}
+
+void writeJsonString(std::ostream& out, const char* str)
+{
+    out << '"';
+    for (; *str; ++str)
+    {
+        const unsigned char c = static_cast<unsigned char>(*str);
+        if (c == '"' || c == '\\')
+            out << '\\' << *str;
+        else if (c < 0x20)
+        {
+            static const char hex[] = "0123456789abcdef";
+            out << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+        }
+        else
+            out << *str;
+    }
+    out << '"';
+}
+
+void writeMicroseconds(std::ostream& out, std::uint64_t nanoseconds)
+{
+    out << nanoseconds / 1000 << '.';
+    const std::uint64_t fraction = nanoseconds % 1000;
+    out << static_cast<char>('0' + fraction / 100)
+        << static_cast<char>('0' + fraction / 10 % 10)
+        << static_cast<char>('0' + fraction % 10);
+}
+
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::setActive(bool setting)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    if (setting == s_active.load(std::memory_order_relaxed))
+        return;
+
+    if (setting)
+    {
+        if (!state.d_epochSet)
+        {
+            state.d_epoch = std::chrono::steady_clock::now();
+            state.d_epochSet = true;
+        }
+
+        beginFrame(state, now(state));
+    }
+    else
+    {
+        // scopes still open end up referring to a frame that no longer exists
+        ++state.d_frameSerial;
+        state.d_currentFrame.d_events.clear();
+    }
+
+    s_active.store(setting, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::markFrameEnd()
+{
+    if (!isActive())
+        return;
+
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    if (!s_active.load(std::memory_order_relaxed))
+        return;
+
+    const std::uint64_t time = now(state);
+    Frame& frame = state.d_currentFrame;
+    frame.d_duration = time - frame.d_start;
+
+    // scopes that are still open are cut off at the end of the frame
+    for (Event& event : frame.d_events)
+        if (event.d_duration == OpenEventDuration)
+            event.d_duration = time - event.d_start;
+
+    buildCallTree(frame);
+
+    if (state.d_frameHistorySize)
+    {
+        while (state.d_frames.size() >= state.d_frameHistorySize)
+            state.d_frames.pop_front();
+
+        state.d_frames.push_back(std::move(frame));
+    }
+
+    beginFrame(state, time);
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::setFrameHistorySize(size_t frames)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    state.d_frameHistorySize = frames;
+    while (state.d_frames.size() > frames)
+        state.d_frames.pop_front();
+}
+
+//----------------------------------------------------------------------------//
+size_t FrameProfiler::getFrameHistorySize()
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+    return state.d_frameHistorySize;
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::setMaxEventsPerFrame(size_t events)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+    state.d_maxEventsPerFrame = std::min<size_t>(events, NoParent);
+}
+
+//----------------------------------------------------------------------------//
+size_t FrameProfiler::getMaxEventsPerFrame()
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+    return state.d_maxEventsPerFrame;
+}
+
+//----------------------------------------------------------------------------//
+std::vector<FrameProfiler::Frame> FrameProfiler::getFrames()
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+    return std::vector<Frame>(state.d_frames.begin(), state.d_frames.end());
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::clearFrames()
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+    state.d_frames.clear();
+}
+
+//----------------------------------------------------------------------------//
+String FrameProfiler::getDetail(std::uint32_t index)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    if (index >= state.d_details.size())
+        return String();
+
+    return String(state.d_details[index]);
+}
+
+//----------------------------------------------------------------------------//
+std::vector<FrameProfiler::ScopeStatistics> FrameProfiler::getScopeTotals(const Frame& frame)
+{
+    std::map<CallTreeKey, size_t> indices;
+    std::vector<ScopeStatistics> totals;
+
+    for (const ScopeStatistics& node : frame.d_callTree)
+    {
+        const CallTreeKey key = { NoParent, node.d_name, node.d_detail };
+        auto it = indices.find(key);
+        if (it == indices.end())
+        {
+            const ScopeStatistics total = { node.d_name, node.d_detail, NoParent, 0, 0, 0 };
+            totals.push_back(total);
+            it = indices.emplace(key, totals.size() - 1).first;
+        }
+
+        ScopeStatistics& total = totals[it->second];
+        total.d_calls += node.d_calls;
+        total.d_totalTime += node.d_totalTime;
+        total.d_selfTime += node.d_selfTime;
+    }
+
+    return totals;
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::writeChromeTrace(std::ostream& out)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+    for (const Frame& frame : state.d_frames)
+    {
+        // the frame itself is drawn on a track of its own
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "{\"name\":\"Frame " << frame.d_number
+            << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":";
+        writeMicroseconds(out, frame.d_start);
+        out << ",\"dur\":";
+        writeMicroseconds(out, frame.d_duration);
+        out << '}';
+
+        for (const Event& event : frame.d_events)
+        {
+            out << ",\n{\"name\":";
+            writeJsonString(out, event.d_name);
+            out << ",\"cat\":\"CEGUI\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.d_thread + 1
+                << ",\"ts\":";
+            writeMicroseconds(out, event.d_start);
+            out << ",\"dur\":";
+            writeMicroseconds(out, event.d_duration);
+            if (event.d_detail != NoDetail)
+            {
+                out << ",\"args\":{\"detail\":";
+                writeJsonString(out, state.d_details[event.d_detail].c_str());
+                out << '}';
+            }
+            out << '}';
+        }
+    }
+
+    out << "\n]}\n";
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::saveChromeTrace(const String& filename)
+{
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    std::ofstream file(String::convertUtf32ToUtf8(filename.getString()).c_str(),
+                       std::ios::binary | std::ios::trunc);
+#else
+    std::ofstream file(filename.c_str(), std::ios::binary | std::ios::trunc);
+#endif
+
+    if (file)
+        writeChromeTrace(file);
+
+    if (!file)
+        throw FileIOException("Failed to write the profile to '" + filename + "'");
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t FrameProfiler::beginScope(const char* name, const String* detail)
+{
+    ThreadState& thread = t_threadState;
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    if (!s_active.load(std::memory_order_relaxed))
+        return InvalidScope;
+
+    Frame& frame = state.d_currentFrame;
+    if (frame.d_events.size() >= state.d_maxEventsPerFrame)
+    {
+        ++frame.d_droppedEvents;
+        return InvalidScope;
+    }
+
+    if (thread.d_thread == UnassignedThread)
+        thread.d_thread = state.d_nextThread++;
+
+    // nesting information of an earlier frame does not apply
+    if (thread.d_frameSerial != state.d_frameSerial)
+    {
+        thread.d_frameSerial = state.d_frameSerial;
+        thread.d_currentEvent = NoParent;
+    }
+
+    std::uint32_t detailIndex = NoDetail;
+    if (detail)
+    {
+        auto it = state.d_detailIndices.find(*detail);
+        if (it == state.d_detailIndices.end())
+        {
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+            state.d_details.push_back(String::convertUtf32ToUtf8(detail->getString()));
+#else
+            state.d_details.push_back(std::string(detail->c_str(), detail->size()));
+#endif
+            it = state.d_detailIndices.emplace(
+                *detail, static_cast<std::uint32_t>(state.d_details.size() - 1)).first;
+        }
+        detailIndex = it->second;
+    }
+
+    const Event event = { name, detailIndex, thread.d_currentEvent, thread.d_thread,
+                          now(state), OpenEventDuration };
+    frame.d_events.push_back(event);
+
+    const std::uint32_t index = static_cast<std::uint32_t>(frame.d_events.size() - 1);
+    thread.d_currentEvent = index;
+
+    return (static_cast<std::uint64_t>(state.d_frameSerial) << 32) | index;
+}
+
+//----------------------------------------------------------------------------//
+void FrameProfiler::endScope(std::uint64_t scope)
+{
+    const std::uint32_t frameSerial = static_cast<std::uint32_t>(scope >> 32);
+    const std::uint32_t index = static_cast<std::uint32_t>(scope);
+
+    ThreadState& thread = t_threadState;
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.d_mutex);
+
+    // the frame of the scope has already ended
+    if (frameSerial != state.d_frameSerial)
+        return;
+
+    Event& event = state.d_currentFrame.d_events[index];
+    event.d_duration = now(state) - event.d_start;
+    thread.d_currentEvent = event.d_parent;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
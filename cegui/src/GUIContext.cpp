@@ -25,10 +25,14 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/GUIContext.h"
+#include "CEGUI/FrameProfiler.h"
 #include "CEGUI/Renderer.h"
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/RenderingContext.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryRecorder.h"
+#include "CEGUI/ParallelGeometryGenerator.h"
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/FontManager.h"
@@ -38,6 +42,7 @@
 #include "CEGUI/GlobalEventSet.h"
 #include "CEGUI/CoordConverter.h"
 #include <algorithm>
+#include <cmath>
 
 namespace CEGUI
 {
@@ -279,6 +284,11 @@ Window* GUIContext::getWindowContainingCursor()
 //----------------------------------------------------------------------------//
 void GUIContext::draw(std::uint32_t drawModeMask)
 {
+    CEGUI_PROFILE_SCOPE("GUIContext::draw");
+
+    if (d_autoCaching && ++d_autoCacheFrames >= d_autoCacheInterval)
+        evaluateAutoCache();
+
     // Cursor is always dirty because it must be redrawn each frame
     const bool drawCursor = (drawModeMask & DrawModeFlagMouseCursor);
     
@@ -346,6 +356,19 @@ void GUIContext::drawWindowContentToTarget(std::uint32_t drawModeMask)
 
     if (d_rootWindow)
     {
+        if (d_geometryGenerator)
+            generateGeometryInParallel(drawModeMask);
+
+        if (d_drawListValid && drawModeMask == d_drawListDrawModeMask &&
+            redrawRetainedWindows(drawModeMask))
+        {
+            d_dirtyDrawModeMask &= (~drawModeMask);
+            return;
+        }
+
+        d_redrawWindows.clear();
+        d_redrawWindowSet.clear();
+
         // Draw the window hierarchy to surfaces
         if (RenderingSurface* rs = d_rootWindow->getTargetRenderingSurface())
         {
@@ -354,6 +377,12 @@ void GUIContext::drawWindowContentToTarget(std::uint32_t drawModeMask)
             if (rs->isRenderingWindow())
                 static_cast<RenderingWindow*>(rs)->getOwner().clearGeometry();
 
+            // anything marking the context as dirty while drawing invalidates
+            // the new list again, after which geometry is queued as usual.
+            ++d_drawListGeneration;
+            d_drawListDrawModeMask = drawModeMask;
+            d_drawListValid = d_retainedDrawList && rs == this;
+
             d_rootWindow->draw(drawModeMask);
         }
     }
@@ -366,6 +395,324 @@ void GUIContext::drawWindowContentToTarget(std::uint32_t drawModeMask)
     d_dirtyDrawModeMask &= (~drawModeMask);
 }
 
+//----------------------------------------------------------------------------//
+bool GUIContext::redrawRetainedWindows(std::uint32_t drawModeMask)
+{
+    // NB: the list may grow while windows are redrawn
+    for (size_t i = 0; i < d_redrawWindows.size(); ++i)
+    {
+        Window* const wnd = d_redrawWindows[i];
+        const bool wasQueued = (wnd->d_drawListGeneration == d_drawListGeneration);
+
+        if (!wnd->isEffectiveVisible() ||
+            !wnd->checkIfDrawMaskAllowsDrawing(drawModeMask))
+        {
+            if (wasQueued)
+                return false;
+
+            continue;
+        }
+
+        RenderingContext ctx;
+        wnd->getRenderingContext(ctx);
+
+        // windows rendered to textures are drawn through their owners
+        if (ctx.surface != this)
+            return false;
+
+        // the window must queue its geometry exactly when it did before,
+        // since its position in the queue is only known in that case.
+        d_lastQueuedWindow = nullptr;
+        d_redrawingRetainedWindows = true;
+        wnd->drawSelf(ctx, drawModeMask);
+        d_redrawingRetainedWindows = false;
+
+        if (wasQueued != (d_lastQueuedWindow == wnd))
+            return false;
+    }
+
+    d_redrawWindows.clear();
+    d_redrawWindowSet.clear();
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::generateGeometryInParallel(std::uint32_t drawModeMask)
+{
+    CEGUI_PROFILE_SCOPE("GUIContext::generateGeometryInParallel");
+
+    d_windowsToRedraw.clear();
+
+    // when only the retained windows get redrawn, they are all that is needed
+    if (d_drawListValid && drawModeMask == d_drawListDrawModeMask)
+    {
+        for (Window* wnd : d_redrawWindows)
+            if (wnd->isEffectiveVisible() && wnd->checkIfDrawMaskAllowsDrawing(drawModeMask))
+                d_windowsToRedraw.push_back(wnd);
+    }
+    else
+    {
+        collectWindowsToRedraw(*d_rootWindow, drawModeMask, d_windowsToRedraw);
+    }
+
+    d_geometryGenerator->generate(d_windowsToRedraw);
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::collectWindowsToRedraw(Window& window, std::uint32_t drawModeMask,
+                                        std::vector<Window*>& windows) const
+{
+    // this follows Window::draw
+    if (!window.isVisible())
+        return;
+
+    if (window.d_surface && !window.d_surface->isInvalidated())
+        return;
+
+    if (window.d_needsRedraw && window.checkIfDrawMaskAllowsDrawing(drawModeMask))
+        windows.push_back(&window);
+
+    for (auto wnd : window.d_drawList)
+        collectWindowsToRedraw(*wnd, drawModeMask, windows);
+}
+
+//----------------------------------------------------------------------------//
+GeometryRecorder& GUIContext::getGeometryRecorder()
+{
+    if (!d_geometryRecorder)
+        d_geometryRecorder = std::make_unique<GeometryRecorder>(
+            *System::getSingleton().getRenderer());
+
+    return *d_geometryRecorder;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setParallelGeometryGenerationEnabled(bool setting, unsigned int threadCount)
+{
+    if (setting == (d_geometryGenerator != nullptr))
+        return;
+
+    if (setting)
+        d_geometryGenerator = std::make_unique<ParallelGeometryGenerator>(threadCount);
+    else
+        d_geometryGenerator.reset();
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::invalidateDrawList()
+{
+    d_drawListValid = false;
+
+    // the queues must not keep referring to the geometry lists of windows that
+    // may be going away.
+    for (auto& queue : d_queues)
+        queue.second.resolveGeometryBufferLists();
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::markWindowForRedraw(Window& window)
+{
+    if (!d_drawListValid)
+    {
+        markAsDirty();
+        return;
+    }
+
+    if (d_redrawWindowSet.insert(&window).second)
+        d_redrawWindows.push_back(&window);
+
+    d_dirtyDrawModeMask |= DrawModeMaskAll;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setRetainedDrawListEnabled(bool setting)
+{
+    if (d_retainedDrawList == setting)
+        return;
+
+    d_retainedDrawList = setting;
+    markAsDirty();
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::queueWindowGeometry(Window& window, const RenderingContext& ctx)
+{
+    if (d_redrawingRetainedWindows)
+    {
+        // the queue already references the geometry list of the window
+        d_lastQueuedWindow = &window;
+    }
+    else if (d_drawListValid && ctx.surface == this)
+    {
+        ctx.surface->addGeometryBufferList(ctx.queue, window.d_geometryBuffers);
+        window.d_drawListGeneration = d_drawListGeneration;
+    }
+    else
+    {
+        ctx.surface->addGeometryBuffers(ctx.queue, window.d_geometryBuffers);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setAutoCachingEnabled(bool setting)
+{
+    if (d_autoCaching == setting)
+        return;
+
+    d_autoCaching = setting;
+    d_autoCacheFrames = 0;
+
+    if (setting)
+        return;
+
+    for (const auto& entry : d_autoCacheEntries)
+        if (entry.cached)
+            setWindowAutoCached(*entry.window, false);
+
+    d_autoCacheEntries.clear();
+    d_autoCacheTextureMemory = 0;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::evaluateAutoCache()
+{
+    d_autoCacheFrames = 0;
+    d_autoCacheEntries.clear();
+
+    if (d_rootWindow)
+    {
+        std::uint32_t changes = 0;
+        collectAutoCacheEntries(*d_rootWindow, false, changes);
+    }
+
+    // cheapest to cache first: most vertices saved per texture byte
+    std::sort(d_autoCacheEntries.begin(), d_autoCacheEntries.end(),
+        [](const AutoCacheEntry& a, const AutoCacheEntry& b)
+        {
+            return a.vertexCount * b.textureBytes > b.vertexCount * a.textureBytes;
+        });
+
+    // keep cached windows that don't churn, for as long as they fit the budget
+    size_t memory = 0;
+    for (auto& entry : d_autoCacheEntries)
+    {
+        if (!entry.cached)
+            continue;
+
+        if (entry.changes >= d_autoCacheDemotionThreshold ||
+            memory + entry.textureBytes > d_autoCacheTextureBudget)
+        {
+            setWindowAutoCached(*entry.window, false);
+            entry.cached = false;
+        }
+        else
+        {
+            memory += entry.textureBytes;
+        }
+    }
+
+    for (auto& entry : d_autoCacheEntries)
+    {
+        if (entry.cached || entry.stableIntervals < d_autoCachePromotionDelay ||
+            memory + entry.textureBytes > d_autoCacheTextureBudget)
+            continue;
+
+        // textures are not nested: skip windows related to a cached one
+        const bool related = std::any_of(d_autoCacheEntries.begin(), d_autoCacheEntries.end(),
+            [&entry](const AutoCacheEntry& other)
+            {
+                return other.cached && (other.window->isDescendantOf(entry.window) ||
+                                        entry.window->isDescendantOf(other.window));
+            });
+
+        if (related)
+            continue;
+
+        setWindowAutoCached(*entry.window, true);
+        entry.cached = entry.window->d_autoCached;
+        if (entry.cached)
+            memory += entry.textureBytes;
+    }
+
+    d_autoCacheTextureMemory = memory;
+}
+
+//----------------------------------------------------------------------------//
+size_t GUIContext::collectAutoCacheEntries(Window& window, bool underSurface,
+                                           std::uint32_t& changes)
+{
+    // the auto rendering surface may have been disabled by someone else
+    if (window.d_autoCached && !window.d_surface)
+        window.d_autoCached = false;
+
+    // hidden windows don't need a texture
+    if (!window.isVisible())
+    {
+        if (window.d_autoCached)
+            setWindowAutoCached(window, false);
+
+        return 0;
+    }
+
+    const bool ownSurface = window.d_surface != nullptr;
+
+    size_t vertexCount = 0;
+    for (const GeometryBuffer* buffer : window.d_geometryBuffers)
+        vertexCount += buffer->getVertexCount();
+
+    std::uint32_t subtreeChanges = window.d_autoCacheChanges;
+    window.d_autoCacheChanges = 0;
+
+    const size_t childCount = window.getChildCount();
+    for (size_t i = 0; i < childCount; ++i)
+    {
+        std::uint32_t childChanges = 0;
+        vertexCount += collectAutoCacheEntries(*window.getChildAtIndex(i),
+                                               underSurface || ownSurface,
+                                               childChanges);
+
+        // changes inside a cached window are counted as texture redraws
+        if (!window.d_autoCached)
+            subtreeChanges += childChanges;
+    }
+
+    window.d_autoCacheStableIntervals =
+        subtreeChanges ? 0 : window.d_autoCacheStableIntervals + 1;
+    changes = subtreeChanges;
+
+    const Sizef& size = window.getPixelSize();
+    const size_t textureBytes = static_cast<size_t>(std::ceil(size.d_width)) *
+        static_cast<size_t>(std::ceil(size.d_height)) * 4;
+
+    const bool candidate = !underSurface && !ownSurface && &window != d_rootWindow &&
+        vertexCount >= d_autoCacheMinVertexCount && textureBytes;
+
+    if (window.d_autoCached || candidate)
+    {
+        d_autoCacheEntries.push_back({ &window, window.d_autoCached, vertexCount,
+            textureBytes, subtreeChanges, window.d_autoCacheStableIntervals });
+    }
+
+    return vertexCount;
+}
+
+//----------------------------------------------------------------------------//
+void GUIContext::setWindowAutoCached(Window& window, bool setting)
+{
+    // leave surfaces alone that were not enabled by us
+    if (!setting && !window.d_autoCached)
+        return;
+
+    window.d_autoCacheChanges = 0;
+    window.setUsingAutoRenderingSurface(setting);
+
+    // TextureTargets may not be available
+    if (setting && !window.d_surface)
+        window.setUsingAutoRenderingSurface(false);
+    else
+        window.d_autoCached = setting;
+}
+
 //----------------------------------------------------------------------------//
 bool GUIContext::areaChangedHandler(const EventArgs&)
 {
@@ -436,6 +783,20 @@ void GUIContext::onWindowDetached(Window* window)
 
     if(d_clickTracker.firstWindow == window || d_clickTracker.lastWindow == window)
         resetClickTracker();
+
+    // textures allocated by automatic caching are not kept for other contexts
+    if (window->d_autoCached)
+        setWindowAutoCached(*window, false);
+
+    auto itEntry = std::find_if(d_autoCacheEntries.begin(), d_autoCacheEntries.end(),
+        [window](const AutoCacheEntry& entry) { return entry.window == window; });
+    if (itEntry != d_autoCacheEntries.end())
+    {
+        if (itEntry->cached)
+            d_autoCacheTextureMemory -= itEntry->textureBytes;
+
+        d_autoCacheEntries.erase(itEntry);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -812,6 +1173,11 @@ Window* GUIContext::getInputTargetWindow() const
 //----------------------------------------------------------------------------//
 bool GUIContext::injectTimePulse(float timeElapsed)
 {
+    CEGUI_PROFILE_SCOPE("GUIContext::injectTimePulse");
+
+    if (d_inputQueue)
+        d_inputQueue->drain(*this);
+
     if (!d_rootWindow)
         return false;
 
@@ -826,6 +1192,23 @@ bool GUIContext::injectTimePulse(float timeElapsed)
     return true;
 }
 
+//----------------------------------------------------------------------------//
+void GUIContext::setInputQueueEnabled(bool setting, size_t capacity)
+{
+    if (setting == (d_inputQueue != nullptr))
+        return;
+
+    if (setting)
+    {
+        d_inputQueue = std::make_unique<InputQueue>(capacity);
+    }
+    else
+    {
+        d_inputQueue->drain(*this);
+        d_inputQueue.reset();
+    }
+}
+
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMousePosition(float x, float y)
 {
@@ -31,6 +31,7 @@
 #include "CEGUI/Renderer.h" // for BlendMode
 #include "CEGUI/RenderMaterial.h"
 #include "CEGUI/ColourRect.h"
+#include "CEGUI/Exceptions.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <cstring>
 
@@ -96,6 +97,79 @@ void GeometryBuffer::appendGeometry(const float* vertexArray, size_t arraySize)
     onGeometryChanged();
 }
 
+//---------------------------------------------------------------------------//
+void GeometryBuffer::updateVertices(size_t firstVertex, const float* vertexArray,
+                                    size_t arraySize)
+{
+    if (!arraySize)
+        return;
+
+    const size_t stride = static_cast<size_t>(getVertexAttributeElementCount());
+    const size_t firstFloat = firstVertex * stride;
+
+    if (!vertexArray || arraySize % stride != 0 ||
+        firstFloat + arraySize > d_vertexData.size())
+        throw InvalidRequestException(
+            "The vertices to update do not lie within the existing vertex data.");
+
+    // narrow the range down to the vertices that actually change
+    float* const dest = d_vertexData.data() + firstFloat;
+    size_t begin = 0;
+    while (begin < arraySize && dest[begin] == vertexArray[begin])
+        ++begin;
+
+    if (begin == arraySize)
+        return;
+
+    size_t end = arraySize;
+    while (dest[end - 1] == vertexArray[end - 1])
+        --end;
+
+    begin -= begin % stride;
+    end += (stride - end % stride) % stride;
+
+    std::memcpy(dest + begin, vertexArray + begin, (end - begin) * sizeof(float));
+
+    onGeometryRangeChanged(firstVertex + begin / stride, (end - begin) / stride);
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isLayoutCompatible(const GeometryBuffer& other) const
+{
+    return d_vertexData.size() == other.d_vertexData.size() &&
+           d_vertexAttributes == other.d_vertexAttributes &&
+           d_renderMaterial->getShaderWrapper() == other.d_renderMaterial->getShaderWrapper();
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::updateFrom(const GeometryBuffer& other)
+{
+    if (!isLayoutCompatible(other))
+        throw InvalidRequestException(
+            "The GeometryBuffer to update from has a different layout.");
+
+    updateVertices(0, other.d_vertexData.data(), other.d_vertexData.size());
+    d_renderMaterial->copyParametersFrom(*other.d_renderMaterial);
+    copyRenderSettings(other);
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::copyRenderSettings(const GeometryBuffer& other)
+{
+    setBlendMode(other.d_blendMode);
+    d_polygonFillRule = other.d_polygonFillRule;
+    d_postStencilVertexCount = other.d_postStencilVertexCount;
+    setClippingActive(other.d_clippingActive);
+    setClippingRegion(other.d_clippingRegion);
+    setTranslation(other.d_translation);
+    setRotation(other.d_rotation);
+    setScale(other.d_scale);
+    setPivot(other.d_pivot);
+    setCustomTransform(other.d_customTransform);
+    d_alpha = other.d_alpha;
+    setRenderEffect(other.d_effect);
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::appendSolidRect(const Rectf& rect, const ColourRect& colours)
 {
@@ -0,0 +1,188 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GeometryRecorder.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/Vertex.h"
+
+namespace CEGUI
+{
+namespace
+{
+thread_local GeometryRecorder* t_currentRecorder = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+class GeometryRecorder::RecordedGeometryBuffer : public GeometryBuffer
+{
+public:
+    RecordedGeometryBuffer(const GeometryRecorder& owner, ShaderWrapper* shader,
+                           bool textured) :
+        GeometryBuffer(RefCounted<RenderMaterial>(new RenderMaterial(shader))),
+        d_owner(owner),
+        d_textured(textured)
+    {
+        // the layout used by the vertex types the geometry is built from
+        addVertexAttribute(VertexAttributeType::Position0);
+        addVertexAttribute(VertexAttributeType::Colour0);
+        if (textured)
+            addVertexAttribute(VertexAttributeType::TexCoord0);
+    }
+
+    void draw(std::uint32_t /*drawModeMask*/) const override {}
+
+    const GeometryRecorder& d_owner;
+    const bool d_textured;
+    bool d_inUse = false;
+};
+
+//----------------------------------------------------------------------------//
+GeometryRecorder::GeometryRecorder(Renderer& renderer) :
+    d_renderer(renderer),
+    d_texturedShader(const_cast<ShaderWrapper*>(
+        renderer.createRenderMaterial(DefaultShaderType::Textured)->getShaderWrapper())),
+    d_colouredShader(const_cast<ShaderWrapper*>(
+        renderer.createRenderMaterial(DefaultShaderType::Solid)->getShaderWrapper()))
+{
+}
+
+//----------------------------------------------------------------------------//
+GeometryRecorder::~GeometryRecorder()
+{
+    if (t_currentRecorder == this)
+        t_currentRecorder = nullptr;
+
+    clear();
+
+    for (auto buffer : d_freeTexturedBuffers)
+        delete buffer;
+    for (auto buffer : d_freeColouredBuffers)
+        delete buffer;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryRecorder::setCurrent(GeometryRecorder* recorder)
+{
+    t_currentRecorder = recorder;
+}
+
+//----------------------------------------------------------------------------//
+GeometryRecorder* GeometryRecorder::getCurrent()
+{
+    return t_currentRecorder;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& GeometryRecorder::createGeometryBufferTextured()
+{
+    return createGeometryBuffer(true);
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& GeometryRecorder::createGeometryBufferColoured()
+{
+    return createGeometryBuffer(false);
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& GeometryRecorder::createGeometryBuffer(bool textured)
+{
+    auto& freeBuffers = textured ? d_freeTexturedBuffers : d_freeColouredBuffers;
+
+    RecordedGeometryBuffer* buffer;
+    if (freeBuffers.empty())
+    {
+        buffer = new RecordedGeometryBuffer(*this,
+            textured ? d_texturedShader : d_colouredShader, textured);
+    }
+    else
+    {
+        buffer = freeBuffers.back();
+        freeBuffers.pop_back();
+    }
+
+    buffer->d_inUse = true;
+    d_buffers.push_back(buffer);
+    return *buffer;
+}
+
+//----------------------------------------------------------------------------//
+bool GeometryRecorder::isRecorded(const GeometryBuffer& buffer) const
+{
+    auto recorded = dynamic_cast<const RecordedGeometryBuffer*>(&buffer);
+    return recorded && &recorded->d_owner == this && recorded->d_inUse;
+}
+
+//----------------------------------------------------------------------------//
+void GeometryRecorder::materialise(std::vector<GeometryBuffer*>& buffers) const
+{
+    for (auto& buffer : buffers)
+    {
+        if (!isRecorded(*buffer))
+            continue;
+
+        const auto& recorded = static_cast<const RecordedGeometryBuffer&>(*buffer);
+
+        GeometryBuffer& result = recorded.d_textured ?
+            d_renderer.createGeometryBufferTextured() :
+            d_renderer.createGeometryBufferColoured();
+
+        // the shaders are the same, so all the parameters can be taken over
+        result.getRenderMaterial()->copyParametersFrom(*recorded.getRenderMaterial());
+
+        const auto& vertices = recorded.getVertexData();
+        result.appendGeometry(vertices.data(), vertices.size());
+        result.copyRenderSettings(recorded);
+
+        buffer = &result;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void GeometryRecorder::clear()
+{
+    for (auto buffer : d_buffers)
+    {
+        buffer->clear();
+        buffer->d_inUse = false;
+
+        if (buffer->d_textured)
+        {
+            buffer->setMainTexture(nullptr);
+            d_freeTexturedBuffers.push_back(buffer);
+        }
+        else
+        {
+            d_freeColouredBuffers.push_back(buffer);
+        }
+    }
+
+    d_buffers.clear();
+}
+
+}
@@ -39,8 +39,16 @@
 #include "CEGUI/svg/SVGImage.h"
 #include "CEGUI/svg/SVGData.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/StagingTexture.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLSerializer.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <fstream>
 
 namespace CEGUI
 {
@@ -51,19 +59,6 @@ template<> ImageManager* Singleton<ImageManager>::ms_Singleton = nullptr;
 //----------------------------------------------------------------------------//
 String ImageManager::d_imagesetDefaultResourceGroup;
 
-//----------------------------------------------------------------------------//
-// predicate functor class to match items using a given prefix string.
-class ImagePrefixMatchPred
-{
-    const String d_prefix;
-
-public:
-    ImagePrefixMatchPred(const String& prefix) : d_prefix(prefix + '/') {}
-
-    bool operator()(const std::pair<String, std::pair<Image*, ImageFactory*> >& v)
-    { return v.first.find(d_prefix) == 0; }
-};
-
 //----------------------------------------------------------------------------//
 // Internal Strings holding XML element and attribute names
 const String ImagesetSchemaName("Imageset.xsd");
@@ -83,6 +78,77 @@ const String ImagesetVersionAttribute( "version" );
 // Internal Strings holding XML element and attribute defaults
 const String ImageTypeAttributeDefault( "BitmapImage" );
 
+// Strings used in atlas layout files
+const String AtlasLayoutElement("AtlasLayout");
+const String AtlasPageElement("Page");
+const String AtlasImageElement("Image");
+const String AtlasVersionAttribute("version");
+const String AtlasSizeAttribute("size");
+const String AtlasNameAttribute("name");
+const String AtlasPageAttribute("page");
+const String AtlasXAttribute("x");
+const String AtlasYAttribute("y");
+const String AtlasWidthAttribute("width");
+const String AtlasHeightAttribute("height");
+const String AtlasLayoutVersion("1");
+// Prefix of the names of atlas page textures
+const String AtlasPageTexturePrefix("ImageManager.AtlasPage");
+// Pixels around each image on an atlas page, filled with its edge pixels
+// so that filtering at the image border doesn't pick up its neighbours.
+const unsigned int AtlasPadding = 1;
+
+//----------------------------------------------------------------------------//
+// XMLHandler collecting the contents of an atlas layout file.
+class AtlasLayoutHandler : public XMLHandler
+{
+public:
+    struct Image
+    {
+        String d_name;
+        size_t d_page;
+        Rectf d_area;
+    };
+
+    std::vector<unsigned int> d_pageSizes;
+    std::vector<Image> d_images;
+
+    const String& getDefaultResourceGroup() const override
+    { return ImageManager::getImagesetDefaultResourceGroup(); }
+
+    void elementStart(const String& element, const XMLAttributes& attributes) override
+    {
+        if (element == AtlasLayoutElement)
+        {
+            if (attributes.getValueAsString(AtlasVersionAttribute) != AtlasLayoutVersion)
+                throw InvalidRequestException(
+                    "Unsupported atlas layout version: " +
+                    attributes.getValueAsString(AtlasVersionAttribute));
+        }
+        else if (element == AtlasPageElement)
+        {
+            d_pageSizes.push_back(static_cast<unsigned int>(
+                std::max(0, attributes.getValueAsInteger(AtlasSizeAttribute))));
+        }
+        else if (element == AtlasImageElement)
+        {
+            const int page = attributes.getValueAsInteger(AtlasPageAttribute, -1);
+            if (page < 0 || static_cast<size_t>(page) >= d_pageSizes.size())
+                throw InvalidRequestException(
+                    "Atlas layout refers to an undefined page for image '" +
+                    attributes.getValueAsString(AtlasNameAttribute) + "'.");
+
+            const glm::vec2 pos(attributes.getValueAsInteger(AtlasXAttribute),
+                                attributes.getValueAsInteger(AtlasYAttribute));
+            const Sizef size(
+                static_cast<float>(attributes.getValueAsInteger(AtlasWidthAttribute)),
+                static_cast<float>(attributes.getValueAsInteger(AtlasHeightAttribute)));
+
+            d_images.push_back({attributes.getValueAsString(AtlasNameAttribute),
+                                static_cast<size_t>(page), Rectf(pos, size)});
+        }
+    }
+};
+
 //----------------------------------------------------------------------------//
 // note: The assets' versions aren't usually the same as CEGUI version, they
 // are versioned from version 1 onwards!
@@ -100,6 +166,8 @@ static SVGData* s_SVGData = nullptr;
 static CEGUI::String s_imagesetType = "";
 static AutoScaledMode s_autoScaled = AutoScaledMode::Disabled;
 static Sizef s_nativeResolution(640.0f, 480.0f);
+// name of the last imageset started while parsing imageset XML
+static CEGUI::String s_imagesetName;
 
 //----------------------------------------------------------------------------//
 ImageManager::ImageManager()
@@ -165,7 +233,8 @@ Image& ImageManager::create(const String& type, const String& name)
 
     ImageFactory* factory = i->second;
     Image& image = factory->create(name);
-    d_images[name] = std::make_pair(&image, factory);
+    addToCollections(
+        d_images.emplace(name, std::make_pair(&image, factory)).first->first);
 
         String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
 
@@ -211,7 +280,8 @@ Image& ImageManager::create(const XMLAttributes& attributes)
         throw InvalidRequestException(message);
     }
 
-    d_images[name] = std::make_pair(&image, factory);
+    addToCollections(
+        d_images.emplace(name, std::make_pair(&image, factory)).first->first);
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(&image);
     Logger::getSingleton().logEvent(
@@ -245,14 +315,63 @@ void ImageManager::destroy(ImageMap::iterator& iter)
     // use the stored factory to destroy the image it created.
     iter->second.second->destroy(*iter->second.first);
 
+    if (!d_atlasPlacements.empty())
+        releaseAtlasPlacement(iter->first);
+
+    removeFromCollections(iter->first);
     d_images.erase(iter);
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::addToCollections(const String& name)
+{
+    // fast path for images of a collection created in bulk
+    if (d_openCollection)
+    {
+        const size_t length = d_openCollectionName.length();
+
+        if (name.length() > length + 1 && name[length] == '/' &&
+            name.compare(0, length, d_openCollectionName) == 0 &&
+            name.find('/', length + 1) == String::npos)
+        {
+            // the collection name may itself contain '/', whose parts are
+            // collections as well
+            for (size_t pos = name.find('/'); pos < length; pos = name.find('/', pos + 1))
+                d_collections[name.substr(0, pos)].insert(&name);
+
+            d_openCollection->insert(&name);
+            return;
+        }
+    }
+
+    for (size_t pos = name.find('/'); pos != String::npos; pos = name.find('/', pos + 1))
+        d_collections[name.substr(0, pos)].insert(&name);
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::removeFromCollections(const String& name)
+{
+    for (size_t pos = name.find('/'); pos != String::npos; pos = name.find('/', pos + 1))
+    {
+        ImageCollectionMap::iterator i = d_collections.find(name.substr(0, pos));
+        if (i == d_collections.end())
+            continue;
+
+        i->second.erase(&name);
+
+        if (i->second.empty() && &i->second != d_openCollection)
+            d_collections.erase(i);
+    }
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::destroyAll()
 {
     while (!d_images.empty())
         destroy(d_images.begin()->first);
+
+    d_imagesetCollections.clear();
+    d_imagesetLoadCounts.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -283,9 +402,57 @@ unsigned int ImageManager::getImageCount() const
 void ImageManager::loadImageset(const String& filename,
                                 const String& resource_group)
 {
-    System::getSingleton().getXMLParser()->parseXMLFile(
-            *this, filename, ImagesetSchemaName,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+    const std::pair<String, String> source(
+        resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group,
+        filename);
+    s_imagesetName.clear();
+
+    try
+    {
+        System::getSingleton().getXMLParser()->parseXMLFile(
+                *this, filename, ImagesetSchemaName, source.first);
+    }
+    catch (...)
+    {
+        endImageCollection();
+        throw;
+    }
+
+    // only count loads that created the collection
+    if (!s_imagesetName.empty())
+    {
+        d_imagesetCollections[source] = s_imagesetName;
+        ++d_imagesetLoadCounts[s_imagesetName];
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::unloadImageset(const String& filename,
+                                  const String& resource_group)
+{
+    std::map<std::pair<String, String>, String>::iterator i =
+        d_imagesetCollections.find(std::make_pair(
+            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group,
+            filename));
+
+    if (i == d_imagesetCollections.end())
+        return;
+
+    const String collection(i->second);
+    std::unordered_map<String, unsigned int>::iterator count =
+        d_imagesetLoadCounts.find(collection);
+
+    // the collection may have been destroyed directly in the meantime
+    if (count == d_imagesetLoadCounts.end())
+    {
+        d_imagesetCollections.erase(i);
+        return;
+    }
+
+    if (--count->second > 0)
+        return;
+
+    destroyImageCollection(collection);
 }
 
 //----------------------------------------------------------------------------//
@@ -302,20 +469,81 @@ void ImageManager::destroyImageCollection(const String& prefix,
     Logger::getSingleton().logEvent(
         "[ImageManager] Destroying image collection with prefix: " + prefix);
 
-    ImagePrefixMatchPred p(prefix);
+    ImageCollectionMap::iterator collection = d_collections.find(prefix);
 
-    ImageMap::iterator i;
-    while ((i = std::find_if(d_images.begin(), d_images.end(), p)) != d_images.end())
-        destroy(i);
+    if (collection != d_collections.end())
+    {
+        // the names stay valid until their own image is destroyed
+        const std::vector<const String*> names(collection->second.begin(),
+                                               collection->second.end());
+
+        for (const String* name : names)
+        {
+            ImageMap::iterator i = d_images.find(*name);
+            if (i != d_images.end())
+                destroy(i);
+        }
+    }
+
+    // forget the load count and files of an imageset collection
+    if (d_imagesetLoadCounts.erase(prefix))
+    {
+        for (std::map<std::pair<String, String>, String>::iterator i =
+                 d_imagesetCollections.begin(); i != d_imagesetCollections.end();)
+        {
+            if (i->second == prefix)
+                i = d_imagesetCollections.erase(i);
+            else
+                ++i;
+        }
+    }
 
     if (delete_texture)
         System::getSingleton().getRenderer()->destroyTexture(prefix);
 }
 
+//----------------------------------------------------------------------------//
+void ImageManager::beginImageCollection(const String& prefix, size_t expectedCount)
+{
+    endImageCollection();
+
+    d_openCollectionName = prefix;
+    d_openCollection = &d_collections[prefix];
+
+    if (expectedCount)
+    {
+        d_images.reserve(d_images.size() + expectedCount);
+        d_openCollection->reserve(d_openCollection->size() + expectedCount);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::endImageCollection()
+{
+    if (!d_openCollection)
+        return;
+
+    if (d_openCollection->empty())
+        d_collections.erase(d_openCollectionName);
+
+    d_openCollection = nullptr;
+    d_openCollectionName.clear();
+}
+
+//----------------------------------------------------------------------------//
+size_t ImageManager::getImageCollectionSize(const String& prefix) const
+{
+    ImageCollectionMap::const_iterator i = d_collections.find(prefix);
+    return i == d_collections.end() ? 0 : i->second.size();
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::addBitmapImageFromFile(const String& name, const String& filename,
                                     const String& resource_group)
 {
+    if (d_atlasPackingEnabled && addBitmapImageToAtlas(name, filename, resource_group))
+        return;
+
     // create texture from image
     Texture* tex = &System::getSingleton().getRenderer()->
         createTexture(name, filename,
@@ -327,6 +555,374 @@ void ImageManager::addBitmapImageFromFile(const String& name, const String& file
     image.setImageArea(rect);
 }
 
+//----------------------------------------------------------------------------//
+bool ImageManager::addBitmapImageToAtlas(const String& name, const String& filename,
+                                         const String& resource_group)
+{
+    if (isDefined(name))
+        throw AlreadyExistsException(
+            "Image already exists: " + name);
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+
+    RawDataContainer data;
+    System::getSingleton().getResourceProvider()->loadRawDataContainer(
+        filename, data,
+        resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+
+    StagingTexture staging;
+    Texture* result = nullptr;
+
+    try
+    {
+        result = System::getSingleton().getImageCodec().load(data, &staging);
+    }
+    catch (...)
+    {
+        System::getSingleton().getResourceProvider()->unloadRawDataContainer(data);
+        throw;
+    }
+
+    System::getSingleton().getResourceProvider()->unloadRawDataContainer(data);
+
+    // let the regular code report the error
+    if (!result || staging.getPixelData().empty())
+        return false;
+
+    const unsigned int width = static_cast<unsigned int>(staging.getSize().d_width);
+    const unsigned int height = static_cast<unsigned int>(staging.getSize().d_height);
+    const Texture::PixelFormat format = staging.getPixelFormat();
+
+    const bool packable =
+        (format == Texture::PixelFormat::Rgb || format == Texture::PixelFormat::Rgba) &&
+        width > 0 && height > 0 &&
+        width <= d_atlasMaxImageSize && height <= d_atlasMaxImageSize;
+
+    size_t page = 0;
+    glm::vec2 position;
+    bool placed = false;
+
+    if (packable)
+    {
+        // use the recorded placement if the image didn't change size
+        const auto layout = d_atlasLayout.find(name);
+        if (layout != d_atlasLayout.end() &&
+            layout->second.d_area.getWidth() == width &&
+            layout->second.d_area.getHeight() == height)
+        {
+            page = layout->second.d_page;
+            position = layout->second.d_area.d_min -
+                glm::vec2(AtlasPadding, AtlasPadding);
+            placed = true;
+            ++d_atlasLayoutPlacements;
+        }
+        else
+        {
+            placed = findAtlasSpace(width + 2 * AtlasPadding,
+                                    height + 2 * AtlasPadding, page, position);
+        }
+    }
+
+    if (!placed)
+    {
+        ++d_atlasRejectedImages;
+
+        // use the pixels we already decoded where the texture can take them
+        Texture& tex = renderer.createTexture(name);
+        if (!tex.isPixelFormatSupported(format))
+        {
+            renderer.destroyTexture(tex);
+            return false;
+        }
+        tex.loadFromMemory(staging.getPixelData().data(), staging.getSize(), format);
+
+        BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
+        image.setTexture(&tex);
+        image.setImageArea(Rectf(glm::vec2(0.0f, 0.0f), tex.getOriginalDataSize()));
+        return true;
+    }
+
+    // convert to RGBA, surrounded by a border repeating the edge pixels.
+    const unsigned int paddedWidth = width + 2 * AtlasPadding;
+    const unsigned int paddedHeight = height + 2 * AtlasPadding;
+    const size_t srcPixelSize = (format == Texture::PixelFormat::Rgb) ? 3 : 4;
+    const std::uint8_t* src = staging.getPixelData().data();
+    std::vector<std::uint8_t> padded(static_cast<size_t>(paddedWidth) * paddedHeight * 4);
+
+    for (unsigned int y = 0; y < paddedHeight; ++y)
+    {
+        const unsigned int srcY = std::min(height - 1,
+            y < AtlasPadding ? 0 : y - AtlasPadding);
+        std::uint8_t* dst = &padded[static_cast<size_t>(y) * paddedWidth * 4];
+
+        for (unsigned int x = 0; x < paddedWidth; ++x, dst += 4)
+        {
+            const unsigned int srcX = std::min(width - 1,
+                x < AtlasPadding ? 0 : x - AtlasPadding);
+            const std::uint8_t* pixel =
+                src + (static_cast<size_t>(srcY) * width + srcX) * srcPixelSize;
+
+            dst[0] = pixel[0];
+            dst[1] = pixel[1];
+            dst[2] = pixel[2];
+            dst[3] = (srcPixelSize == 4) ? pixel[3] : 0xFF;
+        }
+    }
+
+    Texture& pageTexture = getAtlasPageTexture(page);
+    pageTexture.blitFromMemory(padded.data(),
+        Rectf(position, Sizef(static_cast<float>(paddedWidth),
+                              static_cast<float>(paddedHeight))));
+
+    const Rectf area(position + glm::vec2(AtlasPadding, AtlasPadding),
+                     Sizef(static_cast<float>(width), static_cast<float>(height)));
+
+    BitmapImage& image = static_cast<BitmapImage&>(create("BitmapImage", name));
+    image.setTexture(&pageTexture);
+    image.setImageArea(area);
+
+    d_atlasPlacements[name] = {page, area};
+    ++d_atlasPages[page].d_imageCount;
+    d_atlasPages[page].d_usedPixels += static_cast<size_t>(paddedWidth) * paddedHeight;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool ImageManager::findAtlasSpace(unsigned int width, unsigned int height,
+                                  size_t& page, glm::vec2& position)
+{
+    // simple shelf packing: images are placed left to right on the current
+    // shelf of a page, and a new shelf is started below when one is full.
+    for (size_t i = 0; i <= d_atlasPages.size(); ++i)
+    {
+        if (i == d_atlasPages.size())
+        {
+            AtlasPage newPage;
+            newPage.d_size = std::min(d_atlasPageSize,
+                System::getSingleton().getRenderer()->getMaxTextureSize());
+            if (width > newPage.d_size || height > newPage.d_size)
+                return false;
+            d_atlasPages.push_back(newPage);
+        }
+
+        AtlasPage& candidate = d_atlasPages[i];
+        if (candidate.d_fromLayout)
+            continue;
+
+        unsigned int top = candidate.d_shelfTop;
+        unsigned int right = candidate.d_shelfRight;
+        unsigned int shelfHeight = candidate.d_shelfHeight;
+
+        // start a new shelf below the current one if the image is too wide
+        if (right + width > candidate.d_size)
+        {
+            top += shelfHeight;
+            right = 0;
+            shelfHeight = 0;
+        }
+
+        if (width > candidate.d_size || top + height > candidate.d_size)
+            continue;
+
+        candidate.d_shelfTop = top;
+        candidate.d_shelfRight = right + width;
+        candidate.d_shelfHeight = std::max(shelfHeight, height);
+
+        page = i;
+        position = glm::vec2(right, top);
+        return true;
+    }
+
+    return false;
+}
+//----------------------------------------------------------------------------//
+Texture& ImageManager::getAtlasPageTexture(size_t page)
+{
+    AtlasPage& atlasPage = d_atlasPages[page];
+
+    if (!atlasPage.d_texture)
+    {
+        Renderer& renderer = *System::getSingleton().getRenderer();
+        const Sizef size(static_cast<float>(atlasPage.d_size),
+                         static_cast<float>(atlasPage.d_size));
+
+        atlasPage.d_texture = &renderer.createTexture(
+            AtlasPageTexturePrefix + PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(page)), size);
+
+        // start from a fully transparent page
+        const std::vector<std::uint8_t> clear(
+            StagingTexture::calculateDataSize(size, Texture::PixelFormat::Rgba), 0);
+        atlasPage.d_texture->loadFromMemory(clear.data(), size,
+                                            Texture::PixelFormat::Rgba);
+    }
+
+    return *atlasPage.d_texture;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::releaseAtlasPlacement(const String& name)
+{
+    const auto placement = d_atlasPlacements.find(name);
+    if (placement == d_atlasPlacements.end())
+        return;
+
+    AtlasPage& page = d_atlasPages[placement->second.d_page];
+    const Rectf& area = placement->second.d_area;
+    page.d_usedPixels -=
+        static_cast<size_t>(area.getWidth() + 2 * AtlasPadding) *
+        static_cast<size_t>(area.getHeight() + 2 * AtlasPadding);
+    d_atlasPlacements.erase(placement);
+
+    // shelf packing can't reuse holes, so the page is only recycled once
+    // it is empty.
+    if (--page.d_imageCount == 0)
+    {
+        System::getSingleton().getRenderer()->destroyTexture(*page.d_texture);
+        page.d_texture = nullptr;
+        page.d_usedPixels = 0;
+        page.d_shelfTop = 0;
+        page.d_shelfHeight = 0;
+        page.d_shelfRight = 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::setAtlasPageSize(unsigned int size)
+{
+    if (size == 0)
+        throw InvalidRequestException("The atlas page size must not be zero.");
+
+    d_atlasPageSize = size;
+}
+
+//----------------------------------------------------------------------------//
+ImageManager::AtlasStatistics ImageManager::getAtlasStatistics() const
+{
+    AtlasStatistics stats;
+    stats.d_imageCount = d_atlasPlacements.size();
+    stats.d_layoutPlacements = d_atlasLayoutPlacements;
+    stats.d_rejectedImages = d_atlasRejectedImages;
+
+    for (const auto& page : d_atlasPages)
+    {
+        if (!page.d_texture)
+            continue;
+
+        ++stats.d_pageCount;
+        stats.d_usedPixels += page.d_usedPixels;
+        stats.d_totalPixels += static_cast<size_t>(page.d_size) * page.d_size;
+    }
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::saveAtlasLayout(const String& filename) const
+{
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    std::ofstream file(String::convertUtf32ToUtf8(filename.getString()).c_str());
+#else
+    std::ofstream file(filename.c_str());
+#endif
+    if (!file)
+        throw FileIOException(
+            "Unable to open file '" + filename + "' for writing.");
+
+    XMLSerializer xml(file);
+    xml.openTag(AtlasLayoutElement)
+        .attribute(AtlasVersionAttribute, AtlasLayoutVersion);
+
+    for (const auto& page : d_atlasPages)
+        xml.openTag(AtlasPageElement)
+            .attribute(AtlasSizeAttribute,
+                PropertyHelper<std::uint32_t>::toString(page.d_size))
+            .closeTag();
+
+    // sort by name so that the file doesn't depend on the hash map order
+    std::vector<const std::pair<const String, AtlasPlacement>*> placements;
+    placements.reserve(d_atlasPlacements.size());
+    for (const auto& placement : d_atlasPlacements)
+        placements.push_back(&placement);
+    std::sort(placements.begin(), placements.end(),
+        [](const std::pair<const String, AtlasPlacement>* a,
+           const std::pair<const String, AtlasPlacement>* b)
+        { return a->first < b->first; });
+
+    for (const auto* placement : placements)
+    {
+        const Rectf& area = placement->second.d_area;
+        xml.openTag(AtlasImageElement)
+            .attribute(AtlasNameAttribute, placement->first)
+            .attribute(AtlasPageAttribute, PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(placement->second.d_page)))
+            .attribute(AtlasXAttribute, PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(area.left())))
+            .attribute(AtlasYAttribute, PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(area.top())))
+            .attribute(AtlasWidthAttribute, PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(area.getWidth())))
+            .attribute(AtlasHeightAttribute, PropertyHelper<std::uint32_t>::toString(
+                static_cast<std::uint32_t>(area.getHeight())))
+            .closeTag();
+    }
+
+    xml.closeTag();
+
+    if (!xml || !file)
+        throw FileIOException(
+            "Failed to write atlas layout to '" + filename + "'.");
+}
+
+//----------------------------------------------------------------------------//
+void ImageManager::loadAtlasLayout(const String& filename,
+                                   const String& resourceGroup)
+{
+    if (!d_atlasPlacements.empty())
+        throw InvalidRequestException(
+            "An atlas layout can't be loaded while images are packed into "
+            "atlas pages.");
+
+    AtlasLayoutHandler handler;
+    System::getSingleton().getXMLParser()->parseXMLFile(
+        handler, filename, "",
+        resourceGroup.empty() ? d_imagesetDefaultResourceGroup : resourceGroup,
+        false);
+
+    const unsigned int maxSize =
+        System::getSingleton().getRenderer()->getMaxTextureSize();
+
+    d_atlasPages.clear();
+    d_atlasLayout.clear();
+
+    for (unsigned int size : handler.d_pageSizes)
+    {
+        AtlasPage page;
+        page.d_size = size;
+        page.d_fromLayout = true;
+        d_atlasPages.push_back(page);
+    }
+
+    for (const auto& image : handler.d_images)
+    {
+        // drop placements that don't fit the page (or the Renderer) so that
+        // those images are packed normally.
+        const AtlasPage& page = d_atlasPages[image.d_page];
+        if (page.d_size > maxSize ||
+            image.d_area.left() < AtlasPadding || image.d_area.top() < AtlasPadding ||
+            image.d_area.right() + AtlasPadding > page.d_size ||
+            image.d_area.bottom() + AtlasPadding > page.d_size)
+            continue;
+
+        d_atlasLayout[image.d_name] = {image.d_page, image.d_area};
+    }
+
+    Logger::getSingleton().logEvent("[ImageManager] Loaded atlas layout '" +
+        filename + "' with " + PropertyHelper<std::uint32_t>::toString(
+            static_cast<std::uint32_t>(d_atlasLayout.size())) + " images.");
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::notifyDisplaySizeChanged(const Sizef& size)
 {
@@ -375,6 +971,7 @@ void ImageManager::elementEndLocal(const String& element)
         s_texture = nullptr;
         s_SVGData = nullptr;
         s_imagesetType = "";
+        endImageCollection();
     }
 }
 
@@ -414,6 +1011,10 @@ void ImageManager::elementImagesetStart(const XMLAttributes& attributes)
     }
             
 
+    s_imagesetName = name;
+
+    beginImageCollection(name);
+
     // set native resolution for imageset
     s_nativeResolution = Sizef(
         attributes.getValueAsFloat(ImagesetNativeHorzResAttribute, 640),
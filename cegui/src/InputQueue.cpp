@@ -0,0 +1,313 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/InputQueue.h"
+
+#include <cstddef>
+
+namespace CEGUI
+{
+const size_t InputQueue::DefaultCapacity(1024);
+
+//----------------------------------------------------------------------------//
+InputQueue::InputQueue(size_t capacity) :
+    d_enqueuePos(0),
+    d_dequeuePos(0),
+    d_dropped(0),
+    d_coalesceCursorMoves(true),
+    d_coalesceWheel(true)
+{
+    size_t size = 2;
+    while (size < capacity)
+        size <<= 1;
+
+    d_slots.reset(new Slot[size]);
+    d_mask = size - 1;
+
+    for (size_t i = 0; i < size; ++i)
+        d_slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::push(InputType type, float x, float y, std::uint32_t code)
+{
+    // Bounded MPMC ring buffer after Dmitry Vyukov. A slot whose sequence
+    // equals the enqueue position is free for that position; producers claim
+    // it by advancing the position and publish it by setting sequence to
+    // position + 1, which is what the consumer waits for.
+    size_t pos = d_enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;)
+    {
+        slot = &d_slots[pos & d_mask];
+        const size_t seq = slot->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t diff =
+            static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+        if (diff == 0)
+        {
+            if (d_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds input from the previous lap, queue is full
+            d_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            pos = d_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->input.type = type;
+    slot->input.x = x;
+    slot->input.y = y;
+    slot->input.code = code;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::pop(Input& input)
+{
+    Slot& slot = d_slots[d_dequeuePos & d_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != d_dequeuePos + 1)
+        return false;
+
+    input = slot.input;
+
+    // Make the slot free for the producers' next lap
+    slot.sequence.store(d_dequeuePos + d_mask + 1, std::memory_order_release);
+    ++d_dequeuePos;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+size_t InputQueue::drain(InjectedInputReceiver& receiver)
+{
+    size_t injected = 0;
+
+    // Pending merged cursor motion; absolute if the run contained a position
+    bool motionPending = false;
+    bool motionAbsolute = false;
+    float motionX = 0.f;
+    float motionY = 0.f;
+
+    bool wheelPending = false;
+    float wheelDelta = 0.f;
+
+    auto flushMotion = [&]()
+    {
+        if (!motionPending)
+            return;
+
+        if (motionAbsolute)
+            receiver.injectMousePosition(motionX, motionY);
+        else
+            receiver.injectMouseMove(motionX, motionY);
+
+        ++injected;
+        motionPending = false;
+        motionAbsolute = false;
+        motionX = 0.f;
+        motionY = 0.f;
+    };
+
+    auto flushWheel = [&]()
+    {
+        if (!wheelPending)
+            return;
+
+        receiver.injectMouseWheelChange(wheelDelta);
+        ++injected;
+        wheelPending = false;
+        wheelDelta = 0.f;
+    };
+
+    Input input;
+    const size_t capacity = getCapacity();
+    for (size_t i = 0; i < capacity && pop(input); ++i)
+    {
+        if (d_coalesceCursorMoves && input.type == InputType::MouseMove)
+        {
+            flushWheel();
+            motionPending = true;
+            motionX += input.x;
+            motionY += input.y;
+        }
+        else if (d_coalesceCursorMoves && input.type == InputType::MousePosition)
+        {
+            // Moves before an absolute position don't matter anymore
+            flushWheel();
+            motionPending = true;
+            motionAbsolute = true;
+            motionX = input.x;
+            motionY = input.y;
+        }
+        else if (d_coalesceWheel && input.type == InputType::MouseWheel)
+        {
+            // Wheel input goes to the window under the cursor, so moves
+            // queued before it must be delivered first
+            flushMotion();
+            wheelPending = true;
+            wheelDelta += input.x;
+        }
+        else
+        {
+            flushMotion();
+            flushWheel();
+            dispatch(receiver, input);
+            ++injected;
+        }
+    }
+
+    flushMotion();
+    flushWheel();
+
+    return injected;
+}
+
+//----------------------------------------------------------------------------//
+void InputQueue::dispatch(InjectedInputReceiver& receiver, const Input& input)
+{
+    switch (input.type)
+    {
+        case InputType::MouseMove:
+            receiver.injectMouseMove(input.x, input.y);
+            break;
+        case InputType::MousePosition:
+            receiver.injectMousePosition(input.x, input.y);
+            break;
+        case InputType::MouseLeaves:
+            receiver.injectMouseLeaves();
+            break;
+        case InputType::MouseWheel:
+            receiver.injectMouseWheelChange(input.x);
+            break;
+        case InputType::MouseButtonDown:
+            receiver.injectMouseButtonDown(static_cast<MouseButton>(input.code));
+            break;
+        case InputType::MouseButtonUp:
+            receiver.injectMouseButtonUp(static_cast<MouseButton>(input.code));
+            break;
+        case InputType::MouseButtonClick:
+            receiver.injectMouseButtonClick(static_cast<MouseButton>(input.code));
+            break;
+        case InputType::MouseButtonDoubleClick:
+            receiver.injectMouseButtonDoubleClick(static_cast<MouseButton>(input.code));
+            break;
+        case InputType::MouseButtonTripleClick:
+            receiver.injectMouseButtonTripleClick(static_cast<MouseButton>(input.code));
+            break;
+        case InputType::KeyDown:
+            receiver.injectKeyDown(static_cast<Key::Scan>(input.code));
+            break;
+        case InputType::KeyUp:
+            receiver.injectKeyUp(static_cast<Key::Scan>(input.code));
+            break;
+        case InputType::Char:
+            receiver.injectChar(static_cast<char32_t>(input.code));
+            break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseMove(float dx, float dy)
+{
+    return push(InputType::MouseMove, dx, dy, 0);
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseLeaves()
+{
+    return push(InputType::MouseLeaves, 0.f, 0.f, 0);
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseButtonDown(MouseButton button)
+{
+    return push(InputType::MouseButtonDown, 0.f, 0.f, static_cast<std::uint32_t>(button));
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseButtonUp(MouseButton button)
+{
+    return push(InputType::MouseButtonUp, 0.f, 0.f, static_cast<std::uint32_t>(button));
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectKeyDown(Key::Scan scanCode)
+{
+    return push(InputType::KeyDown, 0.f, 0.f, static_cast<std::uint32_t>(scanCode));
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectKeyUp(Key::Scan scanCode)
+{
+    return push(InputType::KeyUp, 0.f, 0.f, static_cast<std::uint32_t>(scanCode));
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectChar(char32_t codePoint)
+{
+    return push(InputType::Char, 0.f, 0.f, static_cast<std::uint32_t>(codePoint));
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseWheelChange(float delta)
+{
+    return push(InputType::MouseWheel, delta, 0.f, 0);
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMousePosition(float x, float y)
+{
+    return push(InputType::MousePosition, x, y, 0);
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseButtonClick(MouseButton button)
+{
+    return push(InputType::MouseButtonClick, 0.f, 0.f, static_cast<std::uint32_t>(button));
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseButtonDoubleClick(MouseButton button)
+{
+    return push(InputType::MouseButtonDoubleClick, 0.f, 0.f, static_cast<std::uint32_t>(button));
+}
+
+//----------------------------------------------------------------------------//
+bool InputQueue::injectMouseButtonTripleClick(MouseButton button)
+{
+    return push(InputType::MouseButtonTripleClick, 0.f, 0.f, static_cast<std::uint32_t>(button));
+}
+
+//----------------------------------------------------------------------------//
+
+}
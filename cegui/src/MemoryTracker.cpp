@@ -0,0 +1,140 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/MemoryTracker.h"
+#include <atomic>
+#include <new>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//! counters of one MemoryTag.
+struct TagCounters
+{
+    std::atomic<size_t> d_liveBytes {0};
+    std::atomic<size_t> d_liveAllocations {0};
+    std::atomic<size_t> d_peakBytes {0};
+    std::atomic<size_t> d_totalAllocations {0};
+};
+
+/*
+    Constant initialised, so the counters are usable by allocations made
+    during static initialisation of other translation units.
+*/
+TagCounters s_counters[static_cast<int>(MemoryTag::Count)];
+
+const char* const s_tagNames[static_cast<int>(MemoryTag::Count)] =
+{
+    "Window",
+    "PropertySet",
+    "EventSet",
+    "GeometryBuffer",
+    "RenderedText",
+    "Font",
+    "XML"
+};
+
+TagCounters& getCounters(MemoryTag tag)
+{
+    return s_counters[static_cast<int>(tag)];
+}
+
+}
+
+//----------------------------------------------------------------------------//
+void* MemoryTracker::allocate(MemoryTag tag, size_t size)
+{
+    void* const p = ::operator new(size);
+
+    TagCounters& counters = getCounters(tag);
+    const size_t live =
+        counters.d_liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    counters.d_liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.d_totalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    size_t peak = counters.d_peakBytes.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !counters.d_peakBytes.compare_exchange_weak(
+               peak, live, std::memory_order_relaxed))
+    {
+    }
+
+    return p;
+}
+
+//----------------------------------------------------------------------------//
+void MemoryTracker::deallocate(MemoryTag tag, void* p, size_t size) noexcept
+{
+    if (!p)
+        return;
+
+    TagCounters& counters = getCounters(tag);
+    counters.d_liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    counters.d_liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    ::operator delete(p);
+}
+
+//----------------------------------------------------------------------------//
+MemoryStatistics MemoryTracker::getStatistics(MemoryTag tag)
+{
+    const TagCounters& counters = getCounters(tag);
+
+    MemoryStatistics stats;
+    stats.d_liveBytes = counters.d_liveBytes.load(std::memory_order_relaxed);
+    stats.d_liveAllocations =
+        counters.d_liveAllocations.load(std::memory_order_relaxed);
+    stats.d_peakBytes = counters.d_peakBytes.load(std::memory_order_relaxed);
+    stats.d_totalAllocations =
+        counters.d_totalAllocations.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+void MemoryTracker::resetPeaks()
+{
+    for (TagCounters& counters : s_counters)
+        counters.d_peakBytes.store(
+            counters.d_liveBytes.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------//
+const char* MemoryTracker::getTagName(MemoryTag tag)
+{
+    const int index = static_cast<int>(tag);
+    if (index < 0 || index >= static_cast<int>(MemoryTag::Count))
+        return "Unknown";
+
+    return s_tagNames[index];
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,259 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ParallelGeometryGenerator.h"
+#include "CEGUI/GeometryRecorder.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include <algorithm>
+#include <system_error>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+ParallelGeometryGenerator::ParallelGeometryGenerator(unsigned int threadCount)
+{
+    if (!threadCount)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    // the calling thread is the first one
+    d_workers.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i)
+    {
+        try
+        {
+            d_workers.emplace_back(&ParallelGeometryGenerator::workerMain, this, i);
+        }
+        catch (const std::system_error&)
+        {
+            break;
+        }
+    }
+
+    d_queues.reserve(d_workers.size() + 1);
+    for (size_t i = 0; i <= d_workers.size(); ++i)
+        d_queues.push_back(std::make_unique<TaskQueue>());
+}
+
+//----------------------------------------------------------------------------//
+ParallelGeometryGenerator::~ParallelGeometryGenerator()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopping = true;
+    }
+
+    d_batchStarted.notify_all();
+
+    for (std::thread& worker : d_workers)
+        worker.join();
+}
+
+//----------------------------------------------------------------------------//
+void ParallelGeometryGenerator::generate(const std::vector<Window*>& windows)
+{
+    d_tasks.clear();
+
+    for (Window* wnd : windows)
+    {
+        if (!wnd->d_needsRedraw || !wnd->isGeometryGenerationThreadSafe())
+            continue;
+
+        d_tasks.emplace_back();
+        d_tasks.back().d_window = wnd;
+    }
+
+    if (d_tasks.empty())
+        return;
+
+    // this fires the rendering started events, whose handlers may still
+    // change anything.
+    for (Task& task : d_tasks)
+        if (!task.d_window->beginGeometryGeneration(task.d_previousBuffers))
+            task.d_window = nullptr;
+
+    d_tasks.erase(std::remove_if(d_tasks.begin(), d_tasks.end(),
+        [](const Task& task) { return !task.d_window; }), d_tasks.end());
+
+    // window renderers read the areas of the window, its ancestors and its
+    // children, which are cached on first use; that must not happen on
+    // several threads at once.
+    for (const Task& task : d_tasks)
+    {
+        for (const Window* wnd = task.d_window; wnd; wnd = wnd->getParent())
+            wnd->updateRenderingAreaCaches();
+
+        for (size_t i = 0; i < task.d_window->getChildCount(); ++i)
+            task.d_window->getChildAtIndex(i)->updateRenderingAreaCaches();
+    }
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    const size_t threadCount = d_queues.size();
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        if (!d_queues[i]->d_recorder)
+            d_queues[i]->d_recorder = std::make_unique<GeometryRecorder>(renderer);
+
+        // consecutive windows tend to cost about the same, so each thread
+        // gets a contiguous share of them.
+        const size_t first = d_tasks.size() * i / threadCount;
+        const size_t last = d_tasks.size() * (i + 1) / threadCount;
+        for (size_t task = first; task < last; ++task)
+            d_queues[i]->d_tasks.push_back(task);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        ++d_batch;
+        d_busyWorkers = static_cast<unsigned int>(d_workers.size());
+    }
+
+    d_batchStarted.notify_all();
+
+    runTasks(0);
+
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_batchDone.wait(lock, [this] { return d_busyWorkers == 0; });
+    }
+
+    // complete every window before reporting errors, since the recorded
+    // buffers are only valid until the recorders are cleared.
+    std::exception_ptr error;
+    for (Task& task : d_tasks)
+    {
+        try
+        {
+            task.d_window->endGeometryGeneration(task.d_previousBuffers,
+                d_queues[task.d_thread]->d_recorder.get());
+        }
+        catch (...)
+        {
+            if (!task.d_error)
+                task.d_error = std::current_exception();
+        }
+
+        if (task.d_error && !error)
+            error = task.d_error;
+    }
+
+    for (auto& queue : d_queues)
+        queue->d_recorder->clear();
+
+    d_tasks.clear();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+//----------------------------------------------------------------------------//
+void ParallelGeometryGenerator::workerMain(unsigned int thread)
+{
+    std::uint64_t batch = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(d_mutex);
+            d_batchStarted.wait(lock,
+                [this, batch] { return d_stopping || d_batch != batch; });
+
+            if (d_stopping)
+                return;
+
+            batch = d_batch;
+        }
+
+        runTasks(thread);
+
+        bool done;
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            done = (--d_busyWorkers == 0);
+        }
+
+        if (done)
+            d_batchDone.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ParallelGeometryGenerator::runTasks(unsigned int thread)
+{
+    GeometryRecorder::setCurrent(d_queues[thread]->d_recorder.get());
+
+    size_t index;
+    while (takeTask(thread, index))
+    {
+        Task& task = d_tasks[index];
+        task.d_thread = thread;
+
+        try
+        {
+            task.d_window->generateGeometry();
+        }
+        catch (...)
+        {
+            task.d_error = std::current_exception();
+        }
+    }
+
+    GeometryRecorder::setCurrent(nullptr);
+}
+
+//----------------------------------------------------------------------------//
+bool ParallelGeometryGenerator::takeTask(unsigned int thread, size_t& task)
+{
+    {
+        TaskQueue& own = *d_queues[thread];
+        std::lock_guard<std::mutex> lock(own.d_mutex);
+        if (!own.d_tasks.empty())
+        {
+            task = own.d_tasks.front();
+            own.d_tasks.pop_front();
+            return true;
+        }
+    }
+
+    // no tasks are added while a batch runs, so once every queue was seen
+    // empty there is nothing left to do.
+    const size_t threadCount = d_queues.size();
+    for (size_t i = 1; i < threadCount; ++i)
+    {
+        TaskQueue& victim = *d_queues[(thread + i) % threadCount];
+        std::lock_guard<std::mutex> lock(victim.d_mutex);
+        if (!victim.d_tasks.empty())
+        {
+            task = victim.d_tasks.back();
+            victim.d_tasks.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}
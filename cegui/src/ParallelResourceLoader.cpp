@@ -0,0 +1,451 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ParallelResourceLoader.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/StagingTexture.h"
+#include "CEGUI/System.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/text/Font.h"
+#include "CEGUI/text/Font_xmlHandler.h"
+#include <algorithm>
+#include <system_error>
+#include <thread>
+
+namespace CEGUI
+{
+namespace
+{
+// names used in imageset files (see ImageManager.cpp)
+const String ImagesetElement("Imageset");
+const String ImagesetImageFileAttribute("imagefile");
+const String ImagesetResourceGroupAttribute("resourceGroup");
+const String ImagesetTypeAttribute("type");
+const String ImagesetBitmapType("BitmapImage");
+
+//----------------------------------------------------------------------------//
+/*
+    XMLHandler that picks up the image file referenced by an imageset while it
+    is being recorded.
+*/
+class ImagesetFilePeek : public XMLHandler
+{
+public:
+    const String& getDefaultResourceGroup() const override
+    {
+        return ImageManager::getImagesetDefaultResourceGroup();
+    }
+
+    void elementStart(const String& element,
+                      const XMLAttributes& attributes) override
+    {
+        if (element != ImagesetElement)
+            return;
+
+        d_type = attributes.getValueAsString(ImagesetTypeAttribute,
+                                             ImagesetBitmapType);
+        d_imageFile = attributes.getValueAsString(ImagesetImageFileAttribute);
+        d_resourceGroup =
+            attributes.getValueAsString(ImagesetResourceGroupAttribute);
+    }
+
+    String d_type;
+    String d_imageFile;
+    String d_resourceGroup;
+};
+
+}
+
+//----------------------------------------------------------------------------//
+/*
+    ImageCodec that hands out images decoded ahead of time, and passes
+    everything else on to the actual image codec.
+*/
+class ParallelResourceLoader::PreparedImageCodec : public ImageCodec
+{
+public:
+    PreparedImageCodec(ImageCodec& codec, const DecodedImageMap& images) :
+        ImageCodec(codec.getIdentifierString()),
+        d_codec(codec),
+        d_images(images)
+    {
+        d_supportedFormat = codec.getSupportedFormat();
+    }
+
+    Texture* load(const RawDataContainer& data, Texture* result) override
+    {
+        const DecodedImageMap::const_iterator i(d_images.find(
+            XMLBinaryCache::hashSource(data.getDataPtr(), data.getSize())));
+
+        if (i == d_images.end() || i->second.d_sourceSize != data.getSize() ||
+            !result->isPixelFormatSupported(i->second.d_format))
+        {
+            return d_codec.load(data, result);
+        }
+
+        result->loadFromMemory(i->second.d_pixels.data(),
+                               Sizef(i->second.d_width, i->second.d_height),
+                               i->second.d_format);
+        return result;
+    }
+
+private:
+    ImageCodec& d_codec;
+    const DecodedImageMap& d_images;
+};
+
+//----------------------------------------------------------------------------//
+ParallelResourceLoader::ParallelResourceLoader(unsigned int threadCount) :
+    d_threadCount(threadCount ? threadCount :
+                  std::max(1u, std::thread::hardware_concurrency())),
+    d_keepBlobs(false),
+    d_pendingTasks(0),
+    d_stopping(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+ParallelResourceLoader::~ParallelResourceLoader()
+{
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::loadResources(Scheme& scheme)
+{
+    if (!System::getSingleton().getXMLParser()->isThreadSafe())
+    {
+        Logger::getSingleton().logEvent("The XML parser may not be used from "
+            "several threads; loading resources of GUI scheme '" +
+            scheme.getName() + "' sequentially.", LoggingLevel::Informative);
+
+        scheme.loadResources();
+        return;
+    }
+
+    Logger::getSingleton().logEvent("---- Preparing resources for GUI scheme '" +
+        scheme.getName() + "' on worker threads ----", LoggingLevel::Informative);
+
+    ImageManager& imgr = ImageManager::getSingleton();
+
+    // prepared blobs are only replayed while the binary cache is enabled;
+    // otherwise imagesets are still parsed to find their image files.
+    d_keepBlobs = System::getSingleton().getXMLBinaryCache().isEnabled();
+
+    // queue everything up front; the workers only start once it is all known,
+    // which keeps the order of the results independent of thread timing.
+    for (Scheme::LoadableUIElementIterator i = scheme.getXMLImagesets();
+         !i.isAtEnd(); ++i)
+    {
+        const String filename((*i).filename);
+        const String group((*i).resourceGroup.empty() ?
+            ImageManager::getImagesetDefaultResourceGroup() : (*i).resourceGroup);
+        const String schema(imgr.getSchemaName());
+
+        queueTask([this, filename, group, schema]
+            { prepareXML(filename, group, schema, true); });
+    }
+
+    for (Scheme::LoadableUIElementIterator i = scheme.getImageFileImagesets();
+         !i.isAtEnd(); ++i)
+    {
+        if (imgr.isDefined((*i).name.empty() ? (*i).filename : (*i).name))
+            continue;
+
+        const String filename((*i).filename);
+        const String group((*i).resourceGroup.empty() ?
+            ImageManager::getImagesetDefaultResourceGroup() : (*i).resourceGroup);
+
+        queueTask([this, filename, group] { prepareImage(filename, group); });
+    }
+
+    for (Scheme::LoadableUIElementIterator i = scheme.getFonts();
+         d_keepBlobs && !i.isAtEnd(); ++i)
+    {
+        const String filename((*i).filename);
+        const String group((*i).resourceGroup.empty() ?
+            Font::getDefaultResourceGroup() : (*i).resourceGroup);
+
+        queueTask([this, filename, group]
+            { prepareXML(filename, group, Font_xmlHandler::FontSchemaName, false); });
+    }
+
+    for (Scheme::LoadableUIElementIterator i = scheme.getLookNFeels();
+         d_keepBlobs && !i.isAtEnd(); ++i)
+    {
+        const String filename((*i).filename);
+        const String group((*i).resourceGroup.empty() ?
+            WidgetLookManager::getDefaultResourceGroup() : (*i).resourceGroup);
+
+        queueTask([this, filename, group]
+            { prepareXML(filename, group, WidgetLookManager::FalagardSchemaName, false); });
+    }
+
+    runTasks();
+    commit(scheme);
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::queueTask(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_taskMutex);
+        d_tasks.push_back(std::move(task));
+        ++d_pendingTasks;
+    }
+
+    d_taskAdded.notify_one();
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::runTasks()
+{
+    if (d_tasks.empty())
+        return;
+
+    d_stopping = false;
+
+    std::vector<std::thread> workers;
+    workers.reserve(d_threadCount);
+
+    for (unsigned int i = 0; i < d_threadCount; ++i)
+    {
+        try
+        {
+            workers.emplace_back(&ParallelResourceLoader::workerMain, this);
+        }
+        catch (const std::system_error&)
+        {
+            break;
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(d_taskMutex);
+
+        // without any worker, do the work here
+        d_stopping = workers.empty();
+        if (!d_stopping)
+            d_tasksDone.wait(lock, [this] { return d_pendingTasks == 0; });
+        d_stopping = true;
+    }
+
+    d_taskAdded.notify_all();
+
+    if (workers.empty())
+        workerMain();
+
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::workerMain()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(d_taskMutex);
+            d_taskAdded.wait(lock,
+                [this] { return d_stopping || !d_tasks.empty(); });
+
+            if (d_tasks.empty())
+                return;
+
+            task = std::move(d_tasks.front());
+            d_tasks.pop_front();
+        }
+
+        // tasks never throw, and queue follow up tasks before they return.
+        task();
+
+        std::lock_guard<std::mutex> lock(d_taskMutex);
+        if (--d_pendingTasks == 0)
+            d_tasksDone.notify_all();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::prepareXML(const String& filename,
+                                        const String& resourceGroup,
+                                        const String& schemaName,
+                                        bool isImageset)
+{
+    RawDataContainer data;
+    if (!loadRawData(filename, resourceGroup, data))
+        return;
+
+    ImagesetFilePeek peek;
+    XMLBinaryCache::Recorder recorder(isImageset ? &peek : nullptr,
+        XMLBinaryCache::hashSource(data.getDataPtr(), data.getSize()));
+
+    try
+    {
+        System::getSingleton().getXMLParser()->parseXML(recorder, data,
+                                                        schemaName);
+    }
+    catch (...)
+    {
+        // the file is parsed again when committing, which reports the error.
+        unloadRawData(data);
+        return;
+    }
+
+    unloadRawData(data);
+
+    if (d_keepBlobs)
+    {
+        std::lock_guard<std::mutex> lock(d_resultMutex);
+        d_blobs.push_back(std::make_pair(std::make_pair(filename, resourceGroup),
+                                         recorder.getBlob()));
+    }
+
+    // the texture of an imageset depends on the imageset having been parsed
+    if (isImageset && peek.d_type == ImagesetBitmapType &&
+        !peek.d_imageFile.empty())
+    {
+        const String imageFile(peek.d_imageFile);
+        const String imageGroup(peek.d_resourceGroup.empty() ?
+            ImageManager::getImagesetDefaultResourceGroup() :
+            peek.d_resourceGroup);
+
+        queueTask([this, imageFile, imageGroup]
+            { prepareImage(imageFile, imageGroup); });
+    }
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::prepareImage(const String& filename,
+                                          const String& resourceGroup)
+{
+    RawDataContainer data;
+    if (!loadRawData(filename, resourceGroup, data))
+        return;
+
+    const std::uint64_t hash =
+        XMLBinaryCache::hashSource(data.getDataPtr(), data.getSize());
+    const size_t size = data.getSize();
+
+    StagingTexture staging;
+    Texture* result = nullptr;
+
+    try
+    {
+        result = System::getSingleton().getImageCodec().load(data, &staging);
+    }
+    catch (...)
+    {
+    }
+
+    unloadRawData(data);
+
+    // failures are reported when the image is loaded for real.
+    if (!result || staging.getPixelData().empty())
+        return;
+
+    DecodedImage image;
+    image.d_sourceSize = size;
+    image.d_pixels.swap(staging.getPixelData());
+    image.d_width = staging.getSize().d_width;
+    image.d_height = staging.getSize().d_height;
+    image.d_format = staging.getPixelFormat();
+
+    std::lock_guard<std::mutex> lock(d_resultMutex);
+    d_images.emplace(hash, std::move(image));
+}
+
+//----------------------------------------------------------------------------//
+bool ParallelResourceLoader::loadRawData(const String& filename,
+                                         const String& resourceGroup,
+                                         RawDataContainer& output)
+{
+    std::lock_guard<std::mutex> lock(d_resourceMutex);
+
+    try
+    {
+        System::getSingleton().getResourceProvider()->
+            loadRawDataContainer(filename, output, resourceGroup);
+    }
+    catch (...)
+    {
+        // reported when the resource is loaded for real.
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::unloadRawData(RawDataContainer& data)
+{
+    std::lock_guard<std::mutex> lock(d_resourceMutex);
+    System::getSingleton().getResourceProvider()->unloadRawDataContainer(data);
+}
+
+//----------------------------------------------------------------------------//
+void ParallelResourceLoader::commit(Scheme& scheme)
+{
+    System& system = System::getSingleton();
+    XMLBinaryCache& cache = system.getXMLBinaryCache();
+
+    for (auto& blob : d_blobs)
+        cache.addPreparedBlob(blob.first.first, blob.first.second,
+                              std::move(blob.second));
+    d_blobs.clear();
+
+    PreparedImageCodec codec(system.getImageCodec(), d_images);
+    system.setImageCodecOverride(&codec);
+
+    try
+    {
+        scheme.loadResources();
+    }
+    catch (...)
+    {
+        system.setImageCodecOverride(nullptr);
+        cache.clearPreparedBlobs();
+        d_images.clear();
+        throw;
+    }
+
+    system.setImageCodecOverride(nullptr);
+    cache.clearPreparedBlobs();
+    d_images.clear();
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
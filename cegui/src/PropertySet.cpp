@@ -28,9 +28,166 @@
  ***************************************************************************/
 #include "CEGUI/PropertySet.h"
 #include "CEGUI/Exceptions.h"
+#include <algorithm>
 
 namespace CEGUI
 {
+namespace
+{
+typedef std::unordered_map<String, Property*, std::hash<String>, std::equal_to<String>,
+	TrackedAllocator<std::pair<const String, Property*>, MemoryTag::PropertySet> > PropertyTable;
+
+/*************************************************************************
+	Pool of shared property tables, keyed by a hash of their content.
+	Tables are owned by the PropertySets using them, so that they are
+	released together with the last Window of a type.
+*************************************************************************/
+struct PropertyTablePool
+{
+	std::unordered_multimap<size_t, std::weak_ptr<PropertyTable> > d_tables;
+	//! size at which expired tables are next purged from the whole pool.
+	size_t d_purgeThreshold = 64;
+};
+
+PropertyTablePool& getPropertyTablePool()
+{
+	static PropertyTablePool pool;
+	return pool;
+}
+
+size_t hashPropertyTable(const PropertyTable& table)
+{
+	// Property names are the keys, so the set of Property objects identifies
+	// the table. Addition makes the hash independent of the iteration order.
+	size_t hash = table.size();
+	for (const auto& pair : table)
+	{
+		size_t h = std::hash<const Property*>()(pair.second);
+		h ^= h >> 17;
+		h *= static_cast<size_t>(0x9E3779B97F4A7C15ull);
+		hash += h ^ (h >> 29);
+	}
+
+	return hash;
+}
+
+bool isSamePropertyTable(const PropertyTable& a, const PropertyTable& b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	for (const auto& pair : a)
+	{
+		const auto it = b.find(pair.first);
+		if (it == b.end() || it->second != pair.second)
+			return false;
+	}
+
+	return true;
+}
+
+}
+
+/*************************************************************************
+	Copy constructor
+*************************************************************************/
+PropertySet::PropertySet(const PropertySet& other) :
+	PropertyReceiver(other)
+{
+	*this = other;
+}
+
+/*************************************************************************
+	Assignment
+*************************************************************************/
+PropertySet& PropertySet::operator=(const PropertySet& other)
+{
+	if (this == &other)
+		return *this;
+
+	d_propertiesShared = other.d_propertiesShared;
+	if (other.d_propertiesShared || !other.d_properties)
+		d_properties = other.d_properties;
+	else
+		d_properties = std::make_shared<PropertyRegistry>(*other.d_properties);
+
+	return *this;
+}
+
+/*************************************************************************
+	Find a property by name
+*************************************************************************/
+Property* PropertySet::findProperty(const String& name) const
+{
+	if (!d_properties)
+		return nullptr;
+
+	PropertyRegistry::const_iterator pos = d_properties->find(name);
+	return (pos == d_properties->end()) ? nullptr : pos->second;
+}
+
+/*************************************************************************
+	Get the property table for modification
+*************************************************************************/
+PropertySet::PropertyRegistry& PropertySet::getWritablePropertyTable()
+{
+	if (!d_properties)
+		d_properties = std::make_shared<PropertyRegistry>();
+	else if (d_propertiesShared)
+		d_properties = std::make_shared<PropertyRegistry>(*d_properties);
+
+	d_propertiesShared = false;
+	return *d_properties;
+}
+
+/*************************************************************************
+	Replace the property table with a shared one
+*************************************************************************/
+void PropertySet::sharePropertyTable()
+{
+	if (d_propertiesShared || !d_properties)
+		return;
+
+	PropertyTablePool& pool = getPropertyTablePool();
+	const size_t hash = hashPropertyTable(*d_properties);
+
+	auto range = pool.d_tables.equal_range(hash);
+	for (auto it = range.first; it != range.second; /**/)
+	{
+		std::shared_ptr<PropertyTable> table = it->second.lock();
+		if (!table)
+		{
+			it = pool.d_tables.erase(it);
+			continue;
+		}
+
+		if (isSamePropertyTable(*table, *d_properties))
+		{
+			d_properties = std::move(table);
+			d_propertiesShared = true;
+			return;
+		}
+
+		++it;
+	}
+
+	// This is the first set with these properties, its table becomes the shared one
+	if (pool.d_tables.size() >= pool.d_purgeThreshold)
+	{
+		for (auto it = pool.d_tables.begin(); it != pool.d_tables.end(); /**/)
+		{
+			if (it->second.expired())
+				it = pool.d_tables.erase(it);
+			else
+				++it;
+		}
+
+		pool.d_purgeThreshold = std::max<size_t>(64, pool.d_tables.size() * 2);
+	}
+
+	pool.d_tables.emplace(hash, d_properties);
+	d_propertiesShared = true;
+}
 
 /*************************************************************************
 	Add a new property to the set
@@ -42,7 +199,7 @@ void PropertySet::addProperty(Property* property)
 		throw NullObjectException("The given Property object pointer is invalid.");
 	}
 
-	if (!d_properties.insert(std::make_pair(property->getName(), property)).second)
+	if (!getWritablePropertyTable().insert(std::make_pair(property->getName(), property)).second)
 	{
 		throw AlreadyExistsException("A Property named '" + property->getName() + "' already exists in the PropertySet.");
 	}
@@ -55,12 +212,10 @@ void PropertySet::addProperty(Property* property)
 *************************************************************************/
 void PropertySet::removeProperty(const String& name)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
+	if (!findProperty(name))
+		return;
 
-	if (pos != d_properties.end())
-	{
-		d_properties.erase(pos);
-	}
+	getWritablePropertyTable().erase(name);
 }
 
 /*************************************************************************
@@ -68,14 +223,14 @@ void PropertySet::removeProperty(const String& name)
 *************************************************************************/
 Property* PropertySet::getPropertyInstance(const String& name) const
 {
-    PropertyRegistry::const_iterator pos = d_properties.find(name);
+    Property* property = findProperty(name);
 
-    if (pos == d_properties.end())
+    if (!property)
     {
         throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
     }
 
-    return pos->second;
+    return property;
 }
 
 /*************************************************************************
@@ -83,7 +238,8 @@ Property* PropertySet::getPropertyInstance(const String& name) const
 *************************************************************************/
 void PropertySet::clearProperties(void)
 {
-	d_properties.clear();
+	d_properties.reset();
+	d_propertiesShared = false;
 }
 
 /*************************************************************************
@@ -91,7 +247,7 @@ void PropertySet::clearProperties(void)
 *************************************************************************/
 bool PropertySet::isPropertyPresent(const String& name) const
 {
-	return (d_properties.find(name) != d_properties.end());
+	return findProperty(name) != nullptr;
 }
 
 /*************************************************************************
@@ -99,14 +255,14 @@ bool PropertySet::isPropertyPresent(const String& name) const
 *************************************************************************/
 const String& PropertySet::getPropertyHelp(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	Property* property = findProperty(name);
 
-	if (pos == d_properties.end())
+	if (!property)
 	{
 		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
 	}
 
-	return pos->second->getHelp();
+	return property->getHelp();
 }
 
 /*************************************************************************
@@ -114,14 +270,14 @@ const String& PropertySet::getPropertyHelp(const String& name) const
 *************************************************************************/
 String PropertySet::getProperty(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	Property* property = findProperty(name);
 
-	if (pos == d_properties.end())
+	if (!property)
 	{
 		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
 	}
 
-	return pos->second->get(this);
+	return property->get(this);
 }
 
 /*************************************************************************
@@ -129,14 +285,14 @@ String PropertySet::getProperty(const String& name) const
 *************************************************************************/
 void PropertySet::setProperty(const String& name,const String& value)
 {
-	PropertyRegistry::iterator pos = d_properties.find(name);
+	Property* property = findProperty(name);
 
-	if (pos == d_properties.end())
+	if (!property)
 	{
 		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
 	}
 
-	pos->second->set(this, value);
+	property->set(this, value);
 }
 
 
@@ -146,7 +302,9 @@ void PropertySet::setProperty(const String& name,const String& value)
 *************************************************************************/
 PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 {
-	return PropertyIterator(d_properties.begin(), d_properties.end());
+	static const PropertyRegistry emptyRegistry;
+	const PropertyRegistry& registry = d_properties ? *d_properties : emptyRegistry;
+	return PropertyIterator(registry.begin(), registry.end());
 }
 
 
@@ -155,14 +313,14 @@ PropertySet::PropertyIterator PropertySet::getPropertyIterator(void) const
 *************************************************************************/
 bool PropertySet::isPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	Property* property = findProperty(name);
 
-	if (pos == d_properties.end())
+	if (!property)
 	{
 		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
 	}
 
-	return pos->second->isDefault(this);
+	return property->isDefault(this);
 }
 
 
@@ -171,14 +329,14 @@ bool PropertySet::isPropertyDefault(const String& name) const
 *************************************************************************/
 String PropertySet::getPropertyDefault(const String& name) const
 {
-	PropertyRegistry::const_iterator pos = d_properties.find(name);
+	Property* property = findProperty(name);
 
-	if (pos == d_properties.end())
+	if (!property)
 	{
 		throw UnknownObjectException("There is no Property named '" + name + "' available in the set.");
 	}
 
-	return pos->second->getDefault(this);
+	return property->getDefault(this);
 }
 
 } // End of  CEGUI namespace section
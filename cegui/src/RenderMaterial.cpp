@@ -57,6 +57,17 @@ void RenderMaterial::setMainTexture(const Texture* texture)
     }
 }
 
+//----------------------------------------------------------------------------//
+void RenderMaterial::copyParametersFrom(const RenderMaterial& other)
+{
+    d_shaderParamBindings.copyFrom(other.d_shaderParamBindings);
+
+    // the main texture parameter may have been replaced or removed
+    ShaderParameter* mainTextureParam = d_shaderParamBindings.getParameter(MainTextureParameterName);
+    d_mainTextureParam = (mainTextureParam && mainTextureParam->getType() == ShaderParamType::Texture) ?
+        static_cast<ShaderParameterTexture*>(mainTextureParam) : nullptr;
+}
+
 //----------------------------------------------------------------------------//
 const Texture* RenderMaterial::getMainTexture() const
 {
@@ -34,10 +34,20 @@ namespace CEGUI
 //----------------------------------------------------------------------------//
 void RenderQueue::draw(std::uint32_t drawModeMask) const
 {
-    // draw the buffers
-    BufferList::const_iterator i = d_buffers.begin();
-    for ( ; i != d_buffers.end(); ++i)
-        (*i)->draw(drawModeMask);
+    size_t next = 0;
+
+    // draw the buffers, with referenced lists in between
+    for (const auto& positionAndList : d_bufferLists)
+    {
+        for ( ; next < positionAndList.first; ++next)
+            d_buffers[next]->draw(drawModeMask);
+
+        for (auto buffer : *positionAndList.second)
+            buffer->draw(drawModeMask);
+    }
+
+    for ( ; next < d_buffers.size(); ++next)
+        d_buffers[next]->draw(drawModeMask);
 }
 
 //----------------------------------------------------------------------------//
@@ -52,19 +62,68 @@ void RenderQueue::addGeometryBuffer(GeometryBuffer& geometry_buffer)
     d_buffers.push_back(&geometry_buffer);
 }
 
+//----------------------------------------------------------------------------//
+void RenderQueue::addGeometryBufferList(const BufferList& geometry_buffers)
+{
+    d_bufferLists.emplace_back(d_buffers.size(), &geometry_buffers);
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::resolveGeometryBufferLists()
+{
+    if (d_bufferLists.empty())
+        return;
+
+    d_buffers.swap(getBuffers());
+    d_bufferLists.clear();
+}
+
 //----------------------------------------------------------------------------//
 void RenderQueue::removeGeometryBuffer(const GeometryBuffer& geometry_buffer)
 {
     BufferList::iterator i = std::find(d_buffers.begin(), d_buffers.end(),
                                        &geometry_buffer);
-    if (i != d_buffers.end())
-        d_buffers.erase(i);
+    if (i == d_buffers.end())
+        return;
+
+    const size_t index = static_cast<size_t>(i - d_buffers.begin());
+    d_buffers.erase(i);
+
+    for (auto& positionAndList : d_bufferLists)
+        if (positionAndList.first > index)
+            --positionAndList.first;
 }
 
 //----------------------------------------------------------------------------//
 void RenderQueue::reset()
 {
     d_buffers.clear();
+    d_bufferLists.clear();
+}
+
+//----------------------------------------------------------------------------//
+RenderQueue::BufferList& RenderQueue::getBuffers()
+{
+    if (d_bufferLists.empty())
+        return d_buffers;
+
+    d_mergedBuffers.clear();
+
+    size_t next = 0;
+    for (const auto& positionAndList : d_bufferLists)
+    {
+        d_mergedBuffers.insert(d_mergedBuffers.end(), d_buffers.begin() + next,
+                               d_buffers.begin() + positionAndList.first);
+        d_mergedBuffers.insert(d_mergedBuffers.end(),
+                               positionAndList.second->begin(),
+                               positionAndList.second->end());
+        next = positionAndList.first;
+    }
+
+    d_mergedBuffers.insert(d_mergedBuffers.end(), d_buffers.begin() + next,
+                           d_buffers.end());
+
+    return d_mergedBuffers;
 }
 
 //----------------------------------------------------------------------------//
@@ -26,11 +26,33 @@
  ***************************************************************************/
 #include "CEGUI/Renderer.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryRecorder.h"
 #include "CEGUI/RenderMaterial.h"
 #include "CEGUI/FontManager.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Exceptions.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace CEGUI
 {
+namespace
+{
+//! Size, in pixels, of the smallest size class of pooled TextureTargets.
+const float MinPooledTextureTargetSize = 64.0f;
+
+//----------------------------------------------------------------------------//
+// Key of the pool bucket for targets of at least 2^widthExp x 2^heightExp
+// pixels with the given stencil usage.
+std::uint32_t textureTargetPoolKey(int widthExp, int heightExp, bool stencil)
+{
+    return (stencil ? 0x10000u : 0u) |
+        (static_cast<std::uint32_t>(widthExp) << 8) |
+        static_cast<std::uint32_t>(heightExp);
+}
+
+}
 
 //----------------------------------------------------------------------------//
 Renderer::Renderer(float fontScale)
@@ -40,13 +62,21 @@ Renderer::Renderer(float fontScale)
 
 //----------------------------------------------------------------------------//
 Renderer::~Renderer()
+{
+    deleteAllGeometryBuffers();
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::deleteAllGeometryBuffers()
 {
     for (auto buffer : d_geometryBuffers)
         delete buffer;
+    d_geometryBuffers.clear();
 
     for (auto& pair : d_geomeryBufferPool)
         for (auto buffer : pair.second)
             delete buffer;
+    d_geomeryBufferPool.clear();
 }
 
 //----------------------------------------------------------------------------//
@@ -82,6 +112,9 @@ void Renderer::destroyAllGeometryBuffers()
 //----------------------------------------------------------------------------//
 GeometryBuffer& Renderer::createGeometryBufferTextured()
 {
+    if (GeometryRecorder* recorder = GeometryRecorder::getCurrent())
+        return recorder->createGeometryBufferTextured();
+
     // FIXME: see field comment!
     if (!d_texturedShader)
         if (auto mtl = createRenderMaterial(DefaultShaderType::Textured))
@@ -102,6 +135,9 @@ GeometryBuffer& Renderer::createGeometryBufferTextured()
 //----------------------------------------------------------------------------//
 GeometryBuffer& Renderer::createGeometryBufferColoured()
 {
+    if (GeometryRecorder* recorder = GeometryRecorder::getCurrent())
+        return recorder->createGeometryBufferColoured();
+
     // FIXME: see field comment!
     if (!d_coloredShader)
         if (auto mtl = createRenderMaterial(DefaultShaderType::Solid))
@@ -119,6 +155,126 @@ GeometryBuffer& Renderer::createGeometryBufferColoured()
     return createGeometryBufferColoured(createRenderMaterial(DefaultShaderType::Solid));
 }
 
+//----------------------------------------------------------------------------//
+TextureTarget* Renderer::acquireTextureTarget(const Sizef& size, bool addStencilBuffer)
+{
+    ++d_textureTargetPoolStats.acquisitions;
+
+    const Sizef sizeClass = getTextureTargetSizeClass(size);
+
+    // find the smallest pooled target that is large enough
+    std::vector<TextureTarget*>* bestBucket = nullptr;
+    float bestArea = std::numeric_limits<float>::max();
+    for (auto& bucket : d_textureTargetPool)
+    {
+        if (bucket.second.empty() || ((bucket.first & 0x10000u) != 0) != addStencilBuffer)
+            continue;
+
+        const float width = std::ldexp(1.0f, (bucket.first >> 8) & 0xff);
+        const float height = std::ldexp(1.0f, bucket.first & 0xff);
+        if (width < sizeClass.d_width || height < sizeClass.d_height ||
+            width * height >= bestArea)
+            continue;
+
+        bestBucket = &bucket.second;
+        bestArea = width * height;
+    }
+
+    if (bestBucket)
+    {
+        TextureTarget* target = bestBucket->back();
+        bestBucket->pop_back();
+        --d_textureTargetPoolStats.pooledTargets;
+        ++d_textureTargetPoolStats.hits;
+        target->clear();
+        return target;
+    }
+
+    TextureTarget* target = createTextureTarget(addStencilBuffer);
+    if (!target)
+        return nullptr;
+
+    try
+    {
+        target->declareRenderSize(sizeClass);
+    }
+    catch (const InvalidRequestException&)
+    {
+        // the rounded up size may exceed what the renderer supports
+        target->declareRenderSize(size);
+    }
+
+    return target;
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::releaseTextureTarget(TextureTarget* target)
+{
+    if (!target)
+        return;
+
+    if (d_textureTargetPoolStats.pooledTargets >= d_textureTargetPoolCapacity)
+    {
+        destroyTextureTarget(target);
+        ++d_textureTargetPoolStats.evictions;
+        return;
+    }
+
+    // file the target under the largest size class it can hold entirely
+    const Sizef& size = target->getArea().getSize();
+    const int widthExp = static_cast<int>(std::floor(std::log2(
+        std::max(size.d_width, MinPooledTextureTargetSize))));
+    const int heightExp = static_cast<int>(std::floor(std::log2(
+        std::max(size.d_height, MinPooledTextureTargetSize))));
+
+    d_textureTargetPool[textureTargetPoolKey(widthExp, heightExp,
+        target->getUsesStencil())].push_back(target);
+    ++d_textureTargetPoolStats.pooledTargets;
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::clearTextureTargetPool()
+{
+    std::map<std::uint32_t, std::vector<TextureTarget*>> pool;
+    pool.swap(d_textureTargetPool);
+    d_textureTargetPoolStats.pooledTargets = 0;
+
+    for (auto& bucket : pool)
+        for (auto target : bucket.second)
+            destroyTextureTarget(target);
+}
+
+//----------------------------------------------------------------------------//
+void Renderer::setTextureTargetPoolCapacity(size_t capacity)
+{
+    d_textureTargetPoolCapacity = capacity;
+
+    for (auto& bucket : d_textureTargetPool)
+    {
+        while (!bucket.second.empty() &&
+               d_textureTargetPoolStats.pooledTargets > d_textureTargetPoolCapacity)
+        {
+            destroyTextureTarget(bucket.second.back());
+            bucket.second.pop_back();
+            --d_textureTargetPoolStats.pooledTargets;
+            ++d_textureTargetPoolStats.evictions;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+Sizef Renderer::getTextureTargetSizeClass(const Sizef& size)
+{
+    Sizef sizeClass(MinPooledTextureTargetSize, MinPooledTextureTargetSize);
+
+    while (sizeClass.d_width < size.d_width)
+        sizeClass.d_width *= 2.0f;
+    while (sizeClass.d_height < size.d_height)
+        sizeClass.d_height *= 2.0f;
+
+    return sizeClass;
+}
+
 //----------------------------------------------------------------------------//
 void Renderer::invalidateGeomBufferMatrices(const CEGUI::RenderTarget* renderTarget)
 {
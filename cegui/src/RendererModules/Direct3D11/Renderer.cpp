@@ -193,6 +193,8 @@ void Direct3D11Renderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void Direct3D11Renderer::destroyAllTextureTargets()
 {
+    clearTextureTargetPool();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
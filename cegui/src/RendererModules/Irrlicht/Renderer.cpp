@@ -196,6 +196,8 @@ void IrrlichtRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void IrrlichtRenderer::destroyAllTextureTargets()
 {
+    clearTextureTargetPool();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
@@ -182,6 +182,8 @@ void NullRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void NullRenderer::destroyAllTextureTargets()
 {
+    clearTextureTargetPool();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
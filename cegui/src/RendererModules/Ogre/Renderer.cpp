@@ -622,6 +622,8 @@ void OgreRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void OgreRenderer::destroyAllTextureTargets()
 {
+    clearTextureTargetPool();
+
     while (!d_pimpl->d_textureTargets.empty())
         destroyTextureTarget(*d_pimpl->d_textureTargets.begin());
 }
@@ -56,6 +56,10 @@ OpenGL3GeometryBuffer::OpenGL3GeometryBuffer(OpenGL3Renderer& owner, CEGUI::RefC
 //----------------------------------------------------------------------------//
 OpenGL3GeometryBuffer::~OpenGL3GeometryBuffer()
 {
+#ifdef CEGUI_OPENGL_BIG_BUFFER
+    if (d_arena)
+        d_arena->release(d_arenaAllocation);
+#endif
     deinitialiseOpenGLBuffers();
 }
 
@@ -252,6 +256,25 @@ void OpenGL3GeometryBuffer::onGeometryChanged()
         glBufferData(GL_ARRAY_BUFFER, vertexCount * sizeof(float), d_vertexData.data(), GL_STATIC_DRAW);
     else
         glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount * sizeof(float), d_vertexData.data());
+#else
+    // the renderer copies the vertices into its arena before drawing
+    d_arenaAllocation.markAllDirty();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::onGeometryRangeChanged(size_t first_vertex, size_t vertex_count)
+{
+#ifndef CEGUI_OPENGL_BIG_BUFFER
+    // the vertex count is unchanged, so the buffer object is always big enough
+    const size_t stride = static_cast<size_t>(getVertexAttributeElementCount());
+    const size_t firstFloat = first_vertex * stride;
+
+    d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesVBO);
+    glBufferSubData(GL_ARRAY_BUFFER, firstFloat * sizeof(float),
+                    vertex_count * stride * sizeof(float), d_vertexData.data() + firstFloat);
+#else
+    d_arenaAllocation.markDirty(first_vertex, vertex_count);
 #endif
 }
 
@@ -30,6 +30,7 @@
 #include "CEGUI/RendererModules/OpenGL/GL3Texture.h"
 #include "CEGUI/RendererModules/OpenGL/Shader.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/FrameProfiler.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/DynamicModule.h"
 #include "CEGUI/RendererModules/OpenGL/ViewportTarget.h"
@@ -247,6 +248,9 @@ void OpenGL3Renderer::init()
 OpenGL3Renderer::~OpenGL3Renderer()
 {
 #ifdef CEGUI_OPENGL_BIG_BUFFER
+    // the GeometryBuffers release their vertices from the arenas
+    deleteAllGeometryBuffers();
+
     glDeleteVertexArrays(1, &d_verticesTexturedVAO);
     glDeleteVertexArrays(1, &d_verticesSolidVAO);
     glDeleteBuffers(1, &d_verticesSolidVBO);
@@ -420,71 +424,87 @@ RefCounted<RenderMaterial> OpenGL3Renderer::createRenderMaterial(const DefaultSh
 void OpenGL3Renderer::uploadBuffers(RenderingSurface& surface)
 {
 #ifdef CEGUI_OPENGL_BIG_BUFFER
-    d_vertex_data_solid.clear();
-    d_vertex_data_textured.clear();
-
     for(auto &queue : surface.getRenderQueueList())
     {
         addGeometry(queue.second.getBuffers());
     }
 
-
-    uploadVertexData(d_vertex_data_solid, d_verticesSolidVBO, d_verticesSolidVBOSize);
-    uploadVertexData(d_vertex_data_textured, d_verticesTexturedVBO, d_verticesTexturedVBOSize);
-
+    uploadVertexData(d_vertexArenaSolid, d_verticesSolidVBO);
+    uploadVertexData(d_vertexArenaTextured, d_verticesTexturedVBO);
+#else
+    CEGUI_UNUSED(surface);
 #endif
 }
 
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::uploadBuffers(const std::vector<GeometryBuffer*>& buffers)
 {
-    // keep the vertex vector reserved memory so it is not constantly recreated
-    d_vertex_data_solid.clear();
-    d_vertex_data_textured.clear();
-
+#ifdef CEGUI_OPENGL_BIG_BUFFER
     addGeometry(buffers);
-    uploadVertexData(d_vertex_data_solid, d_verticesSolidVBO, d_verticesSolidVBOSize);
-    uploadVertexData(d_vertex_data_textured, d_verticesTexturedVBO, d_verticesTexturedVBOSize);
+    uploadVertexData(d_vertexArenaSolid, d_verticesSolidVBO);
+    uploadVertexData(d_vertexArenaTextured, d_verticesTexturedVBO);
+#else
+    CEGUI_UNUSED(buffers);
+#endif
 }
 
+#ifdef CEGUI_OPENGL_BIG_BUFFER
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::addGeometry(const std::vector<GeometryBuffer*>& buffers)
 {
     for (auto buffer : buffers)
     {
-        const auto& data = buffer->getVertexData();
-        if (data.empty())
-            continue;
-
-        const auto element_count = buffer->getVertexAttributeElementCount();
-        auto& destBuffer = (element_count == 9) ? d_vertex_data_textured : d_vertex_data_solid;
-
-        static_cast<OpenGL3GeometryBuffer*>(buffer)->d_verticesVBOPosition = destBuffer.size() / element_count;
-        destBuffer.reserve(destBuffer.size() + data.size());
-        std::copy(data.begin(), data.end(), std::back_inserter(destBuffer));
+        auto glBuffer = static_cast<OpenGL3GeometryBuffer*>(buffer);
+
+        VertexBufferArena& arena = (buffer->getVertexAttributeElementCount() == 9) ?
+            d_vertexArenaTextured : d_vertexArenaSolid;
+
+        // the vertex layout of the buffer changed since it was placed
+        if (glBuffer->d_arena != &arena)
+        {
+            if (glBuffer->d_arena)
+                glBuffer->d_arena->release(glBuffer->d_arenaAllocation);
+            glBuffer->d_arena = &arena;
+        }
+
+        // only copies the vertices that changed since the last upload
+        const GeometryBuffer::VertexData& vertexData = buffer->getVertexData();
+        if (arena.update(glBuffer->d_arenaAllocation, vertexData.data(), vertexData.size()))
+            glBuffer->d_verticesVBOPosition = glBuffer->d_arenaAllocation.getFirstVertex();
     }
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3Renderer::uploadVertexData(std::vector<float>& vertex_data, GLuint vbo_id, GLuint &vbo_max_size)
+void OpenGL3Renderer::uploadVertexData(VertexBufferArena& arena, GLuint vbo_id)
 {
-    if(vertex_data.empty())
-    {
-        return;
-    }
+    CEGUI_PROFILE_SCOPE("OpenGL3Renderer::uploadVertexData");
+
+    const std::vector<float>& vertex_data = arena.getData();
 
-    d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vbo_id);
-    // need a bigger buffer
-    if(vertex_data.size() * sizeof(float) > vbo_max_size)
+    if (arena.isFullUploadNeeded())
     {
-        glBufferData(GL_ARRAY_BUFFER, vertex_data.size() * sizeof(float), &vertex_data[0], GL_DYNAMIC_DRAW);
-        vbo_max_size = static_cast<GLuint>(vertex_data.size() * sizeof(float));
+        // the arena grew, so the buffer object has to be recreated
+        if (!vertex_data.empty())
+        {
+            d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vbo_id);
+            glBufferData(GL_ARRAY_BUFFER, vertex_data.size() * sizeof(float), vertex_data.data(), GL_DYNAMIC_DRAW);
+        }
     }
     else
     {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, vertex_data.size() * sizeof(float), &vertex_data[0]);
+        const auto& ranges = arena.getUploadRanges();
+        if (!ranges.empty())
+        {
+            d_openGLStateChanger->bindBuffer(GL_ARRAY_BUFFER, vbo_id);
+            for (const auto& range : ranges)
+                glBufferSubData(GL_ARRAY_BUFFER, range.first * sizeof(float),
+                                range.second * sizeof(float), vertex_data.data() + range.first);
+        }
     }
+
+    arena.clearUploadRanges();
 }
+#endif
 
 //----------------------------------------------------------------------------//
 void OpenGL3Renderer::initialiseStandardTexturedShaderWrapper()
@@ -203,6 +203,8 @@ void OpenGLRendererBase::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void OpenGLRendererBase::destroyAllTextureTargets()
 {
+    clearTextureTargetPool();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
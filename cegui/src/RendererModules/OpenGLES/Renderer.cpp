@@ -307,6 +307,8 @@ void OpenGLESRenderer::destroyTextureTarget(TextureTarget* target)
 //----------------------------------------------------------------------------//
 void OpenGLESRenderer::destroyAllTextureTargets()
 {
+    clearTextureTargetPool();
+
     while (!d_textureTargets.empty())
         destroyTextureTarget(*d_textureTargets.begin());
 }
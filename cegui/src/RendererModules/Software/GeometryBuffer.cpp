@@ -0,0 +1,190 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/RenderTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/RenderEffect.h"
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::SoftwareGeometryBuffer(SoftwareRenderer& owner,
+        CEGUI::RefCounted<RenderMaterial> renderMaterial) :
+    GeometryBuffer(renderMaterial),
+    d_owner(owner),
+    d_matrix(1.0f)
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::draw(std::uint32_t drawModeMask) const
+{
+    CEGUI_UNUSED(drawModeMask);
+
+    SoftwareRenderTarget* target = d_owner.getActiveSoftwareRenderTarget();
+    if (d_vertexData.empty() || !target)
+        return;
+
+    const Rectf& area = target->getArea();
+    const int targetWidth = static_cast<int>(area.getWidth());
+    const int targetHeight = static_cast<int>(area.getHeight());
+
+    int clipLeft = 0;
+    int clipTop = 0;
+    int clipRight = targetWidth;
+    int clipBottom = targetHeight;
+
+    if (d_clippingActive)
+    {
+        // Skip completely clipped geometry
+        const int w = static_cast<int>(d_preparedClippingRegion.getWidth());
+        const int h = static_cast<int>(d_preparedClippingRegion.getHeight());
+        if (!w || !h)
+            return;
+
+        // same rounding as the scissor rectangle of the OpenGL renderers,
+        // which is specified from the bottom of the target.
+        const int glY = static_cast<int>(area.getHeight() - d_preparedClippingRegion.bottom());
+        clipLeft = static_cast<int>(d_preparedClippingRegion.left());
+        clipRight = clipLeft + w;
+        clipBottom = targetHeight - glY;
+        clipTop = clipBottom - h;
+    }
+
+    const SoftwareTexture* texture = nullptr;
+    if (static_cast<size_t>(getVertexAttributeElementCount()) == TEXTURED_VERTEX_FLOAT_COUNT)
+    {
+        texture = static_cast<const SoftwareTexture*>(getMainTexture());
+        if (!texture || !texture->hasPixels())
+            return;
+    }
+
+    // Update the model view projection matrix
+    updateMatrix();
+
+    const int pass_count = d_effect ? d_effect->getPassCount() : 1;
+    for (int pass = 0; pass < pass_count; ++pass)
+    {
+        // set up RenderEffect
+        if (d_effect)
+            d_effect->performPreRenderFunctions(pass);
+
+        d_renderMaterial->prepareForRendering();
+
+        recordCommand(target->getPendingCommands(), texture,
+                      clipLeft, clipTop, clipRight, clipBottom);
+    }
+
+    // clean up RenderEffect
+    if (d_effect)
+        d_effect->performPostRenderFunctions();
+
+    updateRenderTargetData(d_owner.getActiveRenderTarget());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::updateMatrix() const
+{
+    if (!d_matrixValid || !isRenderTargetDataValid(d_owner.getActiveRenderTarget()))
+    {
+        // Apply the view projection matrix to the model matrix and save the result as cached matrix
+        d_matrix = d_owner.getViewProjectionMatrix() * getModelMatrix();
+
+        d_matrixValid = true;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::recordCommand(
+    SoftwareRasteriser::CommandList& commands, const SoftwareTexture* texture,
+    int clipLeft, int clipTop, int clipRight, int clipBottom) const
+{
+    const Rectf& area = d_owner.getActiveSoftwareRenderTarget()->getArea();
+    const size_t stride = getVertexAttributeElementCount();
+    const size_t triangleCount = d_vertexCount / 3;
+    const size_t stencilTriangleCount =
+        d_polygonFillRule == PolygonFillRule::NoFilling ? 0 :
+        (d_vertexCount - d_postStencilVertexCount) / 3;
+
+    SoftwareRasteriser::Command command;
+    command.texture = texture;
+    command.blendMode = d_blendMode;
+    command.fillRule = d_polygonFillRule;
+    command.clipLeft = clipLeft;
+    command.clipTop = clipTop;
+    command.clipRight = clipRight;
+    command.clipBottom = clipBottom;
+    command.firstTriangle = static_cast<std::uint32_t>(commands.triangles.size());
+    command.stencilTriangleCount = 0;
+    command.triangleCount = 0;
+
+    commands.triangles.reserve(commands.triangles.size() + triangleCount);
+
+    const float* data = d_vertexData.data();
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        SoftwareRasteriser::Triangle triangle;
+        bool visible = true;
+
+        for (int i = 0; i < 3; ++i, data += stride)
+        {
+            const glm::vec4 clip = d_matrix * glm::vec4(data[0], data[1], data[2], 1.0f);
+
+            // the GUI never places geometry behind the viewer; rather than
+            // clipping against the near plane such triangles are dropped.
+            if (clip.w <= 0.0f)
+                visible = false;
+
+            SoftwareRasteriser::Vertex& v = triangle.v[i];
+            v.invW = 1.0f / clip.w;
+            v.x = area.left() + (clip.x * v.invW * 0.5f + 0.5f) * area.getWidth();
+            v.y = area.top() + (0.5f - clip.y * v.invW * 0.5f) * area.getHeight();
+            v.colour[0] = data[3];
+            v.colour[1] = data[4];
+            v.colour[2] = data[5];
+            v.colour[3] = data[6] * d_alpha;
+            v.u = texture ? data[7] : 0.0f;
+            v.v = texture ? data[8] : 0.0f;
+        }
+
+        if (!visible)
+            continue;
+
+        commands.triangles.push_back(triangle);
+        ++command.triangleCount;
+        if (t < stencilTriangleCount)
+            ++command.stencilTriangleCount;
+    }
+
+    if (command.triangleCount)
+        commands.commands.push_back(command);
+}
+
+//----------------------------------------------------------------------------//
+
+}
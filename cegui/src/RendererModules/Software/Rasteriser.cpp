@@ -0,0 +1,548 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define CEGUI_SOFTWARE_RASTERISER_SSE2
+#   include <emmintrin.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+//! Four floats processed together; one lane per pixel.
+struct Float4
+{
+#ifdef CEGUI_SOFTWARE_RASTERISER_SSE2
+    Float4(__m128 value) : d_value(value) {}
+    explicit Float4(float value) : d_value(_mm_set1_ps(value)) {}
+    Float4(float a, float b, float c, float d) : d_value(_mm_setr_ps(a, b, c, d)) {}
+
+    Float4 operator+(const Float4& other) const { return _mm_add_ps(d_value, other.d_value); }
+    Float4 operator*(const Float4& other) const { return _mm_mul_ps(d_value, other.d_value); }
+
+    //! bit mask of the lanes that are > 0 (or >= 0 if \a inclusive).
+    int positiveMask(bool inclusive) const
+    {
+        const __m128 zero = _mm_setzero_ps();
+        return _mm_movemask_ps(inclusive ? _mm_cmpge_ps(d_value, zero) :
+                                           _mm_cmpgt_ps(d_value, zero));
+    }
+
+    Float4 reciprocal() const { return _mm_div_ps(_mm_set1_ps(1.0f), d_value); }
+
+    void store(float* out) const { _mm_storeu_ps(out, d_value); }
+
+    __m128 d_value;
+#else
+    explicit Float4(float value) { d_value[0] = d_value[1] = d_value[2] = d_value[3] = value; }
+    Float4(float a, float b, float c, float d) { d_value[0] = a; d_value[1] = b; d_value[2] = c; d_value[3] = d; }
+
+    Float4 operator+(const Float4& other) const
+    {
+        return Float4(d_value[0] + other.d_value[0], d_value[1] + other.d_value[1],
+                      d_value[2] + other.d_value[2], d_value[3] + other.d_value[3]);
+    }
+
+    Float4 operator*(const Float4& other) const
+    {
+        return Float4(d_value[0] * other.d_value[0], d_value[1] * other.d_value[1],
+                      d_value[2] * other.d_value[2], d_value[3] * other.d_value[3]);
+    }
+
+    int positiveMask(bool inclusive) const
+    {
+        int mask = 0;
+        for (int i = 0; i < 4; ++i)
+            if (inclusive ? d_value[i] >= 0.0f : d_value[i] > 0.0f)
+                mask |= 1 << i;
+        return mask;
+    }
+
+    Float4 reciprocal() const
+    {
+        return Float4(1.0f / d_value[0], 1.0f / d_value[1],
+                      1.0f / d_value[2], 1.0f / d_value[3]);
+    }
+
+    void store(float* out) const { std::copy(d_value, d_value + 4, out); }
+
+    float d_value[4];
+#endif
+};
+
+//----------------------------------------------------------------------------//
+inline float clamp01(float value)
+{
+    return value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+}
+
+//----------------------------------------------------------------------------//
+inline std::uint8_t toByte(float value)
+{
+    return static_cast<std::uint8_t>(clamp01(value) * 255.0f + 0.5f);
+}
+
+//----------------------------------------------------------------------------//
+//! blend \a src (0 to 1, not premultiplied) into the RGBA pixel at \a dst.
+inline void blendPixel(std::uint8_t* dst, const float* src, BlendMode mode)
+{
+    const float scale = 1.0f / 255.0f;
+    const float srcAlpha = clamp01(src[3]);
+    const float invSrcAlpha = 1.0f - srcAlpha;
+
+    if (mode == BlendMode::RttPremultiplied)
+    {
+        // ONE, ONE_MINUS_SRC_ALPHA
+        for (int i = 0; i < 4; ++i)
+            dst[i] = toByte(clamp01(src[i]) + dst[i] * scale * invSrcAlpha);
+    }
+    else
+    {
+        // SRC_ALPHA, ONE_MINUS_SRC_ALPHA for colour and
+        // ONE_MINUS_DST_ALPHA, ONE for alpha
+        if (srcAlpha <= 0.0f)
+            return;
+
+        for (int i = 0; i < 3; ++i)
+            dst[i] = toByte(clamp01(src[i]) * srcAlpha + dst[i] * scale * invSrcAlpha);
+
+        const float dstAlpha = dst[3] * scale;
+        dst[3] = toByte(srcAlpha * (1.0f - dstAlpha) + dstAlpha);
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::SoftwareRasteriser(unsigned int threadCount) :
+    d_generation(0),
+    d_busyWorkers(0),
+    d_stopping(false),
+    d_commands(nullptr),
+    d_target(nullptr),
+    d_targetWidth(0),
+    d_targetHeight(0),
+    d_tilesX(0),
+    d_tilesY(0),
+    d_nextTile(0),
+    d_stencil(TileSize * TileSize)
+{
+    startThreads(threadCount);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::~SoftwareRasteriser()
+{
+    stopThreads();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setThreadCount(unsigned int threadCount)
+{
+    stopThreads();
+    startThreads(threadCount);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::startThreads(unsigned int threadCount)
+{
+    if (!threadCount)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    d_stopping = false;
+
+    // workers only react to executes started after they were created.
+    for (unsigned int i = 1; i < threadCount; ++i)
+        d_threads.push_back(std::thread(&SoftwareRasteriser::workerMain, this,
+                                        d_generation));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::stopThreads()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopping = true;
+    }
+    d_workAvailable.notify_all();
+
+    for (std::thread& thread : d_threads)
+        thread.join();
+
+    d_threads.clear();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::workerMain(std::uint64_t generation)
+{
+    std::vector<std::int32_t> stencil(TileSize * TileSize);
+
+    std::unique_lock<std::mutex> lock(d_mutex);
+
+    for (;;)
+    {
+        d_workAvailable.wait(lock, [&]
+            { return d_stopping || d_generation != generation; });
+
+        if (d_stopping)
+            return;
+
+        generation = d_generation;
+
+        lock.unlock();
+        renderTiles(stencil);
+        lock.lock();
+
+        if (--d_busyWorkers == 0)
+            d_workDone.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::execute(const CommandList& commands,
+                                 SoftwareTexture& target)
+{
+    d_commands = &commands;
+    d_target = &target;
+    d_targetWidth = target.getPixelWidth();
+    d_targetHeight = target.getPixelHeight();
+    d_tilesX = (d_targetWidth + TileSize - 1) / TileSize;
+    d_tilesY = (d_targetHeight + TileSize - 1) / TileSize;
+
+    binTriangles();
+
+    d_nextTile = 0;
+
+    if (d_threads.empty() || d_activeTiles.size() < 2)
+        renderTiles(d_stencil);
+    else
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            ++d_generation;
+            d_busyWorkers = static_cast<unsigned int>(d_threads.size());
+        }
+        d_workAvailable.notify_all();
+
+        renderTiles(d_stencil);
+
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_workDone.wait(lock, [this] { return d_busyWorkers == 0; });
+    }
+
+    d_commands = nullptr;
+    d_target = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRasteriser::setupTriangle(const Command& command,
+                                       const Triangle& triangle,
+                                       TriangleSetup& setup) const
+{
+    const Vertex* v[3] = { &triangle.v[0], &triangle.v[1], &triangle.v[2] };
+
+    float area = (v[1]->x - v[0]->x) * (v[2]->y - v[0]->y) -
+                 (v[1]->y - v[0]->y) * (v[2]->x - v[0]->x);
+
+    // degenerate (or non-finite) triangles cover nothing.
+    if (!(std::fabs(area) > 0.0f) || !std::isfinite(area))
+        return false;
+
+    setup.winding = 1;
+    if (area < 0.0f)
+    {
+        std::swap(v[1], v[2]);
+        area = -area;
+        setup.winding = -1;
+    }
+
+    // edge i is opposite to vertex i; its function is positive inside.
+    for (int i = 0; i < 3; ++i)
+    {
+        const Vertex& a = *v[(i + 1) % 3];
+        const Vertex& b = *v[(i + 2) % 3];
+
+        setup.edgeA[i] = a.y - b.y;
+        setup.edgeB[i] = b.x - a.x;
+        setup.edgeC[i] = a.x * b.y - a.y * b.x;
+
+        // an edge shared by two triangles is traversed in opposite directions
+        // by them, so exactly one of the two owns the pixels on it.
+        setup.edgeInclusive[i] = setup.edgeA[i] > 0.0f ||
+            (setup.edgeA[i] == 0.0f && setup.edgeB[i] > 0.0f);
+    }
+
+    setup.perspective = v[0]->invW != v[1]->invW || v[0]->invW != v[2]->invW;
+
+    // attribute planes, relative to the first vertex for precision.
+    const float invArea = 1.0f / area;
+    for (int k = 0; k < 7; ++k)
+    {
+        float f[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const float value = k < 4 ? v[i]->colour[k] :
+                                (k == 4 ? v[i]->u : (k == 5 ? v[i]->v : 1.0f));
+            f[i] = setup.perspective ? value * v[i]->invW : value;
+        }
+
+        setup.planeX[k] = (f[0] * setup.edgeA[0] + f[1] * setup.edgeA[1] +
+                           f[2] * setup.edgeA[2]) * invArea;
+        setup.planeY[k] = (f[0] * setup.edgeB[0] + f[1] * setup.edgeB[1] +
+                           f[2] * setup.edgeB[2]) * invArea;
+        setup.planeC[k] = f[0];
+    }
+    setup.originX = v[0]->x;
+    setup.originY = v[0]->y;
+
+    // pixels whose centres lie within the bounds, limited to the scissor
+    // rectangle and the target.
+    const float minX = std::min(v[0]->x, std::min(v[1]->x, v[2]->x));
+    const float maxX = std::max(v[0]->x, std::max(v[1]->x, v[2]->x));
+    const float minY = std::min(v[0]->y, std::min(v[1]->y, v[2]->y));
+    const float maxY = std::max(v[0]->y, std::max(v[1]->y, v[2]->y));
+
+    const float limitX = static_cast<float>(d_targetWidth + 1);
+    const float limitY = static_cast<float>(d_targetHeight + 1);
+
+    setup.minX = std::max(std::max(command.clipLeft, 0), static_cast<int>(
+        std::ceil(std::min(std::max(minX - 0.5f, -1.0f), limitX))));
+    setup.maxX = std::min(std::min(command.clipRight, d_targetWidth), static_cast<int>(
+        std::floor(std::min(std::max(maxX - 0.5f, -1.0f), limitX))) + 1);
+    setup.minY = std::max(std::max(command.clipTop, 0), static_cast<int>(
+        std::ceil(std::min(std::max(minY - 0.5f, -1.0f), limitY))));
+    setup.maxY = std::min(std::min(command.clipBottom, d_targetHeight), static_cast<int>(
+        std::floor(std::min(std::max(maxY - 0.5f, -1.0f), limitY))) + 1);
+
+    return setup.minX < setup.maxX && setup.minY < setup.maxY;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::binTriangles()
+{
+    const size_t tileCount = static_cast<size_t>(d_tilesX) * d_tilesY;
+    if (d_bins.size() != tileCount)
+        d_bins.resize(tileCount);
+
+    for (std::vector<std::uint32_t>& bin : d_bins)
+        bin.clear();
+
+    d_setups.clear();
+    d_activeTiles.clear();
+
+    const std::vector<Command>& commands = d_commands->commands;
+    for (size_t c = 0; c < commands.size(); ++c)
+    {
+        const Command& command = commands[c];
+
+        for (std::uint32_t t = 0; t < command.triangleCount; ++t)
+        {
+            TriangleSetup setup;
+            if (!setupTriangle(command,
+                               d_commands->triangles[command.firstTriangle + t],
+                               setup))
+                continue;
+
+            setup.command = static_cast<std::uint32_t>(c);
+            setup.stencilOnly = t < command.stencilTriangleCount;
+
+            const std::uint32_t index = static_cast<std::uint32_t>(d_setups.size());
+            d_setups.push_back(setup);
+
+            for (int ty = setup.minY / TileSize; ty <= (setup.maxY - 1) / TileSize; ++ty)
+                for (int tx = setup.minX / TileSize; tx <= (setup.maxX - 1) / TileSize; ++tx)
+                    d_bins[ty * d_tilesX + tx].push_back(index);
+        }
+    }
+
+    for (size_t i = 0; i < tileCount; ++i)
+        if (!d_bins[i].empty())
+            d_activeTiles.push_back(static_cast<std::uint32_t>(i));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::renderTiles(std::vector<std::int32_t>& stencil)
+{
+    for (;;)
+    {
+        const size_t next = d_nextTile.fetch_add(1);
+        if (next >= d_activeTiles.size())
+            return;
+
+        renderTile(d_activeTiles[next], stencil);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::renderTile(size_t tile,
+                                    std::vector<std::int32_t>& stencil) const
+{
+    const int tileX = static_cast<int>(tile % d_tilesX) * TileSize;
+    const int tileY = static_cast<int>(tile / d_tilesX) * TileSize;
+
+    std::uint32_t lastCommand = std::numeric_limits<std::uint32_t>::max();
+
+    for (std::uint32_t index : d_bins[tile])
+    {
+        const TriangleSetup& setup = d_setups[index];
+
+        // every draw call using a fill rule starts with a cleared stencil.
+        if (setup.command != lastCommand)
+        {
+            lastCommand = setup.command;
+            if (d_commands->commands[lastCommand].fillRule != PolygonFillRule::NoFilling)
+                std::fill(stencil.begin(), stencil.end(), 0);
+        }
+
+        renderTriangle(setup, tileX, tileY, stencil.data());
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::renderTriangle(const TriangleSetup& setup, int tileX,
+                                        int tileY, std::int32_t* stencil) const
+{
+    const Command& command = d_commands->commands[setup.command];
+    const bool useStencil = command.fillRule != PolygonFillRule::NoFilling;
+    const bool evenOdd = command.fillRule == PolygonFillRule::EvenOdd;
+
+    const int x0 = std::max(setup.minX, tileX);
+    const int x1 = std::min(setup.maxX, tileX + TileSize);
+    const int y0 = std::max(setup.minY, tileY);
+    const int y1 = std::min(setup.maxY, tileY + TileSize);
+
+    const Float4 laneOffsets(0.5f, 1.5f, 2.5f, 3.5f);
+    const Float4 edgeA[3] = {
+        Float4(setup.edgeA[0]), Float4(setup.edgeA[1]), Float4(setup.edgeA[2]) };
+    const Float4 planeX[7] = {
+        Float4(setup.planeX[0]), Float4(setup.planeX[1]), Float4(setup.planeX[2]),
+        Float4(setup.planeX[3]), Float4(setup.planeX[4]), Float4(setup.planeX[5]),
+        Float4(setup.planeX[6]) };
+
+    std::uint8_t* pixels = d_target->getPixels();
+
+    for (int y = y0; y < y1; ++y)
+    {
+        const float py = y + 0.5f;
+        const float rowEdge[3] = {
+            setup.edgeB[0] * py + setup.edgeC[0],
+            setup.edgeB[1] * py + setup.edgeC[1],
+            setup.edgeB[2] * py + setup.edgeC[2] };
+
+        const float dy = py - setup.originY;
+        float rowPlane[7];
+        for (int k = 0; k < 7; ++k)
+            rowPlane[k] = setup.planeY[k] * dy + setup.planeC[k];
+
+        std::int32_t* stencilRow = stencil + (y - tileY) * TileSize - tileX;
+        std::uint8_t* pixelRow = pixels + static_cast<size_t>(y) * d_targetWidth * 4;
+
+        for (int x = x0; x < x1; x += 4)
+        {
+            const Float4 px = Float4(static_cast<float>(x)) + laneOffsets;
+
+            int mask = x1 - x >= 4 ? 0xF : (1 << (x1 - x)) - 1;
+            for (int e = 0; e < 3 && mask; ++e)
+                mask &= (edgeA[e] * px + Float4(rowEdge[e])).positiveMask(setup.edgeInclusive[e]);
+
+            if (!mask)
+                continue;
+
+            if (setup.stencilOnly)
+            {
+                for (int lane = 0; lane < 4; ++lane)
+                    if (mask & (1 << lane))
+                    {
+                        if (evenOdd)
+                            stencilRow[x + lane] ^= 1;
+                        else
+                            stencilRow[x + lane] += setup.winding;
+                    }
+                continue;
+            }
+
+            if (useStencil)
+            {
+                for (int lane = 0; lane < 4; ++lane)
+                    if ((mask & (1 << lane)) && !stencilRow[x + lane])
+                        mask &= ~(1 << lane);
+
+                if (!mask)
+                    continue;
+            }
+
+            // interpolate all attributes for the four pixels.
+            const Float4 dx = px + Float4(-setup.originX);
+            float attributes[7][4];
+            if (setup.perspective)
+            {
+                const Float4 w = (planeX[6] * dx + Float4(rowPlane[6])).reciprocal();
+                for (int k = 0; k < 6; ++k)
+                    ((planeX[k] * dx + Float4(rowPlane[k])) * w).store(attributes[k]);
+            }
+            else
+            {
+                for (int k = 0; k < 6; ++k)
+                    (planeX[k] * dx + Float4(rowPlane[k])).store(attributes[k]);
+            }
+
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                if (!(mask & (1 << lane)))
+                    continue;
+
+                float colour[4] = {
+                    attributes[0][lane], attributes[1][lane],
+                    attributes[2][lane], attributes[3][lane] };
+
+                if (command.texture)
+                {
+                    float texel[4];
+                    command.texture->sample(attributes[4][lane],
+                                            attributes[5][lane], texel);
+                    for (int i = 0; i < 4; ++i)
+                        colour[i] *= texel[i];
+                }
+
+                blendPixel(pixelRow + (x + lane) * 4, colour, command.blendMode);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,101 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/RenderTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+SoftwareRenderTarget::SoftwareRenderTarget(SoftwareRenderer& owner,
+                                           SoftwareTexture* pixels) :
+    d_owner(owner),
+    d_pixels(pixels)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderTarget::~SoftwareRenderTarget()
+{
+    if (d_owner.getActiveSoftwareRenderTarget() == this)
+        d_owner.setActiveSoftwareRenderTarget(nullptr);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::flush()
+{
+    if (d_commands.empty())
+        return;
+
+    if (d_pixels && d_pixels->hasPixels())
+        d_owner.getRasteriser().execute(d_commands, *d_pixels);
+
+    d_commands.clear();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::activate()
+{
+    if (!RenderTarget::d_matrixValid)
+        updateMatrix();
+
+    d_owner.setViewProjectionMatrix(RenderTarget::d_matrix);
+    d_owner.setActiveSoftwareRenderTarget(this);
+
+    RenderTarget::activate();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::deactivate()
+{
+    flush();
+
+    RenderTarget::deactivate();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderTarget::updateMatrix() const
+{
+    // the rasteriser maps clip space the same way OpenGL does.
+    RenderTarget::updateMatrix(RenderTarget::createViewProjMatrixForOpenGL());
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderTarget::isImageryCache() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderTarget::getOwner()
+{
+    return d_owner;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
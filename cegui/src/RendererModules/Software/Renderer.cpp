@@ -0,0 +1,414 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/RendererModules/Software/ShaderWrapper.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/Logger.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+String SoftwareRenderer::d_rendererID(
+    "CEGUI::SoftwareRenderer - Multi-threaded CPU rasterising renderer.");
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::bootstrapSystem(const Sizef& displaySize,
+                                                    unsigned int threadCount,
+                                                    const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    if (System::getSingletonPtr())
+        throw InvalidRequestException(
+            "CEGUI::System object is already initialised.");
+
+    SoftwareRenderer& renderer = create(displaySize, threadCount);
+    DefaultResourceProvider* rp = new DefaultResourceProvider();
+
+    System::create(renderer, rp);
+
+    return renderer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroySystem()
+{
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        throw InvalidRequestException(
+            "CEGUI::System object is not created or was already destroyed.");
+
+    SoftwareRenderer* renderer = static_cast<SoftwareRenderer*>(sys->getRenderer());
+    ResourceProvider* rp = sys->getResourceProvider();
+
+    System::destroy();
+    delete rp;
+    destroy(*renderer);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::create(const Sizef& displaySize,
+                                           unsigned int threadCount,
+                                           const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    return *new SoftwareRenderer(displaySize, threadCount);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroy(SoftwareRenderer& renderer)
+{
+    delete &renderer;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::SoftwareRenderer(const Sizef& displaySize,
+                                   unsigned int threadCount) :
+    d_displaySize(displaySize),
+    d_clearColour(0, 0, 0, 0),
+    d_frameBuffer(nullptr),
+    d_defaultTarget(nullptr),
+    d_activeSoftwareTarget(nullptr),
+    d_viewProjectionMatrix(1.0f),
+    d_rasteriser(new SoftwareRasteriser(threadCount)),
+    d_maxTextureSize(8192),
+    d_shaderWrapperTextured(new SoftwareShaderWrapper()),
+    d_shaderWrapperSolid(new SoftwareShaderWrapper())
+{
+    d_frameBuffer = new SoftwareTexture(*this, "_software_frame_buffer",
+                                        displaySize);
+
+    d_defaultTarget = new SoftwareRenderTarget(*this, d_frameBuffer);
+    d_defaultTarget->setArea(Rectf(glm::vec2(0, 0), displaySize));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::~SoftwareRenderer()
+{
+    destroyAllGeometryBuffers();
+    SoftwareRenderer::destroyAllTextureTargets();
+    SoftwareRenderer::destroyAllTextures();
+
+    delete d_defaultTarget;
+    delete d_frameBuffer;
+
+    delete d_shaderWrapperTextured;
+    delete d_shaderWrapperSolid;
+
+    delete d_rasteriser;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setThreadCount(unsigned int threadCount)
+{
+    d_rasteriser->setThreadCount(threadCount);
+}
+
+//----------------------------------------------------------------------------//
+unsigned int SoftwareRenderer::getThreadCount() const
+{
+    return d_rasteriser->getThreadCount();
+}
+
+//----------------------------------------------------------------------------//
+const SoftwareTexture& SoftwareRenderer::getFrameBuffer()
+{
+    d_defaultTarget->flush();
+    return *d_frameBuffer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::saveFrameBuffer(const String& filename)
+{
+    getFrameBuffer().saveToPNG(filename);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::flushRendering()
+{
+    for (TextureTarget* target : d_textureTargets)
+        static_cast<SoftwareTextureTarget*>(target)->flush();
+
+    d_defaultTarget->flush();
+}
+
+//----------------------------------------------------------------------------//
+RenderTarget& SoftwareRenderer::getDefaultRenderTarget()
+{
+    return *d_defaultTarget;
+}
+
+//----------------------------------------------------------------------------//
+RefCounted<RenderMaterial> SoftwareRenderer::createRenderMaterial(const DefaultShaderType shaderType) const
+{
+    if (shaderType == DefaultShaderType::Textured)
+        return RefCounted<RenderMaterial>(new RenderMaterial(d_shaderWrapperTextured));
+
+    if (shaderType == DefaultShaderType::Solid)
+        return RefCounted<RenderMaterial>(new RenderMaterial(d_shaderWrapperSolid));
+
+    throw RendererException(
+        "A default shader of this type does not exist.");
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBufferTextured(RefCounted<RenderMaterial> renderMaterial)
+{
+    SoftwareGeometryBuffer* geom_buffer = new SoftwareGeometryBuffer(*this, renderMaterial);
+
+    geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
+    geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
+    geom_buffer->addVertexAttribute(VertexAttributeType::TexCoord0);
+
+    addGeometryBuffer(*geom_buffer);
+    return *geom_buffer;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBufferColoured(RefCounted<RenderMaterial> renderMaterial)
+{
+    SoftwareGeometryBuffer* geom_buffer = new SoftwareGeometryBuffer(*this, renderMaterial);
+
+    geom_buffer->addVertexAttribute(VertexAttributeType::Position0);
+    geom_buffer->addVertexAttribute(VertexAttributeType::Colour0);
+
+    addGeometryBuffer(*geom_buffer);
+    return *geom_buffer;
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* SoftwareRenderer::createTextureTarget(bool addStencilBuffer)
+{
+    TextureTarget* tt = new SoftwareTextureTarget(*this, addStencilBuffer);
+    d_textureTargets.push_back(tt);
+    return tt;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTextureTarget(TextureTarget* target)
+{
+    TextureTargetList::iterator i = std::find(d_textureTargets.begin(),
+                                              d_textureTargets.end(),
+                                              target);
+
+    if (d_textureTargets.end() != i)
+    {
+        if (d_activeSoftwareTarget == static_cast<SoftwareTextureTarget*>(target))
+            d_activeSoftwareTarget = nullptr;
+
+        d_textureTargets.erase(i);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextureTargets()
+{
+    clearTextureTargetPool();
+
+    while (!d_textureTargets.empty())
+        destroyTextureTarget(*d_textureTargets.begin());
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(*this, name);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const String& filename,
+                                         const String& resourceGroup)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(*this, name, filename, resourceGroup);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const Sizef& size)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(*this, name, size);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::throwIfNameExists(const String& name) const
+{
+    if (d_textures.find(name) != d_textures.end())
+        throw AlreadyExistsException(
+            "[SoftwareRenderer] Texture already exists: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureCreation(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Created texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(Texture& texture)
+{
+    destroyTexture(texture.getName());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(const String& name)
+{
+    TextureMap::iterator i = d_textures.find(name);
+
+    if (d_textures.end() != i)
+    {
+        // recorded draw calls may still refer to the texture.
+        flushRendering();
+
+        logTextureDestruction(name);
+        delete i->second;
+        d_textures.erase(i);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureDestruction(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Destroyed texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextures()
+{
+    while (!d_textures.empty())
+        destroyTexture(d_textures.begin()->first);
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::getTexture(const String& name) const
+{
+    TextureMap::const_iterator i = d_textures.find(name);
+
+    if (i == d_textures.end())
+        throw UnknownObjectException(
+            "Texture does not exist: " + name);
+
+    return *i->second;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::isTextureDefined(const String& name) const
+{
+    return d_textures.find(name) != d_textures.end();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::beginRendering()
+{
+    d_defaultTarget->getPendingCommands().clear();
+    d_frameBuffer->clear(d_clearColour);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::endRendering()
+{
+    flushRendering();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setDisplaySize(const Sizef& sz)
+{
+    if (sz != d_displaySize)
+    {
+        d_displaySize = sz;
+
+        d_defaultTarget->getPendingCommands().clear();
+        d_frameBuffer->resize(sz);
+
+        Rectf area(d_defaultTarget->getArea());
+        area.setSize(sz);
+        d_defaultTarget->setArea(area);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareRenderer::getDisplaySize() const
+{
+    return d_displaySize;
+}
+
+//----------------------------------------------------------------------------//
+unsigned int SoftwareRenderer::getMaxTextureSize() const
+{
+    return d_maxTextureSize;
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareRenderer::getIdentifierString() const
+{
+    return d_rendererID;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::isTexCoordSystemFlipped() const
+{
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,454 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Rectf.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+namespace
+{
+//----------------------------------------------------------------------------//
+struct CRCTable
+{
+    CRCTable()
+    {
+        for (std::uint32_t i = 0; i < 256; ++i)
+        {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            d_values[i] = c;
+        }
+    }
+
+    std::uint32_t d_values[256];
+};
+
+//----------------------------------------------------------------------------//
+std::uint32_t crc32(std::uint32_t crc, const std::uint8_t* data, size_t size)
+{
+    static const CRCTable table;
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i)
+        crc = table.d_values[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+    return ~crc;
+}
+
+//----------------------------------------------------------------------------//
+void appendU32(std::vector<std::uint8_t>& out, std::uint32_t value)
+{
+    out.push_back(static_cast<std::uint8_t>(value >> 24));
+    out.push_back(static_cast<std::uint8_t>(value >> 16));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+//----------------------------------------------------------------------------//
+void appendChunk(std::vector<std::uint8_t>& out, const char* type,
+                 const std::vector<std::uint8_t>& data)
+{
+    appendU32(out, static_cast<std::uint32_t>(data.size()));
+
+    const size_t typeStart = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+
+    appendU32(out, crc32(0, &out[typeStart], out.size() - typeStart));
+}
+
+//----------------------------------------------------------------------------//
+/*
+    Wraps the filtered scanlines in a zlib stream made of uncompressed deflate
+    blocks. This keeps the writer free of dependencies; the files are meant
+    for comparisons and inspection, not for distribution.
+*/
+std::vector<std::uint8_t> zlibStore(const std::vector<std::uint8_t>& data)
+{
+    static const size_t MaxBlockSize = 65535;
+
+    std::vector<std::uint8_t> out;
+    out.reserve(data.size() + data.size() / MaxBlockSize * 5 + 16);
+
+    // CMF / FLG: deflate with 32K window, no preset dictionary, fastest.
+    out.push_back(0x78);
+    out.push_back(0x01);
+
+    size_t pos = 0;
+    do
+    {
+        const size_t blockSize = std::min(MaxBlockSize, data.size() - pos);
+        const bool last = pos + blockSize == data.size();
+
+        out.push_back(last ? 1 : 0);
+        out.push_back(static_cast<std::uint8_t>(blockSize));
+        out.push_back(static_cast<std::uint8_t>(blockSize >> 8));
+        out.push_back(static_cast<std::uint8_t>(~blockSize));
+        out.push_back(static_cast<std::uint8_t>(~blockSize >> 8));
+        out.insert(out.end(), data.begin() + pos, data.begin() + pos + blockSize);
+
+        pos += blockSize;
+    }
+    while (pos < data.size());
+
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    for (std::uint8_t byte : data)
+    {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    appendU32(out, (b << 16) | a);
+
+    return out;
+}
+
+//----------------------------------------------------------------------------//
+void convertToRGBA(const std::uint8_t* src, std::uint8_t* dst, size_t count,
+                   Texture::PixelFormat format)
+{
+    switch (format)
+    {
+    case Texture::PixelFormat::Rgba:
+        std::memcpy(dst, src, count * 4);
+        break;
+
+    case Texture::PixelFormat::Rgb:
+        for (size_t i = 0; i < count; ++i, src += 3, dst += 4)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 0xFF;
+        }
+        break;
+
+    case Texture::PixelFormat::Rgba4444:
+        for (size_t i = 0; i < count; ++i, src += 2, dst += 4)
+        {
+            std::uint16_t p;
+            std::memcpy(&p, src, 2);
+            dst[0] = static_cast<std::uint8_t>(((p >> 12) & 0xF) * 17);
+            dst[1] = static_cast<std::uint8_t>(((p >> 8) & 0xF) * 17);
+            dst[2] = static_cast<std::uint8_t>(((p >> 4) & 0xF) * 17);
+            dst[3] = static_cast<std::uint8_t>((p & 0xF) * 17);
+        }
+        break;
+
+    case Texture::PixelFormat::Rgb565:
+        for (size_t i = 0; i < count; ++i, src += 2, dst += 4)
+        {
+            std::uint16_t p;
+            std::memcpy(&p, src, 2);
+            dst[0] = static_cast<std::uint8_t>(((p >> 11) & 0x1F) * 255 / 31);
+            dst[1] = static_cast<std::uint8_t>(((p >> 5) & 0x3F) * 255 / 63);
+            dst[2] = static_cast<std::uint8_t>((p & 0x1F) * 255 / 31);
+            dst[3] = 0xFF;
+        }
+        break;
+
+    default:
+        throw RendererException(
+            "[SoftwareRenderer] Unsupported pixel format for texture.");
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t getPixelSize(Texture::PixelFormat format)
+{
+    switch (format)
+    {
+    case Texture::PixelFormat::Rgb:
+        return 3;
+    case Texture::PixelFormat::Rgba4444:
+    case Texture::PixelFormat::Rgb565:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::uint8_t toByte(float value)
+{
+    return static_cast<std::uint8_t>(
+        std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareTexture::getName() const
+{
+    return d_name;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getSize() const
+{
+    return d_size;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getOriginalDataSize() const
+{
+    return d_dataSize;
+}
+
+//----------------------------------------------------------------------------//
+const glm::vec2& SoftwareTexture::getTexelScaling() const
+{
+    return d_texelScaling;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromFile(const String& filename,
+                                   const String& resourceGroup)
+{
+    // get and check existence of CEGUI::System object
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        throw RendererException(
+            "CEGUI::System object has not been created!");
+
+    // load file to memory via resource provider
+    RawDataContainer texFile;
+    sys->getResourceProvider()->loadRawDataContainer(filename, texFile,
+                                                     resourceGroup);
+
+    Texture* res = sys->getImageCodec().load(texFile, this);
+
+    // unload file data buffer
+    sys->getResourceProvider()->unloadRawDataContainer(texFile);
+
+    // throw exception if data was load loaded to texture.
+    if (!res)
+        throw RendererException(
+            sys->getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'.");
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromMemory(const void* buffer,
+                                     const Sizef& buffer_size,
+                                     PixelFormat pixel_format)
+{
+    if (!isPixelFormatSupported(pixel_format))
+        throw InvalidRequestException(
+            "Data was supplied in an unsupported pixel format.");
+
+    // draw calls recorded earlier must see the old contents.
+    d_owner.flushRendering();
+
+    resize(buffer_size);
+    d_dataSize = buffer_size;
+    d_format = pixel_format;
+
+    if (buffer)
+        convertToRGBA(static_cast<const std::uint8_t*>(buffer), d_pixels.data(),
+                      d_pixels.size() / 4, pixel_format);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitFromMemory(const void* sourceData, const Rectf& area)
+{
+    const int left = static_cast<int>(area.left());
+    const int top = static_cast<int>(area.top());
+    const int width = static_cast<int>(area.getWidth());
+    const int height = static_cast<int>(area.getHeight());
+
+    if (left < 0 || top < 0 || left + width > d_width || top + height > d_height)
+        throw InvalidRequestException(
+            "[SoftwareRenderer] Blit area is outside of the texture.");
+
+    d_owner.flushRendering();
+
+    const size_t srcPitch = width * getPixelSize(d_format);
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(sourceData);
+    for (int y = 0; y < height; ++y)
+        convertToRGBA(src + y * srcPitch,
+                      &d_pixels[((top + y) * d_width + left) * 4],
+                      width, d_format);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitToMemory(void* targetData)
+{
+    d_owner.flushRendering();
+
+    if (!d_pixels.empty())
+        std::memcpy(targetData, d_pixels.data(), d_pixels.size());
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTexture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    switch (fmt)
+    {
+    case PixelFormat::Rgba:
+    case PixelFormat::Rgb:
+    case PixelFormat::Rgba4444:
+    case PixelFormat::Rgb565:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::resize(const Sizef& sz)
+{
+    d_width = std::max(0, static_cast<int>(std::ceil(sz.d_width)));
+    d_height = std::max(0, static_cast<int>(std::ceil(sz.d_height)));
+
+    d_pixels.assign(static_cast<size_t>(d_width) * d_height * 4, 0);
+
+    d_size = Sizef(static_cast<float>(d_width), static_cast<float>(d_height));
+    d_dataSize = sz;
+    d_texelScaling = glm::vec2(d_width ? 1.0f / d_width : 0.0f,
+                               d_height ? 1.0f / d_height : 0.0f);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::clear(const Colour& colour)
+{
+    const std::uint8_t rgba[4] = {
+        toByte(colour.getRed()), toByte(colour.getGreen()),
+        toByte(colour.getBlue()), toByte(colour.getAlpha()) };
+
+    for (size_t i = 0; i < d_pixels.size(); i += 4)
+        std::memcpy(&d_pixels[i], rgba, 4);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::saveToPNG(const String& filename) const
+{
+    // every scanline is preceded by its filter type (0, none)
+    std::vector<std::uint8_t> scanlines;
+    scanlines.reserve(d_pixels.size() + d_height);
+    for (int y = 0; y < d_height; ++y)
+    {
+        scanlines.push_back(0);
+        scanlines.insert(scanlines.end(),
+                         d_pixels.begin() + y * d_width * 4,
+                         d_pixels.begin() + (y + 1) * d_width * 4);
+    }
+
+    static const std::uint8_t signature[8] =
+        { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    std::vector<std::uint8_t> png(signature, signature + 8);
+
+    std::vector<std::uint8_t> header;
+    appendU32(header, static_cast<std::uint32_t>(d_width));
+    appendU32(header, static_cast<std::uint32_t>(d_height));
+    header.push_back(8);    // bit depth
+    header.push_back(6);    // colour type: RGBA
+    header.push_back(0);    // compression
+    header.push_back(0);    // filter
+    header.push_back(0);    // interlace
+    appendChunk(png, "IHDR", header);
+    appendChunk(png, "IDAT", zlibStore(scanlines));
+    appendChunk(png, "IEND", std::vector<std::uint8_t>());
+
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    std::ofstream file(String::convertUtf32ToUtf8(filename.getString()).c_str(),
+                       std::ios::binary);
+#else
+    std::ofstream file(filename.c_str(), std::ios::binary);
+#endif
+    if (file)
+        file.write(reinterpret_cast<const char*>(png.data()), png.size());
+
+    if (!file)
+        throw FileIOException(
+            "[SoftwareRenderer] Unable to write PNG file '" + filename + "'.");
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(SoftwareRenderer& owner, const String& name) :
+    d_owner(owner),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name),
+    d_width(0),
+    d_height(0),
+    d_format(PixelFormat::Rgba)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(SoftwareRenderer& owner, const String& name,
+                                 const String& filename,
+                                 const String& resourceGroup) :
+    d_owner(owner),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name),
+    d_width(0),
+    d_height(0),
+    d_format(PixelFormat::Rgba)
+{
+    SoftwareTexture::loadFromFile(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(SoftwareRenderer& owner, const String& name,
+                                 const Sizef& sz) :
+    d_owner(owner),
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name),
+    d_width(0),
+    d_height(0),
+    d_format(PixelFormat::Rgba)
+{
+    resize(sz);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::~SoftwareTexture()
+{
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
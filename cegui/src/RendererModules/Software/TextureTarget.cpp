@@ -0,0 +1,103 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/PropertyHelper.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+std::uint32_t SoftwareTextureTarget::s_textureNumber = 0;
+const float SoftwareTextureTarget::DEFAULT_SIZE = 128.0f;
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::SoftwareTextureTarget(SoftwareRenderer& owner,
+                                             bool addStencilBuffer) :
+    SoftwareRenderTarget(owner, nullptr),
+    TextureTarget(addStencilBuffer)
+{
+    d_pixels = static_cast<SoftwareTexture*>(
+        &d_owner.createTexture(generateTextureName()));
+
+    // setup area and cause the initial texture to be generated.
+    SoftwareTextureTarget::declareRenderSize(Sizef(DEFAULT_SIZE, DEFAULT_SIZE));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTextureTarget::~SoftwareTextureTarget()
+{
+    // anything still recorded would be rendered into a texture nobody sees.
+    d_commands.clear();
+    d_owner.destroyTexture(*d_pixels);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTextureTarget::isImageryCache() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::clear()
+{
+    // whatever was recorded so far would be overwritten anyway.
+    d_commands.clear();
+    d_pixels->clear(Colour(0, 0, 0, 0));
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareTextureTarget::getTexture() const
+{
+    return *d_pixels;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTextureTarget::declareRenderSize(const Sizef& sz)
+{
+    // exit if current size is enough
+    if (d_area.getWidth() >= sz.d_width && d_area.getHeight() >= sz.d_height)
+        return;
+
+    flush();
+
+    setArea(Rectf(d_area.getPosition(), sz));
+    d_pixels->resize(sz);
+}
+
+//----------------------------------------------------------------------------//
+String SoftwareTextureTarget::generateTextureName()
+{
+    String tmp("_software_tt_tex_");
+    tmp.append(PropertyHelper<std::uint32_t>::toString(s_textureNumber++));
+
+    return tmp;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -28,6 +28,7 @@
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/Renderer.h"
+#include "CEGUI/FrameProfiler.h"
 #include <algorithm>
 
 namespace CEGUI
@@ -66,6 +67,13 @@ void RenderingSurface::addGeometryBuffer(const RenderQueueID queue,
     d_queues[queue].addGeometryBuffer(geometry_buffer);
 }
 
+//----------------------------------------------------------------------------//
+void RenderingSurface::addGeometryBufferList(const RenderQueueID queue,
+    const std::vector<GeometryBuffer*>& geometry_buffers)
+{
+    d_queues[queue].addGeometryBufferList(geometry_buffers);
+}
+
 //----------------------------------------------------------------------------//
 void RenderingSurface::removeGeometryBuffer(const RenderQueueID queue,
     const GeometryBuffer& geometry_buffer)
@@ -89,8 +97,13 @@ void RenderingSurface::clearGeometry()
 //----------------------------------------------------------------------------//
 void RenderingSurface::draw(std::uint32_t drawMode)
 {
+    CEGUI_PROFILE_SCOPE("RenderingSurface::draw");
+
     d_target->activate();
-    d_target->getOwner().uploadBuffers(*this);
+    {
+        CEGUI_PROFILE_SCOPE("Renderer::uploadBuffers");
+        d_target->getOwner().uploadBuffers(*this);
+    }
     drawContent(drawMode);
     d_target->deactivate();
 }
@@ -83,7 +83,12 @@ void RenderingWindow::setSize(const Sizef& size)
 {
     d_size = size;
     d_geometryValid = false;
-    d_textarget.declareRenderSize(d_size);
+
+    // only a part of a larger target is used (see getTextureRect), so the
+    // texture is only reallocated when growing, to the next size class.
+    const Sizef& targetSize = d_textarget.getArea().getSize();
+    if (d_size.d_width > targetSize.d_width || d_size.d_height > targetSize.d_height)
+        d_textarget.declareRenderSize(Renderer::getTextureTargetSizeClass(d_size));
 }
 
 //----------------------------------------------------------------------------//
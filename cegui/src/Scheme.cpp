@@ -31,6 +31,7 @@
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/FontManager.h"
 #include "CEGUI/WindowFactoryManager.h"
+#include "CEGUI/WindowManager.h"
 #include "CEGUI/WindowRendererManager.h"
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/FactoryModule.h"
@@ -113,9 +114,14 @@ void Scheme::unloadResources(void)
 {
     Logger::getSingleton().logEvent("---- Beginning resource cleanup for GUI scheme '" + d_name + "' ----", LoggingLevel::Informative);
 
+    // windows parked for reuse may depend on the factories and looks below
+    if (WindowManager* windowManager = WindowManager::getSingletonPtr())
+        windowManager->clearWindowPools();
+
     // unload all resources specified for this scheme.
     //unloadFonts(); FIXME: Prevent unloading of cross-used fonts
-    //unloadXMLImagesets(); FIXME: ????
+    // NB: XML imagesets are kept (see unloadXMLImagesets), since windows may
+    // still use their images.
     unloadImageFileImagesets();
     unloadWindowFactories();
     unloadWindowRendererFactories();
@@ -403,17 +409,15 @@ void Scheme::loadFalagardMappings()
 *************************************************************************/
 void Scheme::unloadXMLImagesets()
 {
-/* FIXME ?
     ImageManager& imgr = ImageManager::getSingleton();
 
-    // unload all xml based Imagesets
+    // the ImageManager keeps the collections that were loaded more often,
+    // e.g. by other schemes.
     for (LoadableUIElementList::const_iterator pos = d_imagesets.begin();
         pos != d_imagesets.end(); ++pos)
     {
-        if (!(*pos).name.empty())
-            ismgr.destroy((*pos).name);
+        imgr.unloadImageset((*pos).filename, (*pos).resourceGroup);
     }
-*/
 }
 
 /*************************************************************************
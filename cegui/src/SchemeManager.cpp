@@ -33,6 +33,7 @@
 #include "CEGUI/ResourceProvider.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/SharedStringStream.h"
+#include "CEGUI/ParallelResourceLoader.h"
 
 namespace CEGUI
 {
@@ -42,7 +43,8 @@ template<> SchemeManager* Singleton<SchemeManager>::ms_Singleton = nullptr;
 //----------------------------------------------------------------------------//
 SchemeManager::SchemeManager() :
     d_resourceType("Scheme"),
-    d_autoLoadResources(true)
+    d_autoLoadResources(true),
+    d_parallelLoading(false)
 {
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
 
@@ -75,12 +77,27 @@ bool SchemeManager::getAutoLoadResources() const
     return d_autoLoadResources;
 }
 
+//----------------------------------------------------------------------------//
+void SchemeManager::setParallelLoadingEnabled(bool enabled)
+{
+    d_parallelLoading = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool SchemeManager::isParallelLoadingEnabled() const
+{
+    return d_parallelLoading;
+}
+
 //----------------------------------------------------------------------------//
 void SchemeManager::doPostObjectAdditionAction(Scheme& scheme)
 {
     if (d_autoLoadResources)
     {
-        scheme.loadResources();
+        if (d_parallelLoading)
+            ParallelResourceLoader().loadResources(scheme);
+        else
+            scheme.loadResources();
     }
 }
 
@@ -55,7 +55,11 @@ LuaFunctor::LuaFunctor(lua_State* state, int func, int selfIndex) :
     self(selfIndex),
     needs_lookup(false),
     d_errFuncIndex(LUA_NOREF),
-    d_ourErrFuncIndex(false)
+    d_ourErrFuncIndex(false),
+    d_prepared(false),
+    d_argsRef(LUA_NOREF),
+    d_batched(false),
+    d_batchedCall(nullptr)
 {
     // TODO: This would perhaps be better done another way, to avoid the
     // TODO: interdependence.
@@ -79,7 +83,11 @@ LuaFunctor::LuaFunctor(lua_State* state, const String& func, int selfIndex) :
     needs_lookup(true),
     function_name(func),
     d_errFuncIndex(LUA_NOREF),
-    d_ourErrFuncIndex(false)
+    d_ourErrFuncIndex(false),
+    d_prepared(false),
+    d_argsRef(LUA_NOREF),
+    d_batched(false),
+    d_batchedCall(nullptr)
 {
     // TODO: This would perhaps be better done another way, to avoid the
     // TODO: interdependence.
@@ -104,7 +112,12 @@ LuaFunctor::LuaFunctor(const LuaFunctor& cp) :
     function_name(cp.function_name),
     d_errFuncName(cp.d_errFuncName),
     d_errFuncIndex(cp.d_errFuncIndex),
-    d_ourErrFuncIndex(cp.d_ourErrFuncIndex)
+    d_ourErrFuncIndex(cp.d_ourErrFuncIndex),
+    // the args userdata is owned by each copy; it is created on first call
+    d_prepared(false),
+    d_argsRef(LUA_NOREF),
+    d_batched(cp.d_batched),
+    d_batchedCall(nullptr)
 {
 }
 
@@ -113,6 +126,16 @@ LuaFunctor::LuaFunctor(const LuaFunctor& cp) :
 *************************************************************************/
 LuaFunctor::~LuaFunctor()
 {
+    // drop a queued call, it can not be made any more
+    if (d_batchedCall)
+    {
+        d_batchedCall->d_functor = nullptr;
+        d_batchedCall->d_args.reset();
+    }
+
+    if (d_argsRef != LUA_NOREF)
+        luaL_unref(L, LUA_REGISTRYINDEX, d_argsRef);
+
     if (self != LUA_NOREF)
         luaL_unref(L, LUA_REGISTRYINDEX, self);
 
@@ -130,25 +153,28 @@ LuaFunctor::~LuaFunctor()
 *************************************************************************/
 bool LuaFunctor::operator()(const EventArgs& args) const
 {
-    // named error handler needs binding?
-    if ((d_errFuncIndex == LUA_NOREF) && !d_errFuncName.empty())
+    if (d_batched)
     {
-        pushNamedFunction(L, d_errFuncName);
-        d_errFuncIndex = luaL_ref(L, LUA_REGISTRYINDEX);
-        d_ourErrFuncIndex = true;
-    }
+        LuaScriptModule* sm = static_cast<LuaScriptModule*>(
+            System::getSingleton().getScriptingModule());
 
-    // is this a late binding?
-    if (needs_lookup)
-    {
-        pushNamedFunction(L, function_name);
-        // reference function
-        index = luaL_ref(L, LUA_REGISTRYINDEX);
-        needs_lookup = false;
-        CEGUI_LOGINSANE("Late binding of callback '"+function_name+"' performed");
-        function_name.clear();
+        // args of types that can not be copied are handled right away. A
+        // queued call can not report whether it handled the event.
+        if (sm && sm->queueBatchedCall(*this, args))
+            return false;
     }
 
+    return invoke(args);
+}
+
+/*************************************************************************
+    Invoke the Lua handler
+*************************************************************************/
+bool LuaFunctor::invoke(const EventArgs& args) const
+{
+    if (!d_prepared)
+        prepare();
+
     // put error handler on stack if we're using such a thing
     int err_idx = 0;
     if (d_errFuncIndex != LUA_NOREF)
@@ -168,27 +194,84 @@ bool LuaFunctor::operator()(const EventArgs& args) const
         ++nargs;
     }
 
-    // push EventArgs  parameter
-    tolua_pushusertype(L, (void*)&args, "const CEGUI::EventArgs");
+    // push EventArgs parameter by pointing our userdata at it. The previous
+    // value is restored afterwards, so that a handler firing the event it is
+    // subscribed to does not invalidate the args of the outer call.
+    lua_rawgeti(L, LUA_REGISTRYINDEX, d_argsRef);
+    void** const box = static_cast<void**>(lua_touserdata(L, -1));
+    void* const previous = *box;
+    *box = const_cast<EventArgs*>(&args);
 
     // call it
     int error = lua_pcall(L, nargs, 1, err_idx);
 
+    *box = previous;
+
     // handle errors
     if (error)
     {
         String errStr(lua_tostring(L, -1));
-        lua_pop(L, 1);
+        lua_pop(L, err_idx ? 2 : 1);
         throw ScriptException("Unable to call Lua event handler:\n\n"+errStr+"\n");
     }
 
     // retrieve result
     bool ret = lua_isboolean(L, -1) ? lua_toboolean(L, -1 ) : true;
-    lua_pop(L, 1);
+    lua_pop(L, err_idx ? 2 : 1);
 
     return ret;
 }
 
+//----------------------------------------------------------------------------//
+void LuaFunctor::prepare() const
+{
+    // named error handler needs binding?
+    if ((d_errFuncIndex == LUA_NOREF) && !d_errFuncName.empty())
+    {
+        pushNamedFunction(L, d_errFuncName);
+        d_errFuncIndex = luaL_ref(L, LUA_REGISTRYINDEX);
+        d_ourErrFuncIndex = true;
+    }
+
+    // is this a late binding?
+    if (needs_lookup)
+    {
+        pushNamedFunction(L, function_name);
+        // reference function
+        index = luaL_ref(L, LUA_REGISTRYINDEX);
+        needs_lookup = false;
+        CEGUI_LOGINSANE("Late binding of callback '"+function_name+"' performed");
+        function_name.clear();
+    }
+
+    // create the userdata for the EventArgs the way tolua_pushusertype does,
+    // so that it works with all the tolua++ casting and accessor functions.
+    if (d_argsRef == LUA_NOREF)
+    {
+        void** const box = static_cast<void**>(lua_newuserdata(L, sizeof(void*)));
+        *box = nullptr;
+        luaL_getmetatable(L, "const CEGUI::EventArgs");
+        lua_setmetatable(L, -2);
+#if LUA_VERSION_NUM <= 501
+        // no peer table
+        lua_pushvalue(L, TOLUA_NOPEER);
+        lua_setfenv(L, -2);
+#endif
+        d_argsRef = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+
+    d_prepared = true;
+}
+
+//----------------------------------------------------------------------------//
+void LuaFunctor::initBatching(const String& eventName)
+{
+    LuaScriptModule* sm =
+        static_cast<LuaScriptModule*>(System::getSingleton().getScriptingModule());
+
+    d_batched = sm && sm->isEventBatched(eventName);
+}
+
 /*************************************************************************
     Pushes a named function on the stack
 *************************************************************************/
@@ -289,7 +372,11 @@ LuaFunctor::LuaFunctor(lua_State* state, const int func, const int selfIndex,
     needs_lookup(false),
     d_errFuncName(error_handler),
     d_errFuncIndex(LUA_NOREF),
-    d_ourErrFuncIndex(false)
+    d_ourErrFuncIndex(false),
+    d_prepared(false),
+    d_argsRef(LUA_NOREF),
+    d_batched(false),
+    d_batchedCall(nullptr)
 {
 }
 
@@ -304,7 +391,11 @@ LuaFunctor::LuaFunctor(lua_State* state, const String& func, const int selfIndex
     function_name(func),
     d_errFuncName(error_handler),
     d_errFuncIndex(LUA_NOREF),
-    d_ourErrFuncIndex(false)
+    d_ourErrFuncIndex(false),
+    d_prepared(false),
+    d_argsRef(LUA_NOREF),
+    d_batched(false),
+    d_batchedCall(nullptr)
 {
 }
 
@@ -317,7 +408,11 @@ LuaFunctor::LuaFunctor(lua_State* state, const int func, const int selfIndex,
     self(selfIndex),
     needs_lookup(false),
     d_errFuncIndex(error_handler),
-    d_ourErrFuncIndex(false)
+    d_ourErrFuncIndex(false),
+    d_prepared(false),
+    d_argsRef(LUA_NOREF),
+    d_batched(false),
+    d_batchedCall(nullptr)
 {
 }
 
@@ -331,7 +426,11 @@ LuaFunctor::LuaFunctor(lua_State* state, const String& func, const int selfIndex
     needs_lookup(true),
     function_name(func),
     d_errFuncIndex(error_handler),
-    d_ourErrFuncIndex(false)
+    d_ourErrFuncIndex(false),
+    d_prepared(false),
+    d_argsRef(LUA_NOREF),
+    d_batched(false),
+    d_batchedCall(nullptr)
 {
 }
 
@@ -384,6 +483,7 @@ Event::Connection LuaFunctor::SubscribeEvent(EventSet* self,
         if (err_idx != LUA_NOREF)
         {
             LuaFunctor functor(L, index, thisIndex, err_idx);
+            functor.initBatching(event_name);
             con = self->subscribeEvent(String(event_name),
                                        Event::Subscriber(functor));
             functor.invalidateLuaRefs();
@@ -391,6 +491,7 @@ Event::Connection LuaFunctor::SubscribeEvent(EventSet* self,
         else if (!err_str.empty())
         {
             LuaFunctor functor(L, index, thisIndex, err_str);
+            functor.initBatching(event_name);
             con = self->subscribeEvent(String(event_name),
                                        Event::Subscriber(functor));
             functor.invalidateLuaRefs();
@@ -398,6 +499,7 @@ Event::Connection LuaFunctor::SubscribeEvent(EventSet* self,
         else
         {
             LuaFunctor functor(L, index, thisIndex);
+            functor.initBatching(event_name);
             con = self->subscribeEvent(String(event_name),
                                        Event::Subscriber(functor));
             functor.invalidateLuaRefs();
@@ -410,6 +512,7 @@ Event::Connection LuaFunctor::SubscribeEvent(EventSet* self,
         if (err_idx != LUA_NOREF)
         {
             LuaFunctor functor(L, String(str), thisIndex, err_idx);
+            functor.initBatching(event_name);
             con = self->subscribeEvent(String(event_name),
                                        Event::Subscriber(functor));
             functor.invalidateLuaRefs();
@@ -417,6 +520,7 @@ Event::Connection LuaFunctor::SubscribeEvent(EventSet* self,
         else if (!err_str.empty())
         {
             LuaFunctor functor(L, String(str), thisIndex, err_str);
+            functor.initBatching(event_name);
             con = self->subscribeEvent(String(event_name),
                                        Event::Subscriber(functor));
             functor.invalidateLuaRefs();
@@ -424,6 +528,7 @@ Event::Connection LuaFunctor::SubscribeEvent(EventSet* self,
         else
         {
             LuaFunctor functor(L, String(str), thisIndex);
+            functor.initBatching(event_name);
             con = self->subscribeEvent(String(event_name),
                                        Event::Subscriber(functor));
             functor.invalidateLuaRefs();
@@ -445,6 +550,7 @@ void LuaFunctor::invalidateLuaRefs()
     index = LUA_NOREF;
     self = LUA_NOREF;
     d_errFuncIndex = LUA_NOREF;
+    d_argsRef = LUA_NOREF;
 }
 
 //----------------------------------------------------------------------------//
@@ -33,6 +33,7 @@
 #include "CEGUI/CEGUI.h"
 #include "CEGUI/ScriptModules/Lua/ScriptModule.h"
 #include "CEGUI/ScriptModules/Lua/Functor.h"
+#include <typeinfo>
 #include <vector>
 
 // include Lua libs and tolua++
@@ -51,6 +52,30 @@ int tolua_CEGUI_open(lua_State* tolua_S);
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+// Return a copy of args, or nullptr if the type of args is not supported.
+static std::unique_ptr<EventArgs> cloneEventArgs(const EventArgs& args)
+{
+    // exact type matches only, copying a derived type would slice it.
+    const std::type_info& type = typeid(args);
+
+    if (type == typeid(CursorMoveEventArgs))
+        return std::unique_ptr<EventArgs>(new CursorMoveEventArgs(
+            static_cast<const CursorMoveEventArgs&>(args)));
+    if (type == typeid(CursorInputEventArgs))
+        return std::unique_ptr<EventArgs>(new CursorInputEventArgs(
+            static_cast<const CursorInputEventArgs&>(args)));
+    if (type == typeid(UpdateEventArgs))
+        return std::unique_ptr<EventArgs>(new UpdateEventArgs(
+            static_cast<const UpdateEventArgs&>(args)));
+    if (type == typeid(WindowEventArgs))
+        return std::unique_ptr<EventArgs>(new WindowEventArgs(
+            static_cast<const WindowEventArgs&>(args)));
+    if (type == typeid(EventArgs))
+        return std::unique_ptr<EventArgs>(new EventArgs(args));
+
+    return nullptr;
+}
 
 /*************************************************************************
 	Constructor (creates Lua state)
@@ -118,6 +143,14 @@ LuaScriptModule::LuaScriptModule(lua_State* state) :
 *************************************************************************/
 LuaScriptModule::~LuaScriptModule()
 {
+    // functors may outlive us; make sure they forget about queued calls
+    for (LuaBatchedCall& call : d_batchedCalls)
+        if (call.d_functor)
+            call.d_functor->d_batchedCall = nullptr;
+
+    if (d_windowDestroyedConnection)
+        d_windowDestroyedConnection->disconnect();
+
     if (d_state)
     {
         unrefErrorFunc();
@@ -231,12 +264,14 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
     if (err_ref == LUA_NOREF)
     {
         LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, err_str);
+        functor.initBatching(event_name);
         con = target->subscribeEvent(event_name, Event::Subscriber(functor));
         functor.invalidateLuaRefs();
     }
     else
     {
         LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, err_ref);
+        functor.initBatching(event_name);
         con = target->subscribeEvent(event_name, Event::Subscriber(functor));
         functor.invalidateLuaRefs();
     }
@@ -260,6 +295,7 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
     if (err_ref == LUA_NOREF)
     {
         LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, err_str);
+        functor.initBatching(event_name);
         con = target->subscribeEvent(event_name, group,
                                      Event::Subscriber(functor));
         functor.invalidateLuaRefs();
@@ -267,6 +303,7 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
     else
     {
         LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, err_ref);
+        functor.initBatching(event_name);
         con = target->subscribeEvent(event_name, group,
                                      Event::Subscriber(functor));
         functor.invalidateLuaRefs();
@@ -276,6 +313,110 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
     return con;
 }
 
+//----------------------------------------------------------------------------//
+void LuaScriptModule::setEventBatched(const String& event_name, bool batched)
+{
+    if (batched)
+        d_batchedEvents.insert(event_name);
+    else
+        d_batchedEvents.erase(event_name);
+}
+
+//----------------------------------------------------------------------------//
+bool LuaScriptModule::isEventBatched(const String& event_name) const
+{
+    return d_batchedEvents.find(event_name) != d_batchedEvents.end();
+}
+
+//----------------------------------------------------------------------------//
+bool LuaScriptModule::queueBatchedCall(const LuaFunctor& functor,
+                                       const EventArgs& args)
+{
+    std::unique_ptr<EventArgs> copy(cloneEventArgs(args));
+    if (!copy)
+        return false;
+
+    // already queued; coalesce with the pending call
+    if (LuaBatchedCall* const call = functor.d_batchedCall)
+    {
+        if (typeid(*copy) == typeid(CursorMoveEventArgs) &&
+            typeid(*call->d_args) == typeid(CursorMoveEventArgs))
+        {
+            static_cast<CursorMoveEventArgs&>(*copy).d_moveDelta +=
+                static_cast<const CursorMoveEventArgs&>(*call->d_args).d_moveDelta;
+        }
+
+        call->d_args = std::move(copy);
+        return true;
+    }
+
+    // the copied args may point at a window that is destroyed before the flush
+    if (!d_windowDestroyedConnection &&
+        dynamic_cast<const WindowEventArgs*>(copy.get()))
+    {
+        if (WindowManager* const wm = WindowManager::getSingletonPtr())
+            d_windowDestroyedConnection = wm->subscribeEvent(
+                WindowManager::EventWindowDestroyed,
+                Event::Subscriber(&LuaScriptModule::handleWindowDestroyed, this));
+    }
+
+    d_batchedCalls.push_back(LuaBatchedCall());
+    d_batchedCalls.back().d_functor = &functor;
+    d_batchedCalls.back().d_args = std::move(copy);
+    functor.d_batchedCall = &d_batchedCalls.back();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool LuaScriptModule::handleWindowDestroyed(const EventArgs& e)
+{
+    const Window* const window = static_cast<const WindowEventArgs&>(e).window;
+
+    for (LuaBatchedCall& call : d_batchedCalls)
+    {
+        const WindowEventArgs* const args =
+            dynamic_cast<const WindowEventArgs*>(call.d_args.get());
+
+        if (call.d_functor && args && args->window == window)
+        {
+            call.d_functor->d_batchedCall = nullptr;
+            call.d_functor = nullptr;
+            call.d_args.reset();
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void LuaScriptModule::flushBatchedEvents()
+{
+    // calls queued by the handlers are left for the next flush
+    for (size_t count = d_batchedCalls.size(); count; --count)
+    {
+        const LuaFunctor* const functor = d_batchedCalls.front().d_functor;
+        const std::unique_ptr<EventArgs> args(
+            std::move(d_batchedCalls.front().d_args));
+        d_batchedCalls.pop_front();
+
+        // functor was destroyed after queueing the call
+        if (!functor)
+            continue;
+
+        functor->d_batchedCall = nullptr;
+
+        try
+        {
+            functor->invoke(*args);
+        }
+        catch (const ScriptException&)
+        {
+            // already logged when the exception was created
+        }
+    }
+}
+
 //----------------------------------------------------------------------------//
 void LuaScriptModule::setDefaultPCallErrorHandler(
     const String& error_handler_function)
@@ -486,6 +627,7 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
 {
     // do the real subscription
     LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, error_handler);
+    functor.initBatching(event_name);
     Event::Connection con =
         target->subscribeEvent(event_name, Event::Subscriber(functor));
 
@@ -505,6 +647,7 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
 {
     // do the real subscription
     LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, error_handler);
+    functor.initBatching(event_name);
     Event::Connection con =
         target->subscribeEvent(event_name, Event::Subscriber(functor));
 
@@ -525,6 +668,7 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
 {
     // do the real subscription
     LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, error_handler);
+    functor.initBatching(event_name);
     Event::Connection con =
         target->subscribeEvent(event_name, group, Event::Subscriber(functor));
 
@@ -544,6 +688,7 @@ Event::Connection LuaScriptModule::subscribeEvent(EventSet* target,
 {
     // do the real subscription
     LuaFunctor functor(d_state, subscriber_name, LUA_NOREF, error_handler);
+    functor.initBatching(event_name);
     Event::Connection con =
         target->subscribeEvent(event_name, group, Event::Subscriber(functor));
 
@@ -158,6 +158,37 @@ void ShaderParameterBindings::setParameter(const std::string& parameter_name, in
         setNewParameter(parameter_name, new ShaderParameterInt(value));
 }
 
+//----------------------------------------------------------------------------//
+void ShaderParameterBindings::copyFrom(const ShaderParameterBindings& other)
+{
+    if (&other == this)
+        return;
+
+    auto it = d_shaderParameterBindings.begin();
+    while (it != d_shaderParameterBindings.end())
+    {
+        if (other.d_shaderParameterBindings.find(it->first) == other.d_shaderParameterBindings.end())
+        {
+            delete it->second;
+            it = d_shaderParameterBindings.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (const auto& pair : other.d_shaderParameterBindings)
+    {
+        ShaderParameter* shader_param = getParameter(pair.first);
+        if (shader_param && shader_param->getType() == pair.second->getType())
+        {
+            if (!shader_param->equal(pair.second))
+                shader_param->takeOverParameterValue(pair.second);
+        }
+        else
+            setNewParameter(pair.first, pair.second->clone());
+    }
+}
+
 //----------------------------------------------------------------------------//
 ShaderParameter* ShaderParameterBindings::getParameter(const std::string& parameter_name)
 {
@@ -0,0 +1,113 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/StagingTexture.h"
+#include "CEGUI/Exceptions.h"
+#include <cmath>
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+StagingTexture::StagingTexture() :
+    d_size(0, 0),
+    d_texelScaling(0, 0),
+    d_format(PixelFormat::Rgba)
+{
+}
+
+//----------------------------------------------------------------------------//
+size_t StagingTexture::calculateDataSize(const Sizef& size, PixelFormat format)
+{
+    switch (format)
+    {
+    case PixelFormat::Rgba:
+        return static_cast<size_t>(size.d_width * size.d_height * 4);
+
+    case PixelFormat::Rgb:
+        return static_cast<size_t>(size.d_width * size.d_height * 3);
+
+    case PixelFormat::Rgb565:
+    case PixelFormat::Rgba4444:
+        return static_cast<size_t>(size.d_width * size.d_height * 2);
+
+    case PixelFormat::Pvrtc2:
+        return (static_cast<size_t>(size.d_width * size.d_height) * 2 + 7) / 8;
+
+    case PixelFormat::Pvrtc4:
+        return (static_cast<size_t>(size.d_width * size.d_height) * 4 + 7) / 8;
+
+    case PixelFormat::RgbDxt1:
+    case PixelFormat::RgbaDxt1:
+        return static_cast<size_t>(std::ceil(size.d_width / 4) * std::ceil(size.d_height / 4) * 8);
+
+    case PixelFormat::RgbaDxt3:
+    case PixelFormat::RgbaDxt5:
+        return static_cast<size_t>(std::ceil(size.d_width / 4) * std::ceil(size.d_height / 4) * 16);
+
+    default:
+        return 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void StagingTexture::loadFromFile(const String&, const String&)
+{
+    throw InvalidRequestException(
+        "StagingTexture can only be loaded from memory.");
+}
+
+//----------------------------------------------------------------------------//
+void StagingTexture::loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                                    PixelFormat pixel_format)
+{
+    const std::uint8_t* const data = static_cast<const std::uint8_t*>(buffer);
+
+    d_pixels.assign(data, data + calculateDataSize(buffer_size, pixel_format));
+    d_size = buffer_size;
+    d_format = pixel_format;
+}
+
+//----------------------------------------------------------------------------//
+void StagingTexture::blitFromMemory(const void*, const Rectf&)
+{
+    throw InvalidRequestException(
+        "StagingTexture can only be loaded from memory.");
+}
+
+//----------------------------------------------------------------------------//
+void StagingTexture::blitToMemory(void*)
+{
+    throw InvalidRequestException(
+        "StagingTexture can only be loaded from memory.");
+}
+
+//----------------------------------------------------------------------------//
+bool StagingTexture::isPixelFormatSupported(const PixelFormat) const
+{
+    return true;
+}
+
+} // End of  CEGUI namespace section
@@ -46,12 +46,14 @@
 #include "CEGUI/DynamicModule.h"
 #include "CEGUI/XMLParser.h"
 #include "CEGUI/text/LegacyTextParser.h"
+#include "CEGUI/XMLBinaryCache.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/DefaultResourceProvider.h"
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/widgets/All.h"
 #include "CEGUI/SharedStringStream.h"
 #include "CEGUI/svg/SVGDataManager.h"
+#include "CEGUI/FrameProfiler.h"
 #if defined(__WIN32__) || defined(_WIN32)
 #    include "CEGUI/Win32ClipboardProvider.h"
 #endif
@@ -122,7 +124,9 @@ System::System(Renderer& renderer,
     d_imageCodec(imageCodec),
     d_ourImageCodec(false),
     d_imageCodecModule(nullptr),
+    d_imageCodecOverride(nullptr),
     d_ourLogger(Logger::getSingletonPtr() == nullptr),
+    d_xmlBinaryCache(std::make_unique<XMLBinaryCache>()),
     d_fallbackTextParser(std::make_unique<LegacyTextParser>())
 {
     d_defaultTextParser = d_fallbackTextParser.get();
@@ -421,6 +425,8 @@ void System::renderAllGUIContexts()
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
+
+    FrameProfiler::markFrameEnd();
 }
 
 void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
@@ -440,6 +446,8 @@ void System::renderAllGUIContextsOnTarget(Renderer* /*contained_in*/)
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
+
+    FrameProfiler::markFrameEnd();
 }
 
 /*************************************************************************
@@ -581,6 +589,8 @@ void System::executeScriptString(const String& str) const
 *************************************************************************/
 bool System::injectTimePulse(float timeElapsed)
 {
+    CEGUI_PROFILE_SCOPE("System::injectTimePulse");
+
     AnimationManager::getSingleton().autoStepInstances(timeElapsed);
     return true;
 }
@@ -821,7 +831,7 @@ String System::getDefaultXMLParserName()
 //----------------------------------------------------------------------------//
 ImageCodec& System::getImageCodec() const
 {
-    return *d_imageCodec;
+    return d_imageCodecOverride ? *d_imageCodecOverride : *d_imageCodec;
 }
 
 //----------------------------------------------------------------------------//
@@ -839,6 +849,12 @@ void System::setImageCodec(ImageCodec& codec)
     d_imageCodecModule = nullptr;
 }
 
+//----------------------------------------------------------------------------//
+void System::setImageCodecOverride(ImageCodec* codec)
+{
+    d_imageCodecOverride = codec;
+}
+
 //----------------------------------------------------------------------------//
 void System::setupImageCodec(const String& codecName)
 {
@@ -956,6 +972,84 @@ void System::invalidateAllCachedRendering()
     invalidateAllWindows();
 }
 
+//----------------------------------------------------------------------------//
+MemoryStatistics System::getMemoryStatistics(MemoryTag tag) const
+{
+    return MemoryTracker::getStatistics(tag);
+}
+
+//----------------------------------------------------------------------------//
+void System::setMemoryBudget(MemoryTag tag, size_t bytes)
+{
+    if (tag < MemoryTag(0) || tag >= MemoryTag::Count)
+        throw InvalidRequestException("Invalid memory tag given.");
+
+    d_memoryBudgets[static_cast<size_t>(tag)] = bytes;
+}
+
+//----------------------------------------------------------------------------//
+size_t System::getMemoryBudget(MemoryTag tag) const
+{
+    if (tag < MemoryTag(0) || tag >= MemoryTag::Count)
+        throw InvalidRequestException("Invalid memory tag given.");
+
+    return d_memoryBudgets[static_cast<size_t>(tag)];
+}
+
+//----------------------------------------------------------------------------//
+bool System::isMemoryBudgetExceeded() const
+{
+    for (size_t i = 0; i < d_memoryBudgets.size(); ++i)
+    {
+        if (d_memoryBudgets[i] &&
+            MemoryTracker::getStatistics(MemoryTag(i)).d_peakBytes > d_memoryBudgets[i])
+            return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+void System::resetMemoryPeaks()
+{
+    MemoryTracker::resetPeaks();
+}
+
+//----------------------------------------------------------------------------//
+void System::logMemoryStatistics() const
+{
+    Logger& logger = Logger::getSingleton();
+
+    if (!MemoryTracker::isEnabled())
+    {
+        logger.logEvent("Memory statistics are not available, CEGUI was built "
+            "without CEGUI_TRACK_ALLOCATIONS.");
+        return;
+    }
+
+    logger.logEvent("---- CEGUI memory statistics ----");
+
+    for (size_t i = 0; i < d_memoryBudgets.size(); ++i)
+    {
+        const MemoryTag tag = MemoryTag(i);
+        const MemoryStatistics stats = MemoryTracker::getStatistics(tag);
+        const size_t budget = d_memoryBudgets[i];
+        const bool exceeded = budget && stats.d_peakBytes > budget;
+
+        std::stringstream& sstream = SharedStringstream::GetPreparedStream();
+        sstream << MemoryTracker::getTagName(tag)
+                << ": live bytes " << stats.d_liveBytes
+                << ", live allocations " << stats.d_liveAllocations
+                << ", peak bytes " << stats.d_peakBytes
+                << ", total allocations " << stats.d_totalAllocations;
+        if (budget)
+            sstream << ", budget " << budget << (exceeded ? " (exceeded)" : "");
+
+        logger.logEvent(String(sstream.str()),
+            exceeded ? LoggingLevel::Error : LoggingLevel::Standard);
+    }
+}
+
 //----------------------------------------------------------------------------//
 void System::invalidateAllWindows()
 {
@@ -0,0 +1,228 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/VertexBufferArena.h"
+
+namespace CEGUI
+{
+const size_t VertexBufferArena::UploadMergeDistance(256);
+
+namespace
+{
+//! Number of vertices the arena starts with.
+const size_t InitialVertexCount = 1024;
+}
+
+//----------------------------------------------------------------------------//
+VertexBufferArena::VertexBufferArena(size_t floatsPerVertex) :
+    d_floatsPerVertex(floatsPerVertex),
+    d_uploadRangesCoalesced(true),
+    d_fullUploadNeeded(true)
+{
+}
+
+//----------------------------------------------------------------------------//
+bool VertexBufferArena::update(Allocation& allocation,
+                               const float* vertexData, size_t floatCount)
+{
+    const size_t vertexCount = floatCount / d_floatsPerVertex;
+    if (!vertexCount)
+        return false;
+
+    if (!allocation.isValid() || vertexCount > allocation.d_capacity)
+    {
+        release(allocation);
+        allocate(allocation, vertexCount);
+    }
+
+    if (allocation.isDirty())
+    {
+        const size_t begin = std::min(allocation.d_dirtyBegin, vertexCount);
+        const size_t end = std::min(allocation.d_dirtyEnd, vertexCount);
+
+        if (begin < end)
+        {
+            const size_t offset = (allocation.d_firstVertex + begin) * d_floatsPerVertex;
+            const size_t count = (end - begin) * d_floatsPerVertex;
+
+            std::copy(vertexData + begin * d_floatsPerVertex,
+                      vertexData + end * d_floatsPerVertex,
+                      d_data.begin() + offset);
+
+            d_uploadRanges.push_back(std::make_pair(offset, count));
+            d_uploadRangesCoalesced = false;
+            d_statistics.bytesCopied += count * sizeof(float);
+        }
+
+        allocation.d_dirtyBegin = std::numeric_limits<size_t>::max();
+        allocation.d_dirtyEnd = 0;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void VertexBufferArena::release(Allocation& allocation)
+{
+    if (!allocation.isValid())
+        return;
+
+    size_t first = allocation.d_firstVertex;
+    size_t count = allocation.d_capacity;
+
+    // merge with the free ranges directly before and after
+    auto next = d_freeRanges.lower_bound(first);
+    if (next != d_freeRanges.begin())
+    {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == first)
+        {
+            first = prev->first;
+            count += prev->second;
+            d_freeRanges.erase(prev);
+        }
+    }
+
+    if (next != d_freeRanges.end() && next->first == first + count)
+    {
+        count += next->second;
+        d_freeRanges.erase(next);
+    }
+
+    d_freeRanges[first] = count;
+
+    allocation.d_capacity = 0;
+    allocation.markAllDirty();
+}
+
+//----------------------------------------------------------------------------//
+const std::vector<std::pair<size_t, size_t> >& VertexBufferArena::getUploadRanges()
+{
+    if (d_uploadRangesCoalesced)
+        return d_uploadRanges;
+
+    std::sort(d_uploadRanges.begin(), d_uploadRanges.end());
+
+    size_t last = 0;
+    for (size_t i = 1; i < d_uploadRanges.size(); ++i)
+    {
+        auto& current = d_uploadRanges[last];
+        const auto& range = d_uploadRanges[i];
+
+        const size_t currentEnd = current.first + current.second;
+        if (range.first <= currentEnd + UploadMergeDistance)
+            current.second = std::max(currentEnd, range.first + range.second) - current.first;
+        else
+            d_uploadRanges[++last] = range;
+    }
+
+    if (!d_uploadRanges.empty())
+        d_uploadRanges.resize(last + 1);
+
+    d_uploadRangesCoalesced = true;
+    return d_uploadRanges;
+}
+
+//----------------------------------------------------------------------------//
+void VertexBufferArena::clearUploadRanges()
+{
+    if (d_fullUploadNeeded)
+    {
+        d_statistics.bytesUploaded += d_data.size() * sizeof(float);
+        ++d_statistics.uploadRanges;
+    }
+    else
+    {
+        for (const auto& range : getUploadRanges())
+            d_statistics.bytesUploaded += range.second * sizeof(float);
+        d_statistics.uploadRanges += d_uploadRanges.size();
+    }
+
+    d_uploadRanges.clear();
+    d_uploadRangesCoalesced = true;
+    d_fullUploadNeeded = false;
+}
+
+//----------------------------------------------------------------------------//
+void VertexBufferArena::allocate(Allocation& allocation, size_t vertexCount)
+{
+    // leave some room, so that a moderately growing buffer keeps its place
+    const size_t capacity = (vertexCount + vertexCount / 4 + 7) & ~static_cast<size_t>(7);
+
+    auto it = std::find_if(d_freeRanges.begin(), d_freeRanges.end(),
+        [capacity](const std::pair<const size_t, size_t>& range)
+        {
+            return range.second >= capacity;
+        });
+
+    if (it == d_freeRanges.end())
+    {
+        grow(capacity);
+        // the free range at the end of the arena is now large enough
+        it = std::prev(d_freeRanges.end());
+    }
+
+    const size_t first = it->first;
+    const size_t remaining = it->second - capacity;
+    d_freeRanges.erase(it);
+    if (remaining)
+        d_freeRanges[first + capacity] = remaining;
+
+    allocation.d_firstVertex = first;
+    allocation.d_capacity = capacity;
+    allocation.markAllDirty();
+}
+
+//----------------------------------------------------------------------------//
+void VertexBufferArena::grow(size_t minimumVertexCount)
+{
+    const size_t oldCount = d_data.size() / d_floatsPerVertex;
+
+    // a free range at the end of the arena is extended instead of adding one
+    size_t freeFirst = oldCount;
+    if (!d_freeRanges.empty())
+    {
+        auto last = std::prev(d_freeRanges.end());
+        if (last->first + last->second == oldCount)
+        {
+            freeFirst = last->first;
+            d_freeRanges.erase(last);
+        }
+    }
+
+    const size_t newCount = std::max(std::max(oldCount * 2, InitialVertexCount),
+                                     freeFirst + minimumVertexCount);
+
+    d_data.resize(newCount * d_floatsPerVertex);
+    d_freeRanges[freeFirst] = newCount - freeFirst;
+
+    d_fullUploadNeeded = true;
+    ++d_statistics.growths;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
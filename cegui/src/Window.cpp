@@ -28,6 +28,7 @@
  ***************************************************************************/
 #include "CEGUI/Window.h"
 #include "CEGUI/GUIContext.h"
+#include "CEGUI/FrameProfiler.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Renderer.h"
 #include "CEGUI/WindowManager.h"
@@ -42,6 +43,7 @@
 #include "CEGUI/falagard/WidgetLookManager.h"
 #include "CEGUI/falagard/WidgetLookFeel.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryRecorder.h"
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/RenderTarget.h"
@@ -50,9 +52,26 @@
 #include "CEGUI/widgets/DragContainer.h"
 
 #include <deque>
+#include <vector>
 
 namespace CEGUI
 {
+namespace
+{
+//----------------------------------------------------------------------------//
+// FNV-1a hash of the code units of a name, or of a segment of a name path.
+std::size_t hashName(const String& str, size_t pos, size_t length)
+{
+    std::uint32_t hash = 2166136261u;
+
+    for (size_t i = pos; i < pos + length; ++i)
+        hash = (hash ^ static_cast<std::uint32_t>(str[i])) * 16777619u;
+
+    return hash;
+}
+
+}
+
 //----------------------------------------------------------------------------//
 const String Window::AlphaPropertyName("Alpha");
 const String Window::AlwaysOnTopPropertyName("AlwaysOnTop");
@@ -144,6 +163,9 @@ const String Window::AutoWindowNamePathXMLAttributeName("namePath");
 const String Window::UserStringNameXMLAttributeName("name");
 const String Window::UserStringValueXMLAttributeName("value");
 
+//----------------------------------------------------------------------------//
+std::uint64_t Window::s_hierarchyVersion = 0;
+
 //----------------------------------------------------------------------------//
 Window::WindowRendererProperty Window::d_windowRendererProperty;
 Window::LookNFeelProperty Window::d_lookNFeelProperty;
@@ -276,6 +298,8 @@ void Window::destroy()
     WindowEventArgs args(this);
     onDestructionStarted(args);
 
+    ++s_hierarchyVersion;
+
     // Check we are detached from parent, or from context in the case of root
     if (d_parent)
         d_parent->removeChild(this);
@@ -321,28 +345,47 @@ Window* Window::getChild(const String& name_path) const
 }
 
 //----------------------------------------------------------------------------//
-Window* Window::getChildRecursive(const String& name) const
+Window* Window::findChild(const String& name_path) const
 {
-    std::deque<Element*> openList;
-
-    for (Element* child : d_children)
-        openList.push_back(child);
+    const Window* window = this;
+    size_t pos = 0;
 
-    // breadth-first search for the child to find
-    while (!openList.empty())
+    while ((window = window->getChildLookupTarget(name_path, pos)))
     {
-        Element* child = openList.front();
-        openList.pop_front();
+        const size_t sep = name_path.find_first_of('/', pos);
+        const size_t end = (sep == String::npos) ? name_path.length() : sep;
 
-        if (!child) continue;
+        Window* const child = window->findImmediateChild(name_path, pos, end - pos);
 
-        Window* window = static_cast<Window*>(child);
-        if (window->getName() == name)
-            return window;
+        // a trailing separator is ignored
+        if (!child || end + 1 >= name_path.length())
+            return child;
 
-        const size_t childCount = child->getChildCount();
-        for (size_t i = 0; i < childCount; ++i)
-            openList.push_back(child->getChildElementAtIndex(i));
+        window = child;
+        pos = end + 1;
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+Window* Window::getChildRecursive(const String& name) const
+{
+    std::vector<const Window*> openList(1, this);
+
+    // breadth-first search for the child to find. Looking the name up in the
+    // index of each window visits the candidates in the same order as
+    // comparing the names of their children one by one would.
+    for (size_t next = 0; next < openList.size(); ++next)
+    {
+        const Window* const window = openList[next];
+
+        if (Window* child = window->findImmediateChild(name, 0, name.length()))
+            return child;
+
+        for (Element* child : window->d_children)
+            if (child)
+                openList.push_back(static_cast<Window*>(child));
     }
 
     return nullptr;
@@ -1209,9 +1252,6 @@ void Window::setInheritsAlpha(bool setting)
 void Window::invalidate(bool recursive)
 {
     invalidate_impl(recursive);
-
-    if (d_guiContext)
-        d_guiContext->markAsDirty();
 }
 
 //----------------------------------------------------------------------------//
@@ -1219,8 +1259,14 @@ void Window::invalidate_impl(bool recursive)
 {
     d_needsRedraw = true;
 
+    // cached windows count the redraws of their texture instead
+    if (!d_autoCached)
+        ++d_autoCacheChanges;
+
     if (auto rs = getTargetRenderingSurface())
         rs->invalidate();
+    if (d_guiContext)
+        d_guiContext->markWindowForRedraw(*this);
 
     WindowEventArgs args(this);
     onInvalidated(args);
@@ -1250,6 +1296,9 @@ void Window::draw(std::uint32_t drawModeMask)
     // redraw if no surface set, or if surface is invalidated
     if (!d_surface || d_surface->isInvalidated())
     {
+        if (d_autoCached)
+            ++d_autoCacheChanges;
+
         // perform drawing for 'this' Window
         if (allowDrawing)
             drawSelf(ctx, drawModeMask);
@@ -1268,29 +1317,101 @@ void Window::draw(std::uint32_t drawModeMask)
 void Window::drawSelf(const RenderingContext& ctx, std::uint32_t drawModeMask)
 {
     bufferGeometry(ctx, drawModeMask);
-    ctx.surface->addGeometryBuffers(ctx.queue, d_geometryBuffers);
+
+    if (d_guiContext)
+        d_guiContext->queueWindowGeometry(*this, ctx);
+    else
+        ctx.surface->addGeometryBuffers(ctx.queue, d_geometryBuffers);
 }
 
 //----------------------------------------------------------------------------//
 void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMask*/)
 {
-    if (!d_needsRedraw)
+    CEGUI_PROFILE_SCOPE_DETAIL("Window::bufferGeometry", getType());
+
+    std::vector<GeometryBuffer*> previousBuffers;
+    if (!beginGeometryGeneration(previousBuffers))
         return;
 
-    // dispose of already cached geometry.
-    for (auto buffer : d_geometryBuffers)
-        System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
-    d_geometryBuffers.clear();
+    // when the old buffers may be updated in place, the new geometry is only
+    // recorded on the CPU, so that the update is the only upload.
+    GeometryRecorder* recorder = nullptr;
+    if (d_guiContext && !previousBuffers.empty() && !GeometryRecorder::getCurrent())
+    {
+        recorder = &d_guiContext->getGeometryRecorder();
+        GeometryRecorder::setCurrent(recorder);
+    }
+
+    try
+    {
+        generateGeometry();
+    }
+    catch (...)
+    {
+        if (recorder)
+        {
+            GeometryRecorder::setCurrent(nullptr);
+            recorder->materialise(d_geometryBuffers);
+            recorder->clear();
+        }
+        throw;
+    }
+
+    if (recorder)
+        GeometryRecorder::setCurrent(nullptr);
+
+    endGeometryGeneration(previousBuffers, recorder);
+
+    // the recorded buffers were either copied into the old ones or replaced
+    if (recorder)
+        recorder->clear();
+}
+
+//----------------------------------------------------------------------------//
+bool Window::beginGeometryGeneration(std::vector<GeometryBuffer*>& previousBuffers)
+{
+    if (!d_needsRedraw)
+        return false;
+
+    // keep the already cached geometry until the new one is generated; when
+    // only the vertex contents changed the old buffers are updated in place.
+    previousBuffers.clear();
+    previousBuffers.swap(d_geometryBuffers);
 
     // signal rendering started
     WindowEventArgs args(this);
     onRenderingStarted(args);
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void Window::generateGeometry()
+{
+    CEGUI_PROFILE_SCOPE_DETAIL("Window::generateGeometry", getType());
 
     // re-populate geometry buffers
     if (d_windowRenderer)
         d_windowRenderer->createRenderGeometry();
     else
         populateGeometryBuffer();
+}
+
+//----------------------------------------------------------------------------//
+void Window::endGeometryGeneration(std::vector<GeometryBuffer*>& previousBuffers,
+                                   const GeometryRecorder* recorder)
+{
+    if (!updateRetainedGeometry(previousBuffers))
+    {
+        // dispose of the old geometry.
+        for (auto buffer : previousBuffers)
+            System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+
+        // geometry recorded on another thread can't be drawn as it is
+        if (recorder)
+            recorder->materialise(d_geometryBuffers);
+    }
+
+    previousBuffers.clear();
 
     // NB: it is important to do this after rendering to buffers but before setting them up
     d_needsRedraw = false;
@@ -1300,10 +1421,25 @@ void Window::bufferGeometry(const RenderingContext&, std::uint32_t /*drawModeMas
     updateGeometryAlpha();
 
     // signal rendering ended
-    args.handled = 0;
+    WindowEventArgs args(this);
     onRenderingEnded(args);
 }
 
+//----------------------------------------------------------------------------//
+bool Window::isGeometryGenerationThreadSafe() const
+{
+    return d_windowRenderer && d_windowRenderer->isGeometryGenerationThreadSafe();
+}
+
+//----------------------------------------------------------------------------//
+void Window::updateRenderingAreaCaches() const
+{
+    getUnclippedOuterRect().get();
+    getUnclippedInnerRect().get();
+    getOuterRectClipper();
+    getInnerRectClipper();
+}
+
 //----------------------------------------------------------------------------//
 void Window::cleanupChildren()
 {
@@ -1320,6 +1456,105 @@ void Window::cleanupChildren()
     }
 }
 
+//----------------------------------------------------------------------------//
+void Window::captureInitialState(InitialState& state) const
+{
+    for (PropertySet::PropertyIterator propertyIt = getPropertyIterator();
+         !propertyIt.isAtEnd();
+         ++propertyIt)
+    {
+        Property* const property = propertyIt.getCurrentValue();
+
+        // these define what the window is rather than its state
+        if (property == &d_lookNFeelProperty ||
+            property == &d_windowRendererProperty ||
+            propertyIt.getCurrentKey() == "Name" ||
+            propertyIt.getCurrentKey() == AutoWindowPropertyName)
+            continue;
+
+        if (property->isReadable() && property->isWritable())
+            state.d_properties.emplace_back(property, property->get(this));
+    }
+
+    state.d_userStrings = d_userStrings;
+
+    for (size_t i = 0; i < getChildCount(); ++i)
+    {
+        const Window* wnd = getChildAtIndex(i);
+        if (!wnd->isAutoWindow())
+            continue;
+
+        state.d_autoWindows.emplace_back(wnd->getName(), InitialState());
+        wnd->captureInitialState(state.d_autoWindows.back().second);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::resetForReuse(const InitialState& state,
+                           std::uint64_t subscriptionSequence)
+{
+    // to anything outside, the window is destroyed
+    WindowEventArgs args(this);
+    onDestructionStarted(args);
+
+    if (d_parent)
+        d_parent->removeChild(this);
+    else if (d_guiContext)
+        attachToGUIContext(nullptr);
+
+    AnimationManager::getSingleton().destroyAnimationInstances(this);
+
+    cleanupAddedChildren();
+    restoreInitialState(state, subscriptionSequence);
+
+    d_destructionStarted = false;
+}
+
+//----------------------------------------------------------------------------//
+void Window::cleanupAddedChildren()
+{
+    // children added after creation go the same way as in cleanupChildren
+    for (size_t i = getChildCount(); i-- > 0; )
+    {
+        Window* wnd = getChildAtIndex(i);
+        if (wnd->isAutoWindow())
+        {
+            wnd->cleanupAddedChildren();
+            continue;
+        }
+
+        removeChild(wnd);
+
+        if (wnd->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(wnd);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Window::restoreInitialState(const InitialState& state,
+                                 std::uint64_t subscriptionSequence)
+{
+    unsubscribeAfter(subscriptionSequence);
+
+    for (const auto& propertyAndValue : state.d_properties)
+    {
+        if (propertyAndValue.first->get(this) != propertyAndValue.second)
+            propertyAndValue.first->set(this, propertyAndValue.second);
+    }
+
+    // falagard property definitions keep their values in user strings, so
+    // these are restored rather than cleared, and only after the properties.
+    if (d_userStrings != state.d_userStrings)
+        d_userStrings = state.d_userStrings;
+    d_userData = nullptr;
+
+    for (const auto& nameAndState : state.d_autoWindows)
+    {
+        if (Window* wnd = findChild(nameAndState.first))
+            wnd->restoreInitialState(nameAndState.second, subscriptionSequence);
+    }
+}
+
 //----------------------------------------------------------------------------//
 void Window::addChild_impl(Element* element)
 {
@@ -1339,6 +1574,7 @@ void Window::addChild_impl(Element* element)
             "attached.");
 
     Element::addChild_impl(element);
+    addToChildNameIndex(*wnd);
 
     // Register the new child for drawing
     addWindowToDrawList(*wnd);
@@ -1365,6 +1601,7 @@ void Window::removeChild_impl(Element* element)
     wnd->attachToGUIContext(nullptr);
 
     Element::removeChild_impl(wnd);
+    removeFromChildNameIndex(*wnd);
 
     wnd->onZChange_impl();
 }
@@ -1430,6 +1667,8 @@ void Window::setDestroyedByParent(bool setting)
 //----------------------------------------------------------------------------//
 void Window::update(float elapsed)
 {
+    CEGUI_PROFILE_SCOPE_DETAIL("Window::update", getType());
+
     // perform update for 'this' Window
     updateSelf(elapsed);
 
@@ -1569,6 +1808,9 @@ void Window::setLookNFeel(const String& look)
     wlMgr.getWidgetLook(look).initialiseWidget(*this);
     d_initialising = prevInit;
 
+    // windows of the same type and look share their property table
+    sharePropertyTable();
+
     // do the necessary binding to the stuff added by the look and feel
     initialiseComponents();
     // let the window renderer know about this
@@ -1595,7 +1837,17 @@ void Window::setName(const String& name)
     Logger::getSingleton().logEvent("Renamed element at: " + getNamePath() +
         " as: " + name, LoggingLevel::Informative);
 
-    d_name = name;
+    if (Window* parent = getParent())
+    {
+        parent->removeFromChildNameIndex(*this);
+        d_name = name;
+        parent->addToChildNameIndex(*this);
+    }
+    else
+    {
+        d_name = name;
+        ++s_hierarchyVersion;
+    }
 
     WindowEventArgs args(this);
     onNameChanged(args);
@@ -1914,6 +2166,8 @@ void Window::onIDChanged(WindowEventArgs& e)
 void Window::onShown(WindowEventArgs& e)
 {
     invalidate();
+    if (d_guiContext)
+        d_guiContext->markAsDirty();
     fireEvent(EventShown, e, EventNamespace);
 }
 
@@ -1923,6 +2177,8 @@ void Window::onHidden(WindowEventArgs& e)
     releaseInput();
     deactivate();
     invalidate();
+    if (d_guiContext)
+        d_guiContext->markAsDirty();
     fireEvent(EventHidden, e, EventNamespace);
 }
 
@@ -2684,6 +2940,9 @@ void Window::setRenderingSurface(RenderingSurface* surface)
 //----------------------------------------------------------------------------//
 void Window::setUsingAutoRenderingSurface(bool setting)
 {
+    // GUIContext marks its own calls afterwards
+    d_autoCached = false;
+
     if (setting)
     {
         allocateRenderingWindow(d_autoRenderingSurfaceStencilEnabled);
@@ -2726,8 +2985,8 @@ void Window::allocateRenderingWindow(bool addStencilBuffer)
         return;
     }
 
-    TextureTarget* const t =
-        System::getSingleton().getRenderer()->createTextureTarget(addStencilBuffer);
+    TextureTarget* const t = System::getSingleton().getRenderer()->
+        acquireTextureTarget(d_pixelSize, addStencilBuffer);
 
     // TextureTargets may not be available, so check that first.
     if (!t)
@@ -2761,7 +3020,7 @@ void Window::releaseRenderingWindow()
     // destroy surface and texture target it used
     TextureTarget* tt = &oldSurface->getTextureTarget();
     oldSurface->getOwner().destroyRenderingWindow(*oldSurface);
-    System::getSingleton().getRenderer()->destroyTextureTarget(tt);
+    System::getSingleton().getRenderer()->releaseTextureTarget(tt);
 
     updateGeometryTransformAndClipping();
     if (d_guiContext)
@@ -3032,6 +3291,29 @@ void Window::updateGeometryTransformAndClipping()
     }
 }
 
+//----------------------------------------------------------------------------//
+bool Window::updateRetainedGeometry(std::vector<GeometryBuffer*>& previousBuffers)
+{
+    // in-place updates are only possible when every buffer keeps its layout,
+    // otherwise the whole set of buffers is replaced.
+    if (previousBuffers.empty() || previousBuffers.size() != d_geometryBuffers.size())
+        return false;
+
+    for (size_t i = 0; i < previousBuffers.size(); ++i)
+        if (!previousBuffers[i]->isLayoutCompatible(*d_geometryBuffers[i]))
+            return false;
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    for (size_t i = 0; i < previousBuffers.size(); ++i)
+    {
+        previousBuffers[i]->updateFrom(*d_geometryBuffers[i]);
+        renderer.destroyGeometryBuffer(*d_geometryBuffers[i]);
+    }
+
+    d_geometryBuffers.swap(previousBuffers);
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void Window::updateGeometryAlpha()
 {
@@ -3075,11 +3357,16 @@ void Window::attachToGUIContext(GUIContext* context)
 
     const Font* prevDefaultFont = d_guiContext ? d_guiContext->getDefaultFont() : nullptr;
 
+    // the old context may still reference our geometry in its draw list
+    if (d_guiContext)
+        d_guiContext->markAsDirty();
+
     setGUIContextRecursively(context);
     onTargetSurfaceChanged(context ? getTargetRenderingSurface() : nullptr);
 
     if (context)
     {
+        context->markAsDirty();
         notifyScreenAreaChanged();
 
         if (prevDefaultFont != d_guiContext->getDefaultFont())
@@ -3234,26 +3521,58 @@ void Window::banPropertiesForAutoWindow()
 }
 
 //----------------------------------------------------------------------------//
-Window* Window::findChildByNamePath_impl(const String& name_path) const
+const Window* Window::getChildLookupTarget(const String& /*name_path*/,
+                                           size_t /*pos*/) const
 {
-    //!!!TODO: optimize through immutable string_view!
-    const size_t sep = name_path.find_first_of('/');
-    const String base_child(name_path.substr(0, sep));
+    return this;
+}
 
-    const size_t child_count = d_children.size();
-    for (size_t i = 0; i < child_count; ++i)
+//----------------------------------------------------------------------------//
+Window* Window::findImmediateChild(const String& name_path, size_t pos,
+                                   size_t length) const
+{
+    const auto range = d_childNameIndex.equal_range(hashName(name_path, pos, length));
+
+    for (auto it = range.first; it != range.second; ++it)
     {
-        auto child = getChildAtIndex(i);
-        if (child->getName() == base_child)
+        const String& name = it->second->getName();
+        if (name.length() == length && !name.compare(0, length, name_path, pos, length))
+            return it->second;
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------//
+void Window::addToChildNameIndex(Window& wnd)
+{
+    const std::size_t hash = hashName(wnd.getName(), 0, wnd.getName().length());
+
+    const auto range = d_childNameIndex.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+        if (it->second == &wnd)
+            return;
+
+    d_childNameIndex.emplace(hash, &wnd);
+    ++s_hierarchyVersion;
+}
+
+//----------------------------------------------------------------------------//
+void Window::removeFromChildNameIndex(const Window& wnd)
+{
+    const auto range = d_childNameIndex.equal_range(
+        hashName(wnd.getName(), 0, wnd.getName().length()));
+
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == &wnd)
         {
-            if (sep != String::npos && sep < name_path.length() - 1)
-                return child->findChild(name_path.substr(sep + 1));
-            else
-                return child;
+            d_childNameIndex.erase(it);
+            break;
         }
     }
 
-    return nullptr;
+    ++s_hierarchyVersion;
 }
 
 //----------------------------------------------------------------------------//
@@ -66,6 +66,7 @@ const String WindowManager::EventWindowDestroyed("WindowDestroyed");
     Constructor
 *************************************************************************/
 WindowManager::WindowManager(void) :
+    d_registryHoles(0),
     d_uid_counter(0),
     d_lockCount(0)
 {
@@ -81,7 +82,12 @@ WindowManager::WindowManager(void) :
 *************************************************************************/
 WindowManager::~WindowManager(void)
 {
+	// everything is destroyed for good now
+	for (auto& pool : d_windowPools)
+		pool.second.d_maxSize = 0;
+
 	destroyAllWindows();
+	clearWindowPools();
     cleanDeadPool();
 
     String addressStr = SharedStringstream::GetPointerAddressAsString(this);
@@ -103,6 +109,31 @@ Window* WindowManager::createWindow(const String& type, const String& name)
 
     String finalName(name.empty() ? generateUniqueWindowName() : name);
 
+    auto pool = d_windowPools.find(type);
+    const bool pooled = pool != d_windowPools.end() && pool->second.d_maxSize;
+
+    // reuse a parked window if there is one
+    if (pooled && !pool->second.d_windows.empty())
+    {
+        Window* window = pool->second.d_windows.back();
+        pool->second.d_windows.pop_back();
+
+        window->setName(finalName);
+
+        String addressStr = SharedStringstream::GetPointerAddressAsString(window);
+        Logger::getSingleton().logEvent("Window '" + finalName +"' of type '" +
+            type + "' has been reused from the window pool. " + addressStr,
+            LoggingLevel::Informative);
+
+        registerWindow(window);
+        registerAutoWindows(window);
+
+        WindowEventArgs args(window);
+        fireEvent(EventWindowCreated, args, EventNamespace);
+
+        return window;
+    }
+
     WindowFactoryManager& wfMgr = WindowFactoryManager::getSingleton();
     WindowFactory* factory = wfMgr.getFactory(type);
 
@@ -124,8 +155,28 @@ Window* WindowManager::createWindow(const String& type, const String& name)
 
         initialiseRenderEffect(newWindow, fwm.d_effectName);
     }
+    else
+    {
+        // windows of the same type share their property table
+        newWindow->sharePropertyTable();
+    }
+
+    // subscriptions made from here on are removed when the window is reused
+    if (pooled)
+    {
+        newWindow->d_reusable = true;
+        newWindow->d_reuseSubscriptionSequence = Event::getSubscriptionSequence();
+
+        // all windows of the type start out the same
+        WindowPool& windowPool = d_windowPools[type];
+        if (!windowPool.d_hasInitialState)
+        {
+            newWindow->captureInitialState(windowPool.d_initialState);
+            windowPool.d_hasInitialState = true;
+        }
+    }
 
-	d_windowRegistry.push_back(newWindow);
+    registerWindow(newWindow);
 
     // fire event to notify interested parites about the new window.
     WindowEventArgs args(newWindow);
@@ -188,14 +239,9 @@ void WindowManager::initialiseRenderEffect(
 *************************************************************************/
 void WindowManager::destroyWindow(Window* window)
 {
-	WindowVector::iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
-
     String addressStr = SharedStringstream::GetPointerAddressAsString(&window);
 
-	if (iter == d_windowRegistry.end())
+	if (!isAlive(window))
     {
         Logger::getSingleton().logEvent("[WindowManager] Attempt to delete "
             "Window that does not exist!  Address was: " + addressStr +
@@ -204,7 +250,28 @@ void WindowManager::destroyWindow(Window* window)
         return;
     }
 
-    d_windowRegistry.erase(iter);
+    unregisterWindow(window);
+
+    auto pool = d_windowPools.find(window->getType());
+    if (pool != d_windowPools.end() &&
+        pool->second.d_windows.size() < pool->second.d_maxSize &&
+        pool->second.d_hasInitialState && window->d_reusable &&
+        !window->isAutoWindow())
+    {
+        Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
+            "' will be added to the window pool. " + addressStr,
+            LoggingLevel::Informative);
+
+        window->resetForReuse(pool->second.d_initialState,
+                              window->d_reuseSubscriptionSequence);
+        // the auto windows stay with their parent, but are not alive either
+        unregisterAutoWindows(window);
+        pool->second.d_windows.push_back(window);
+
+        WindowEventArgs args(window);
+        fireEvent(EventWindowDestroyed, args, EventNamespace);
+        return;
+    }
 
     Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
         "' will be added to dead pool. " + addressStr, LoggingLevel::Informative);
@@ -227,19 +294,152 @@ void WindowManager::destroyWindow(Window* window)
 *************************************************************************/
 void WindowManager::destroyAllWindows(void)
 {
-	while (!d_windowRegistry.empty())
-		destroyWindow(*d_windowRegistry.begin());
+    // windows are destroyed in order of creation; destroyed windows are only
+    // deleted by cleanDeadPool, so their pointers remain unique meanwhile.
+    while (!d_windowIndices.empty())
+    {
+        compactWindowRegistry();
+        const WindowVector windows(d_windowRegistry);
+
+        for (Window* window : windows)
+            if (isAlive(window))
+                destroyWindow(window);
+    }
 }
 
 //----------------------------------------------------------------------------//
 bool WindowManager::isAlive(const Window* window) const
 {
-	WindowVector::const_iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
+	return d_windowIndices.find(window) != d_windowIndices.end();
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::registerWindow(Window* window)
+{
+    d_windowIndices[window] = d_windowRegistry.size();
+    d_windowRegistry.push_back(window);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::unregisterWindow(Window* window)
+{
+    const auto index = d_windowIndices.find(window);
+    if (index == d_windowIndices.end())
+        return;
+
+    d_windowRegistry[index->second] = nullptr;
+    d_windowIndices.erase(index);
+
+    // keep the registry at least half full, so compacting is amortised O(1)
+    if (++d_registryHoles > d_windowRegistry.size() / 2)
+        compactWindowRegistry();
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::registerAutoWindows(Window* window)
+{
+    for (size_t i = 0; i < window->getChildCount(); ++i)
+    {
+        Window* const child = window->getChildAtIndex(i);
+        if (!child->isAutoWindow())
+            continue;
 
-	return iter != d_windowRegistry.end();
+        registerWindow(child);
+        registerAutoWindows(child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::unregisterAutoWindows(Window* window)
+{
+    for (size_t i = 0; i < window->getChildCount(); ++i)
+    {
+        Window* const child = window->getChildAtIndex(i);
+        if (!child->isAutoWindow())
+            continue;
+
+        unregisterWindow(child);
+        unregisterAutoWindows(child);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::compactWindowRegistry() const
+{
+    size_t count = 0;
+    for (Window* window : d_windowRegistry)
+    {
+        if (!window)
+            continue;
+
+        d_windowIndices[window] = count;
+        d_windowRegistry[count++] = window;
+    }
+
+    d_windowRegistry.resize(count);
+    d_registryHoles = 0;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::setWindowPoolSize(const String& type, size_t size)
+{
+    if (!size)
+    {
+        auto pool = d_windowPools.find(type);
+        if (pool != d_windowPools.end())
+        {
+            destroyPooledWindows(pool->second.d_windows);
+            d_windowPools.erase(pool);
+        }
+        return;
+    }
+
+    WindowPool& pool = d_windowPools[type];
+    pool.d_maxSize = size;
+
+    // destroy the windows that no longer fit
+    if (pool.d_windows.size() > size)
+    {
+        WindowVector excess(pool.d_windows.begin() + size, pool.d_windows.end());
+        pool.d_windows.resize(size);
+        destroyPooledWindows(excess);
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getWindowPoolSize(const String& type) const
+{
+    auto pool = d_windowPools.find(type);
+    return pool == d_windowPools.end() ? 0 : pool->second.d_maxSize;
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getPooledWindowCount(const String& type) const
+{
+    auto pool = d_windowPools.find(type);
+    return pool == d_windowPools.end() ? 0 : pool->second.d_windows.size();
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::clearWindowPools()
+{
+    for (auto& pool : d_windowPools)
+        destroyPooledWindows(pool.second.d_windows);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::destroyPooledWindows(WindowVector& pool)
+{
+    // parked windows are not alive, so destroy does the full cleanup. Their
+    // auto windows must be alive again to be destroyed with them.
+    for (Window* window : pool)
+    {
+        registerAutoWindows(window);
+        window->destroy();
+        d_deathrow.push_back(window);
+    }
+
+    pool.clear();
 }
 
 Window* WindowManager::loadLayoutFromContainer(const RawDataContainer& source, PropertyCallback* callback, void* userdata)
@@ -407,6 +607,9 @@ String WindowManager::generateUniqueWindowName()
 *************************************************************************/
 WindowManager::WindowIterator WindowManager::getIterator(void) const
 {
+	if (d_registryHoles)
+		compactWindowRegistry();
+
 	return WindowIterator(d_windowRegistry.begin(), d_windowRegistry.end());
 }
 
@@ -422,7 +625,8 @@ void WindowManager::DEBUG_dumpWindowNames(String zone) const
          i != d_windowRegistry.end();
          ++i)
     {
-        Logger::getSingleton().logEvent("Window : " + (*i)->getNamePath());
+        if (*i)
+            Logger::getSingleton().logEvent("Window : " + (*i)->getNamePath());
     }
     Logger::getSingleton().logEvent("-----------------");
 }
@@ -69,6 +69,25 @@ ColourRect WindowRenderer::getOptionalColour(const String& propertyName, const C
     return rect;
 }
 
+/************************************************************************
+    Whether the geometry may be generated on a worker thread
+*************************************************************************/
+bool WindowRenderer::isGeometryGenerationThreadSafe() const
+{
+    return false;
+}
+
+/************************************************************************
+    Whether the geometry of the assigned look may be generated on a worker
+    thread
+*************************************************************************/
+bool WindowRenderer::isLookGeometryGenerationThreadSafe() const
+{
+    const String& look = d_window->getLookNFeel();
+    return !look.empty() &&
+           WidgetLookManager::getSingleton().isGeometryGenerationThreadSafe(look);
+}
+
 /************************************************************************
     Get unclipped inner rectangle.
 *************************************************************************/
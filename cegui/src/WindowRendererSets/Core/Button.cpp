@@ -76,4 +76,9 @@ namespace CEGUI
         wlf.getStateImagery(actualStateName(state)).render(*w);
     }
 
+    bool FalagardButton::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
 } // End of  CEGUI namespace section
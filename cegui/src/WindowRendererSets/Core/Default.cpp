@@ -45,4 +45,9 @@ namespace CEGUI
         wlf.getStateImagery(d_window->isEffectiveDisabled() ? "Disabled" : "Enabled").render(*d_window);
     }
 
+    bool FalagardDefault::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
 } // End of  CEGUI namespace section
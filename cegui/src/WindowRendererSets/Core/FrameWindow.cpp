@@ -71,6 +71,11 @@ namespace CEGUI
         imagery->render(*w);
     }
 
+    bool FalagardFrameWindow::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     Rectf FalagardFrameWindow::getUnclippedInnerRect(void) const
     {
         FrameWindow* w = static_cast<FrameWindow*>(d_window);
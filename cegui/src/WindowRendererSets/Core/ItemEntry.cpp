@@ -59,6 +59,11 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardItemEntry::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     Sizef FalagardItemEntry::getItemPixelSize() const
     {
         // get WidgetLookFeel for the assigned look.
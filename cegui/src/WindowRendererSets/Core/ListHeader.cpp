@@ -54,6 +54,11 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardListHeader::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     const String& FalagardListHeader::getSegmentWidgetType() const
     {
         return d_segmentWidgetType;
@@ -104,4 +104,9 @@ namespace CEGUI
         }
     }
 
+    bool FalagardListHeaderSegment::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
 } // End of  CEGUI namespace section
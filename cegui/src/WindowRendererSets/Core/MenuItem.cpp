@@ -121,6 +121,12 @@ void FalagardMenuItem::createRenderGeometry()
     }
 }
 
+//----------------------------------------------------------------------------//
+bool FalagardMenuItem::isGeometryGenerationThreadSafe() const
+{
+    return isLookGeometryGenerationThreadSafe();
+}
+
 //----------------------------------------------------------------------------//
 bool FalagardMenuItem::handleFontRenderSizeChange(const Font* const font)
 {
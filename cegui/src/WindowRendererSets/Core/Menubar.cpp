@@ -51,6 +51,11 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardMenubar::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     Rectf FalagardMenubar::getItemRenderArea(void) const
     {
         const WidgetLookFeel& wlf = getLookNFeel();
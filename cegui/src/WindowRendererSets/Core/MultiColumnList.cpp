@@ -32,6 +32,8 @@
 #include "CEGUI/widgets/Scrollbar.h"
 #include "CEGUI/widgets/ListHeader.h"
 #include "CEGUI/widgets/ListboxTextItem.h"
+#include <algorithm>
+#include <vector>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -112,20 +114,54 @@ namespace CEGUI
             w->isActive() ? ActiveSelectionColourPropertyName : InactiveSelectionColourPropertyName,
             ListboxItem::DefaultSelectionColour);
 
-        // loop through the items
-        for (unsigned int i = 0; i < w->getRowCount(); ++i)
+        // find the range of columns that intersect the items area; the widths
+        // do not depend on the row, so they are only calculated once.
+        const unsigned int colCount = w->getColumnCount();
+        const float headerWidth = header->getPixelSize().d_width;
+        float firstColX = itemsArea.left() - horzScrollbar->getScrollPosition();
+        unsigned int firstCol = 0;
+        unsigned int endCol = 0;
+        std::vector<float> colWidths;
+        colWidths.reserve(colCount);
+
+        for (float x = firstColX; endCol < colCount && x < itemsArea.right(); ++endCol)
         {
-            // set initial x position for this row.
-            itemPos.x = itemsArea.left() - horzScrollbar->getScrollPosition();
+            colWidths.push_back(CoordConverter::asAbsolute(header->getColumnWidth(endCol), headerWidth));
+            x += colWidths.back();
 
-            // calculate height for this row.
-            itemSize.d_height = w->getHighestRowItemHeight(i);
+            // skip columns that end left of the items area
+            if (x <= itemsArea.left())
+            {
+                firstColX = x;
+                firstCol = endCol + 1;
+            }
+        }
+
+        // find the range of rows that intersect the items area using the
+        // cached row offsets, rather than visiting every row in the list.
+        const float scrollPos = vertScrollbar->getScrollPosition();
+        const unsigned int firstRow = w->getRowAtOffset(scrollPos);
+        const unsigned int endRow = std::min(w->getRowCount(),
+            w->getRowAtOffset(scrollPos + itemsArea.getHeight()) + 1);
+
+        const float rowsTop = itemPos.y;
 
-            // loop through the columns in this row
-            for (unsigned int j = 0; j < w->getColumnCount(); ++j)
+        // loop through the visible items
+        for (unsigned int i = firstRow; i < endRow; ++i)
+        {
+            // set initial position for this row.
+            itemPos.x = firstColX;
+            itemPos.y = rowsTop + w->getRowOffset(i);
+
+            // the height comes from the cached offsets too, so that it agrees
+            // with the range of rows found above.
+            itemSize.d_height = w->getRowOffset(i + 1) - w->getRowOffset(i);
+
+            // loop through the visible columns in this row
+            for (unsigned int j = firstCol; j < endCol; ++j)
             {
                 // allow item to use full width of the column
-                itemSize.d_width = CoordConverter::asAbsolute(header->getColumnWidth(j), header->getPixelSize().d_width);
+                itemSize.d_width = colWidths[j];
 
                 ListboxItem* item = w->getItemAtGridReference(MCLGridRef(i,j));
 
@@ -155,9 +191,6 @@ namespace CEGUI
                 // update position for next column.
                 itemPos.x += itemSize.d_width;
             }
-
-            // update position ready for next row
-            itemPos.y += itemSize.d_height;
         }
     }
 
@@ -51,6 +51,11 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardPopupMenu::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     Rectf FalagardPopupMenu::getItemRenderArea(void) const
     {
         const WidgetLookFeel& wlf = getLookNFeel();
@@ -105,6 +105,11 @@ namespace CEGUI
         imagery->render(*d_window, progressRect, nullptr, &progressClipper);
     }
 
+    bool FalagardProgressBar::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     bool FalagardProgressBar::isVertical() const
     {
         return d_vertical;
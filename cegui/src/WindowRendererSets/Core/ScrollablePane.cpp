@@ -79,6 +79,11 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardScrollablePane::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     void FalagardScrollablePane::onLookNFeelAssigned()
     {
         d_widgetLookAssigned = true;
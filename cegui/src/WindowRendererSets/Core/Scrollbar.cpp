@@ -57,6 +57,11 @@ namespace CEGUI
         imagery.render(*d_window);
     }
 
+    bool FalagardScrollbar::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     bool FalagardScrollbar::performChildWindowLayout()
     {
         updateThumb();
@@ -63,6 +63,12 @@ void FalagardSlider::createRenderGeometry()
     imagery.render(*d_window);
 }
 
+//----------------------------------------------------------------------------//
+bool FalagardSlider::isGeometryGenerationThreadSafe() const
+{
+    return isLookGeometryGenerationThreadSafe();
+}
+
 //----------------------------------------------------------------------------//
 bool FalagardSlider::performChildWindowLayout()
 {
@@ -103,6 +103,11 @@ namespace CEGUI
         wlf.getStateImagery(is_enabled ? "Enabled" : "Disabled").render(*d_window);
     }
 
+    bool FalagardStatic::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     void FalagardStatic::onIsFrameEnabledChanged()
     {
         d_window->invalidate();
@@ -169,6 +169,13 @@ void FalagardStaticText::createRenderGeometry()
     d_renderedText.createRenderGeometry(d_window->getGeometryBuffers(), destRect.getPosition(), &d_textCols, &clipper);
 }
 
+//----------------------------------------------------------------------------//
+bool FalagardStaticText::isGeometryGenerationThreadSafe() const
+{
+    // the text is rendered here, whatever the look contains
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 void FalagardStaticText::onIsFrameEnabledChanged()
 {
@@ -72,6 +72,12 @@ void FalagardTabButton::createRenderGeometry()
     wlf.getStateImagery(prefix + state).render(*w);
 }
 
+//----------------------------------------------------------------------------//
+bool FalagardTabButton::isGeometryGenerationThreadSafe() const
+{
+    return isLookGeometryGenerationThreadSafe();
+}
+
 //----------------------------------------------------------------------------//
 Sizef FalagardTabButton::getContentSize() const
 {
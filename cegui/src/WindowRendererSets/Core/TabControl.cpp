@@ -54,6 +54,11 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardTabControl::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
     TabButton* FalagardTabControl::createTabButton(const String& name) const
     {
         if (d_tabButtonType.empty())
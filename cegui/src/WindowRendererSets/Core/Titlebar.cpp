@@ -63,4 +63,9 @@ namespace CEGUI
         imagery->render(*d_window);
     }
 
+    bool FalagardTitlebar::isGeometryGenerationThreadSafe() const
+    {
+        return isLookGeometryGenerationThreadSafe();
+    }
+
 } // End of  CEGUI namespace section
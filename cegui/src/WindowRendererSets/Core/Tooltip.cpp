@@ -39,6 +39,12 @@ void FalagardTooltip::createRenderGeometry()
     imagery.render(*d_window);
 }
 
+//----------------------------------------------------------------------------//
+bool FalagardTooltip::isGeometryGenerationThreadSafe() const
+{
+    return isLookGeometryGenerationThreadSafe();
+}
+
 //----------------------------------------------------------------------------//
 Sizef FalagardTooltip::getContentSize() const
 {
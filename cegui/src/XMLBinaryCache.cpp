@@ -0,0 +1,493 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/Logger.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+/*
+    Blob layout (native byte order, every field 4 byte aligned):
+
+        BlobHeader
+        string table    - stringCount x { uint32 offset, uint32 length }
+        event stream    - eventWordCount x uint32
+        string data     - UTF-8 bytes referenced by the string table
+
+    Event stream encoding (all values are uint32 words):
+
+        ElementStart    name attrCount { attrName attrValue } x attrCount
+        ElementEnd      name
+        Text            text
+
+    where every name / value / text word is an index into the string table.
+*/
+
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+namespace
+{
+const char BlobMagic[8] = { 'C', 'E', 'G', 'U', 'I', 'X', 'B', 'C' };
+const std::uint32_t ByteOrderMark = 0x01020304;
+
+struct BlobHeader
+{
+    char magic[8];
+    std::uint32_t formatVersion;
+    std::uint32_t byteOrderMark;
+    std::uint64_t sourceHash;
+    std::uint32_t stringCount;
+    std::uint32_t stringTableOffset;
+    std::uint32_t eventWordCount;
+    std::uint32_t eventsOffset;
+    std::uint32_t stringDataOffset;
+    std::uint32_t stringDataSize;
+};
+
+enum class BlobEvent : std::uint32_t
+{
+    ElementStart = 1,
+    ElementEnd = 2,
+    Text = 3
+};
+
+//----------------------------------------------------------------------------//
+std::string toUtf8(const String& str)
+{
+#if CEGUI_STRING_CLASS == CEGUI_STRING_CLASS_UTF_32
+    return String::convertUtf32ToUtf8(str.getString());
+#else
+    return std::string(str.c_str(), str.size());
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Checks the event stream references only valid strings and is well formed,
+// so that replay can not fail half way through feeding the handler.
+bool validateEvents(const std::uint32_t* events, std::uint32_t count,
+                    std::uint32_t stringCount)
+{
+    std::uint32_t i = 0;
+    while (i < count)
+    {
+        const BlobEvent type = static_cast<BlobEvent>(events[i++]);
+        std::uint32_t operands;
+
+        if (type == BlobEvent::ElementStart)
+        {
+            if (count - i < 2)
+                return false;
+
+            operands = 2 + 2 * events[i + 1];
+        }
+        else if (type == BlobEvent::ElementEnd || type == BlobEvent::Text)
+            operands = 1;
+        else
+            return false;
+
+        if (count - i < operands)
+            return false;
+
+        for (std::uint32_t j = 0; j < operands; ++j)
+        {
+            // skip the attribute count word of element start events
+            if (type == BlobEvent::ElementStart && j == 1)
+                continue;
+
+            if (events[i + j] >= stringCount)
+                return false;
+        }
+
+        i += operands;
+    }
+
+    return true;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+const std::uint32_t XMLBinaryCache::FormatVersion = 1;
+const String XMLBinaryCache::FileExtension(".cxb");
+
+//----------------------------------------------------------------------------//
+XMLBinaryCache::XMLBinaryCache() :
+    d_writeEnabled(true)
+{
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::setCacheDirectory(const String& directory)
+{
+    d_cacheDirectory = directory;
+
+    if (!d_cacheDirectory.empty() &&
+        d_cacheDirectory[d_cacheDirectory.length() - 1] != '/' &&
+        d_cacheDirectory[d_cacheDirectory.length() - 1] != '\\')
+    {
+        d_cacheDirectory += '/';
+    }
+}
+
+//----------------------------------------------------------------------------//
+String XMLBinaryCache::getCacheFileName(const String& filename,
+                                        const String& resourceGroup)
+{
+    String name(resourceGroup.empty() ? String("default") : resourceGroup);
+    name += '.';
+    name += filename;
+
+    for (size_t i = 0; i < name.length(); ++i)
+    {
+        if (name[i] == '/' || name[i] == '\\' || name[i] == ':')
+            name[i] = '_';
+    }
+
+    return name + FileExtension;
+}
+
+//----------------------------------------------------------------------------//
+String XMLBinaryCache::getCacheFilePath(const String& filename,
+                                        const String& resourceGroup) const
+{
+    return d_cacheDirectory + getCacheFileName(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+std::uint64_t XMLBinaryCache::hashSource(const std::uint8_t* data, size_t size)
+{
+    // 64 bit FNV-1a
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::addPreparedBlob(const String& filename,
+                                     const String& resourceGroup,
+                                     std::vector<std::uint8_t> blob)
+{
+    d_preparedBlobs[getCacheFileName(filename, resourceGroup)] = std::move(blob);
+}
+
+//----------------------------------------------------------------------------//
+bool XMLBinaryCache::replay(XMLHandler& handler, const String& filename,
+                            const String& resourceGroup,
+                            const std::uint8_t* source, size_t sourceSize) const
+{
+    if (!isEnabled())
+        return false;
+
+    if (!d_preparedBlobs.empty())
+    {
+        const PreparedBlobMap::const_iterator prepared(
+            d_preparedBlobs.find(getCacheFileName(filename, resourceGroup)));
+
+        if (prepared != d_preparedBlobs.end() &&
+            replayBlob(handler, prepared->second.data(), prepared->second.size(),
+                       hashSource(source, sourceSize)))
+        {
+            return true;
+        }
+    }
+
+    std::ifstream file(toUtf8(getCacheFilePath(filename, resourceGroup)).c_str(),
+                       std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+
+    const std::streamoff size = file.tellg();
+    if (size < static_cast<std::streamoff>(sizeof(BlobHeader)))
+        return false;
+
+    // use 32 bit storage so that the blob is suitably aligned
+    std::vector<std::uint32_t, TrackedAllocator<std::uint32_t, MemoryTag::XML>> blob(
+        (static_cast<size_t>(size) + 3) / 4);
+    file.seekg(0, std::ios::beg);
+    if (!file.read(reinterpret_cast<char*>(blob.data()), size))
+        return false;
+
+    return replayBlob(handler, reinterpret_cast<const std::uint8_t*>(blob.data()),
+                      static_cast<size_t>(size), hashSource(source, sourceSize));
+}
+
+//----------------------------------------------------------------------------//
+bool XMLBinaryCache::replayBlob(XMLHandler& handler, const std::uint8_t* blob,
+                                size_t blobSize, std::uint64_t sourceHash)
+{
+    if (blobSize < sizeof(BlobHeader))
+        return false;
+
+    const BlobHeader& header = *reinterpret_cast<const BlobHeader*>(blob);
+
+    if (std::memcmp(header.magic, BlobMagic, sizeof(BlobMagic)) != 0 ||
+        header.formatVersion != FormatVersion ||
+        header.byteOrderMark != ByteOrderMark ||
+        header.sourceHash != sourceHash)
+    {
+        return false;
+    }
+
+    // bounds checks for all sections
+    const std::uint64_t stringTableEnd = header.stringTableOffset +
+        std::uint64_t(header.stringCount) * 2 * sizeof(std::uint32_t);
+    const std::uint64_t eventsEnd = header.eventsOffset +
+        std::uint64_t(header.eventWordCount) * sizeof(std::uint32_t);
+    const std::uint64_t stringDataEnd =
+        std::uint64_t(header.stringDataOffset) + header.stringDataSize;
+
+    if (stringTableEnd > blobSize || eventsEnd > blobSize ||
+        stringDataEnd > blobSize || header.stringTableOffset % 4 != 0 ||
+        header.eventsOffset % 4 != 0)
+    {
+        return false;
+    }
+
+    const std::uint32_t* stringTable = reinterpret_cast<const std::uint32_t*>(
+        blob + header.stringTableOffset);
+    const std::uint32_t* events = reinterpret_cast<const std::uint32_t*>(
+        blob + header.eventsOffset);
+    const char* stringData =
+        reinterpret_cast<const char*>(blob + header.stringDataOffset);
+
+    if (!validateEvents(events, header.eventWordCount, header.stringCount))
+        return false;
+
+    std::vector<String> strings;
+    strings.reserve(header.stringCount);
+    for (std::uint32_t i = 0; i < header.stringCount; ++i)
+    {
+        const std::uint32_t offset = stringTable[i * 2];
+        const std::uint32_t length = stringTable[i * 2 + 1];
+
+        if (std::uint64_t(offset) + length > header.stringDataSize)
+            return false;
+
+        strings.push_back(String(stringData + offset, length));
+    }
+
+    XMLAttributes attributes;
+    std::uint32_t i = 0;
+    while (i < header.eventWordCount)
+    {
+        switch (static_cast<BlobEvent>(events[i++]))
+        {
+        case BlobEvent::ElementStart:
+        {
+            const String& element = strings[events[i++]];
+            const std::uint32_t attrCount = events[i++];
+
+            attributes = XMLAttributes();
+            for (std::uint32_t a = 0; a < attrCount; ++a, i += 2)
+                attributes.add(strings[events[i]], strings[events[i + 1]]);
+
+            handler.elementStart(element, attributes);
+            break;
+        }
+
+        case BlobEvent::ElementEnd:
+            handler.elementEnd(strings[events[i++]]);
+            break;
+
+        case BlobEvent::Text:
+            handler.text(strings[events[i++]]);
+            break;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::store(const String& filename, const String& resourceGroup,
+                           const std::vector<std::uint8_t>& blob) const
+{
+    if (!isEnabled() || !d_writeEnabled)
+        return;
+
+    // write to a temporary first so that a concurrently starting process
+    // never sees a partially written blob.
+    const std::string path(toUtf8(getCacheFilePath(filename, resourceGroup)));
+    const std::string tempPath(path + ".tmp");
+
+    {
+        std::ofstream file(tempPath.c_str(), std::ios::binary | std::ios::trunc);
+        if (file)
+            file.write(reinterpret_cast<const char*>(blob.data()), blob.size());
+
+        if (!file)
+        {
+            Logger::getSingleton().logEvent("XMLBinaryCache::store: Unable to "
+                "write compiled XML to '" + String(tempPath) + "'.",
+                LoggingLevel::Warning);
+            return;
+        }
+    }
+
+    std::remove(path.c_str());
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        Logger::getSingleton().logEvent("XMLBinaryCache::store: Unable to "
+            "write compiled XML to '" + String(path) + "'.",
+            LoggingLevel::Warning);
+    }
+}
+
+//----------------------------------------------------------------------------//
+XMLBinaryCache::Recorder::Recorder(XMLHandler* target, std::uint64_t sourceHash) :
+    d_target(target),
+    d_sourceHash(sourceHash)
+{
+}
+
+//----------------------------------------------------------------------------//
+const String& XMLBinaryCache::Recorder::getSchemaName() const
+{
+    return d_target ? d_target->getSchemaName() : XMLHandler::getSchemaName();
+}
+
+//----------------------------------------------------------------------------//
+const String& XMLBinaryCache::Recorder::getDefaultResourceGroup() const
+{
+    static const String empty;
+    return d_target ? d_target->getDefaultResourceGroup() : empty;
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::Recorder::elementStart(const String& element,
+                                            const XMLAttributes& attributes)
+{
+    d_events.push_back(static_cast<std::uint32_t>(BlobEvent::ElementStart));
+    d_events.push_back(addString(element));
+
+    const size_t count = attributes.getCount();
+    d_events.push_back(static_cast<std::uint32_t>(count));
+    for (size_t i = 0; i < count; ++i)
+    {
+        d_events.push_back(addString(attributes.getName(i)));
+        d_events.push_back(addString(attributes.getValue(i)));
+    }
+
+    if (d_target)
+        d_target->elementStart(element, attributes);
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::Recorder::elementEnd(const String& element)
+{
+    d_events.push_back(static_cast<std::uint32_t>(BlobEvent::ElementEnd));
+    d_events.push_back(addString(element));
+
+    if (d_target)
+        d_target->elementEnd(element);
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::Recorder::text(const String& text)
+{
+    d_events.push_back(static_cast<std::uint32_t>(BlobEvent::Text));
+    d_events.push_back(addString(text));
+
+    if (d_target)
+        d_target->text(text);
+}
+
+//----------------------------------------------------------------------------//
+std::uint32_t XMLBinaryCache::Recorder::addString(const String& str)
+{
+    std::string utf8(toUtf8(str));
+
+    const auto it = d_stringIndices.find(utf8);
+    if (it != d_stringIndices.end())
+        return it->second;
+
+    const std::uint32_t index = static_cast<std::uint32_t>(d_strings.size());
+    d_stringIndices.emplace(utf8, index);
+    d_strings.push_back(std::move(utf8));
+    return index;
+}
+
+//----------------------------------------------------------------------------//
+std::vector<std::uint8_t> XMLBinaryCache::Recorder::getBlob() const
+{
+    BlobHeader header;
+    std::memcpy(header.magic, BlobMagic, sizeof(BlobMagic));
+    header.formatVersion = FormatVersion;
+    header.byteOrderMark = ByteOrderMark;
+    header.sourceHash = d_sourceHash;
+    header.stringCount = static_cast<std::uint32_t>(d_strings.size());
+    header.stringTableOffset = sizeof(BlobHeader);
+    header.eventWordCount = static_cast<std::uint32_t>(d_events.size());
+    header.eventsOffset = header.stringTableOffset +
+        header.stringCount * 2 * sizeof(std::uint32_t);
+    header.stringDataOffset = header.eventsOffset +
+        header.eventWordCount * sizeof(std::uint32_t);
+
+    std::vector<std::uint32_t> stringTable;
+    stringTable.reserve(d_strings.size() * 2);
+    std::uint32_t stringDataSize = 0;
+    for (const auto& str : d_strings)
+    {
+        stringTable.push_back(stringDataSize);
+        stringTable.push_back(static_cast<std::uint32_t>(str.size()));
+        stringDataSize += static_cast<std::uint32_t>(str.size());
+    }
+    header.stringDataSize = stringDataSize;
+
+    std::vector<std::uint8_t> blob(header.stringDataOffset + stringDataSize);
+    std::memcpy(blob.data(), &header, sizeof(BlobHeader));
+
+    if (!stringTable.empty())
+        std::memcpy(blob.data() + header.stringTableOffset, stringTable.data(),
+                    stringTable.size() * sizeof(std::uint32_t));
+
+    if (!d_events.empty())
+        std::memcpy(blob.data() + header.eventsOffset, d_events.data(),
+                    d_events.size() * sizeof(std::uint32_t));
+
+    std::uint8_t* stringData = blob.data() + header.stringDataOffset;
+    for (const auto& str : d_strings)
+    {
+        std::memcpy(stringData, str.data(), str.size());
+        stringData += str.size();
+    }
+
+    return blob;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
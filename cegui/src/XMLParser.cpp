@@ -25,6 +25,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/XMLParser.h"
+#include "CEGUI/XMLBinaryCache.h"
 #include "CEGUI/DataContainer.h"
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
@@ -61,8 +62,29 @@ namespace CEGUI
 
         try
         {
-            // The actual parsing action (this is overridden and depends on the specific parser)
-            parseXML(handler, rawXMLData, schemaName, allowXmlValidation);
+            const XMLBinaryCache& cache = System::getSingleton().getXMLBinaryCache();
+
+            if (cache.replay(handler, filename, resourceGroup,
+                             rawXMLData.getDataPtr(), rawXMLData.getSize()))
+            {
+                // handled from a compiled copy
+            }
+            else if (!cache.isEnabled())
+            {
+                // The actual parsing action (this is overridden and depends on the specific parser)
+                parseXML(handler, rawXMLData, schemaName, allowXmlValidation);
+            }
+            else
+            {
+                // No usable compiled copy; parse normally and record the
+                // element stream so that the next load can skip the parser.
+                XMLBinaryCache::Recorder recorder(&handler,
+                    XMLBinaryCache::hashSource(rawXMLData.getDataPtr(),
+                                               rawXMLData.getSize()));
+
+                parseXML(recorder, rawXMLData, schemaName, allowXmlValidation);
+                cache.store(filename, resourceGroup, recorder.getBlob());
+            }
         }
         catch (const Exception&)
         {
@@ -128,4 +150,9 @@ namespace CEGUI
         return d_identifierString;
     }
 
+    bool XMLParser::isThreadSafe() const
+    {
+        return false;
+    }
+
 } // End of  CEGUI namespace section
@@ -77,6 +77,12 @@ void ExpatParser::parseXML(XMLHandler& handler, const RawDataContainer& source,
     XML_ParserFree(parser);
 }
 
+bool ExpatParser::isThreadSafe() const
+{
+    // every call uses its own XML_Parser
+    return true;
+}
+
 bool ExpatParser::initialiseImpl(void)
 {
     return true;
@@ -88,6 +88,13 @@ void PugiXMLParser::parseXML(XMLHandler& handler,
         processNode(handler, doc.document_element());
 }
 
+//----------------------------------------------------------------------------//
+bool PugiXMLParser::isThreadSafe() const
+{
+    // every call uses its own xml_document
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 bool PugiXMLParser::initialiseImpl()
 {
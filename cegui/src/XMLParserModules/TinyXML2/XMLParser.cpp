@@ -93,6 +93,12 @@ namespace CEGUI
         handler.elementEnd(element->Value());
     }
     
+    bool TinyXML2Parser::isThreadSafe() const
+    {
+        // every call uses its own XMLDocument
+        return true;
+    }
+
     bool TinyXML2Parser::initialiseImpl()
     {
         return true;
@@ -64,6 +64,12 @@ bool BaseDim::handleFontRenderSizeChange(Window& /*window*/,
     return false;
 }
 
+//----------------------------------------------------------------------------//
+bool BaseDim::usesFont() const
+{
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 UDim BaseDim::getLowerBoundAsUDim(const Window& wnd, DimensionType /*type*/) const
 {
@@ -168,6 +174,12 @@ bool OperatorDim::handleFontRenderSizeChange(Window& window, const Font* font) c
         (d_right && d_right->handleFontRenderSizeChange(window, font));
 }
 
+//----------------------------------------------------------------------------//
+bool OperatorDim::usesFont() const
+{
+    return (d_left && d_left->usesFont()) || (d_right && d_right->usesFont());
+}
+
 //----------------------------------------------------------------------------//
 float OperatorDim::getValue(const Window& wnd) const
 {
@@ -824,6 +836,12 @@ bool FontDim::handleFontRenderSizeChange(Window& window,
     return font == getFontObject(window);
 }
 
+//----------------------------------------------------------------------------//
+bool FontDim::usesFont() const
+{
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 //----------------------------------------------------------------------------//
@@ -1024,6 +1042,12 @@ bool Dimension::handleFontRenderSizeChange(Window& window,
                      false;
 }
 
+//----------------------------------------------------------------------------//
+bool Dimension::usesFont() const
+{
+    return d_value && d_value->usesFont();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 //----------------------------------------------------------------------------//
@@ -1374,6 +1398,28 @@ bool ComponentArea::handleFontRenderSizeChange(Window& window,
     return result;
 }
 
+//----------------------------------------------------------------------------//
+bool ComponentArea::usesFont() const
+{
+    if (isAreaFetchedFromProperty())
+        return false;
+
+    if (isAreaFetchedFromNamedArea())
+    {
+        // when the source is missing there is no telling, so assume it does
+        const WidgetLookManager& manager = WidgetLookManager::getSingleton();
+        if (!manager.isWidgetLookAvailable(d_namedAreaSourceLook))
+            return true;
+
+        const WidgetLookFeel& look = manager.getWidgetLook(d_namedAreaSourceLook);
+        return !look.isNamedAreaPresent(d_namedSource) ||
+               look.getNamedArea(d_namedSource).getArea().usesFont();
+    }
+
+    return d_left.usesFont() || d_top.usesFont() ||
+           d_right_or_width.usesFont() || d_bottom_or_height.usesFont();
+}
+
 //----------------------------------------------------------------------------//
 UDim ComponentArea::getWidthLowerBoundAsFuncOfWindowWidth(const Window& wnd) const
 {
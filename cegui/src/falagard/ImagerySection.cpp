@@ -28,6 +28,7 @@
 #include "CEGUI/falagard/XMLHandler.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/FrameProfiler.h"
 #include <iostream>
 #include <limits>
 #include <cstring>
@@ -47,6 +48,8 @@ namespace CEGUI
 
     void ImagerySection::render(Window& srcWindow, const CEGUI::ColourRect* modColours, const Rectf* clipper) const
     {
+        CEGUI_PROFILE_SCOPE_DETAIL("ImagerySection::render", d_name);
+
         // decide what to do as far as colours go
         ColourRect finalCols;
         initMasterColourRect(srcWindow, finalCols);
@@ -68,6 +71,8 @@ namespace CEGUI
 
     void ImagerySection::render(Window& srcWindow, const Rectf& baseRect, const CEGUI::ColourRect* modColours, const Rectf* clipper) const
     {
+        CEGUI_PROFILE_SCOPE_DETAIL("ImagerySection::render", d_name);
+
         // decide what to do as far as colours go
         ColourRect finalCols;
         initMasterColourRect(srcWindow, finalCols);
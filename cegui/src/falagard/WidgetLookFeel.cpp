@@ -523,6 +523,53 @@ bool WidgetLookFeel::isAnimationPresent(const String& name, bool includeInherite
     return WidgetLookManager::getSingleton().getWidgetLook(d_inheritedLookName).isAnimationPresent(name, true);
 }
 
+//---------------------------------------------------------------------------//
+bool WidgetLookFeel::isGeometryGenerationThreadSafe() const
+{
+    const WidgetLookManager& manager = WidgetLookManager::getSingleton();
+
+    for (const auto& pair : d_stateImageryMap)
+    {
+        for (const auto& layer : pair.second.getLayerSpecifications())
+        {
+            for (const auto& section : layer.getSectionSpecifications())
+            {
+                // a missing look or section would be reported while rendering
+                if (!manager.isWidgetLookAvailable(section.getOwnerWidgetLookFeel()))
+                    return false;
+
+                const WidgetLookFeel& owner = manager.getWidgetLook(section.getOwnerWidgetLookFeel());
+                if (!owner.isImagerySectionPresent(section.getSectionName()))
+                    return false;
+
+                // text and font metrics may make fonts load glyphs
+                const ImagerySection& imagery = owner.getImagerySection(section.getSectionName());
+                if (!imagery.getTextComponents().empty())
+                    return false;
+
+                for (const auto& image : imagery.getImageryComponents())
+                    if (image.getComponentArea().usesFont())
+                        return false;
+
+                for (const auto& frame : imagery.getFrameComponents())
+                    if (frame.getComponentArea().usesFont())
+                        return false;
+            }
+        }
+    }
+
+    // window renderers read named areas while rendering
+    for (const auto& pair : d_namedAreaMap)
+        if (pair.second.getArea().usesFont())
+            return false;
+
+    if (d_inheritedLookName.empty())
+        return true;
+
+    return manager.isWidgetLookAvailable(d_inheritedLookName) &&
+           manager.getWidgetLook(d_inheritedLookName).isGeometryGenerationThreadSafe();
+}
+
 //---------------------------------------------------------------------------//
 void WidgetLookFeel::addNamedArea(const NamedArea& area)
 {
@@ -153,8 +153,26 @@ namespace CEGUI
             "WidgetLook '" + widget + "' does not exist.");
     }
 
+    bool WidgetLookManager::isGeometryGenerationThreadSafe(const String& widget) const
+    {
+        auto cached = d_geometryGenerationThreadSafety.find(widget);
+        if (cached != d_geometryGenerationThreadSafety.end())
+            return cached->second;
+
+        // the result depends on other looks, so it is only kept for looks
+        // that exist; it is thrown away whenever any look changes.
+        if (!isWidgetLookAvailable(widget))
+            return false;
+
+        const bool threadSafe = getWidgetLook(widget).isGeometryGenerationThreadSafe();
+        d_geometryGenerationThreadSafety.emplace(widget, threadSafe);
+        return threadSafe;
+    }
+
     void WidgetLookManager::eraseWidgetLook(const String& widget)
     {
+        d_geometryGenerationThreadSafety.clear();
+
         WidgetLookList::iterator wlf = d_widgetLooks.find(widget);
         if (wlf != d_widgetLooks.end())
         {
@@ -171,6 +189,7 @@ namespace CEGUI
     void WidgetLookManager::eraseAllWidgetLooks()
     {
         d_widgetLooks.clear();
+        d_geometryGenerationThreadSafety.clear();
     }
 
     void WidgetLookManager::addWidgetLook(WidgetLookFeel&& look)
@@ -182,6 +201,7 @@ namespace CEGUI
         }
 
         d_widgetLooks.emplace(look.getName(), std::move(look));
+        d_geometryGenerationThreadSafety.clear();
     }
 
     void WidgetLookManager::writeWidgetLookToStream(const String& name, OutStream& out_stream) const
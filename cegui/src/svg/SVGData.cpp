@@ -99,6 +99,7 @@ SVGData::SVGData(const String& name)
     : d_name(name)
     , d_width(0.f)
     , d_height(0.f)
+    , d_revision(0)
 {
 }
 
@@ -106,7 +107,8 @@ SVGData::SVGData(const String& name)
 SVGData::SVGData(const String& name,
                  const String& filename,
                  const String& resourceGroup) :
-    d_name(name)
+    d_name(name),
+    d_revision(0)
 {
     loadFromFile(filename, resourceGroup);
 }
@@ -136,6 +138,7 @@ void SVGData::loadFromFile(const String& file_name,
 void SVGData::addShape(SVGBasicShape* svg_shape)
 {
     d_svgBasicShapes.push_back(svg_shape);
+    ++d_revision;
 }
 
 //----------------------------------------------------------------------------//
@@ -145,6 +148,7 @@ void SVGData::destroyShapes()
         delete shape;
 
     d_svgBasicShapes.clear();
+    ++d_revision;
 }
 
 //----------------------------------------------------------------------------//
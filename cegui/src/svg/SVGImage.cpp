@@ -31,6 +31,12 @@
 #include "CEGUI/svg/SVGBasicShape.h"
 #include "CEGUI/svg/SVGDataManager.h"
 #include "CEGUI/XMLAttributes.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace CEGUI
 {
@@ -47,11 +53,33 @@ const String ImageAutoScaledAttribute( "autoScaled" );
 const String ImageNativeHorzResAttribute( "nativeHorzRes" );
 const String ImageNativeVertResAttribute( "nativeVertRes" );
 
+const int SVGImage::ScaleBucketsPerOctave(8);
+const size_t SVGImage::MaxCachedTessellations(4);
+
+namespace
+{
+//----------------------------------------------------------------------------//
+int getScaleBucket(float scale)
+{
+    return static_cast<int>(std::lround(
+        std::log2(std::max(scale, 1.0e-4f)) * SVGImage::ScaleBucketsPerOctave));
+}
+
+//----------------------------------------------------------------------------//
+float getBucketScale(int bucket)
+{
+    return std::exp2(static_cast<float>(bucket) / SVGImage::ScaleBucketsPerOctave);
+}
+
+}
+
 //----------------------------------------------------------------------------//
 SVGImage::SVGImage(const String& name) :
     Image(name),
     d_svgData(nullptr),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_tessellatedData(nullptr),
+    d_tessellatedRevision(0)
 {
 }
 
@@ -64,7 +92,9 @@ SVGImage::SVGImage(const String& name, SVGData& svg_data) :
           AutoScaledMode::Disabled,
           Sizef(640, 480)),
     d_svgData(&svg_data),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_tessellatedData(nullptr),
+    d_tessellatedRevision(0)
 {
 }
 
@@ -82,7 +112,9 @@ SVGImage::SVGImage(const XMLAttributes& attributes) :
                 static_cast<float>(attributes.getValueAsInteger(ImageNativeVertResAttribute, 480)))),
     d_svgData(&SVGDataManager::getSingleton().getSVGData(
               attributes.getValueAsString(ImageSVGDataAttribute))),
-    d_useGeometryAntialiasing(true)
+    d_useGeometryAntialiasing(true),
+    d_tessellatedData(nullptr),
+    d_tessellatedRevision(0)
 {
 }
 
@@ -90,6 +122,7 @@ SVGImage::SVGImage(const XMLAttributes& attributes) :
 void SVGImage::setSVGData(SVGData* svg_Data)
 {
     d_svgData = svg_Data;
+    invalidateGeometryCache();
 }
 
 //----------------------------------------------------------------------------//
@@ -102,28 +135,189 @@ SVGData* SVGImage::getSVGData()
 void SVGImage::createRenderGeometry(std::vector<GeometryBuffer*>& out,
     const ImageRenderSettings& renderSettings, size_t /*canCombineFromIdx*/) const
 {
-    //!!!FIXME: not used for anything but early exit! Is it intended?!
-    {
-        Rectf dest = renderSettings.d_destArea;
-        dest.offset(d_scaledOffset);
+    if (!d_svgData || d_imageArea.empty())
+        return;
 
-        if (renderSettings.d_clipArea)
-            dest = dest.getIntersection(*renderSettings.d_clipArea);
+    Rectf dest = renderSettings.d_destArea;
+    dest.offset(d_scaledOffset);
+
+    if (renderSettings.d_alignToPixels)
+        dest.round();
 
-        if (renderSettings.d_alignToPixels)
-            dest.round();
+    {
+        Rectf visible = dest;
+        if (renderSettings.d_clipArea)
+            visible = visible.getIntersection(*renderSettings.d_clipArea);
 
-        if (dest.empty())
+        if (visible.empty())
             return;
     }
 
     const glm::vec2 scaleImgToDest(renderSettings.d_destArea.getWidth() / d_imageArea.getWidth(),
         renderSettings.d_destArea.getHeight() / d_imageArea.getHeight());
-    const SVGImageRenderSettings svgSettings(renderSettings, scaleImgToDest, d_useGeometryAntialiasing);
 
-    // TODO: can use single buffer or at least combine something?
+    const std::shared_ptr<const Tessellation> tessellation =
+        getTessellation(scaleImgToDest, d_useGeometryAntialiasing);
+
+    // The cached geometry is in SVG document space, so the destination
+    // position and the exact scale are applied by the GeometryBuffer
+    const glm::mat4 transformation =
+        glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(dest.d_min, 0.0f)),
+                   glm::vec3(scaleImgToDest, 1.0f)) *
+        glm::translate(glm::mat4(1.0f), glm::vec3(-d_imageArea.d_min, 0.0f));
+
+    const bool modulateColours = renderSettings.d_multiplyColours != ColourRect(0xFFFFFFFF);
+    std::vector<float> modulatedVertexData;
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    for (const TessellationBatch& batch : tessellation->d_batches)
+    {
+        GeometryBuffer& buffer = renderer.createGeometryBufferColoured();
+
+        if (renderSettings.d_clipArea)
+        {
+            buffer.setClippingActive(true);
+            buffer.setClippingRegion(*renderSettings.d_clipArea);
+        }
+        else
+            buffer.setClippingActive(false);
+
+        buffer.setCustomTransform(transformation);
+        buffer.setAlpha(renderSettings.d_alpha);
+        buffer.setBlendMode(batch.d_blendMode);
+        buffer.setStencilRenderingActive(batch.d_fillRule);
+        buffer.setStencilPostRenderingVertexCount(batch.d_postStencilVertexCount);
+
+        // coloured vertices consist of a position followed by the colour
+        if (modulateColours && batch.d_vertexStride == 7)
+        {
+            modulatedVertexData = batch.d_vertexData;
+            for (size_t i = 0; i < modulatedVertexData.size(); i += 7)
+            {
+                float* vertex = &modulatedVertexData[i];
+                const Colour colour = renderSettings.d_multiplyColours.getColourAtPoint(
+                    (vertex[0] - d_imageArea.left()) / d_imageArea.getWidth(),
+                    (vertex[1] - d_imageArea.top()) / d_imageArea.getHeight());
+
+                vertex[3] *= colour.getRed();
+                vertex[4] *= colour.getGreen();
+                vertex[5] *= colour.getBlue();
+                vertex[6] *= colour.getAlpha();
+            }
+
+            buffer.appendGeometry(modulatedVertexData.data(), modulatedVertexData.size());
+        }
+        else
+            buffer.appendGeometry(batch.d_vertexData.data(), batch.d_vertexData.size());
+
+        out.push_back(&buffer);
+    }
+}
+
+//----------------------------------------------------------------------------//
+std::shared_ptr<const SVGImage::Tessellation> SVGImage::getTessellation(
+    const glm::vec2& scale, bool anti_aliasing) const
+{
+    std::lock_guard<std::mutex> lock(d_tessellationMutex);
+
+    if (d_tessellatedData != d_svgData ||
+        d_tessellatedRevision != d_svgData->getRevision())
+    {
+        d_tessellations.clear();
+        d_tessellatedData = d_svgData;
+        d_tessellatedRevision = d_svgData->getRevision();
+    }
+
+    const int bucketX = getScaleBucket(scale.x);
+    const int bucketY = getScaleBucket(scale.y);
+
+    auto it = std::find_if(d_tessellations.begin(), d_tessellations.end(),
+        [=](const std::shared_ptr<const Tessellation>& tessellation)
+        {
+            return tessellation->d_scaleBucketX == bucketX &&
+                   tessellation->d_scaleBucketY == bucketY &&
+                   tessellation->d_antiAliasing == anti_aliasing;
+        });
+
+    if (it != d_tessellations.end())
+    {
+        std::rotate(d_tessellations.begin(), it, it + 1);
+        return d_tessellations.front();
+    }
+
+    if (d_tessellations.size() >= MaxCachedTessellations)
+        d_tessellations.pop_back();
+
+    std::shared_ptr<Tessellation> tessellation(new Tessellation());
+    tessellation->d_scaleBucketX = bucketX;
+    tessellation->d_scaleBucketY = bucketY;
+    tessellation->d_antiAliasing = anti_aliasing;
+    tessellate(*tessellation);
+
+    d_tessellations.insert(d_tessellations.begin(), tessellation);
+    return tessellation;
+}
+
+//----------------------------------------------------------------------------//
+void SVGImage::tessellate(Tessellation& tessellation) const
+{
+    // The curve tessellation and the anti-aliasing fringe depend on the scale,
+    // so shapes are tessellated for the scale the bucket represents
+    const SVGImageRenderSettings svgSettings(
+        ImageRenderSettings(Rectf(glm::vec2(0.0f, 0.0f), d_imageArea.getSize())),
+        glm::vec2(getBucketScale(tessellation.d_scaleBucketX),
+                  getBucketScale(tessellation.d_scaleBucketY)),
+        tessellation.d_antiAliasing);
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    std::vector<GeometryBuffer*> buffers;
+
     for (const SVGBasicShape* currentShape : d_svgData->getShapes())
-        currentShape->createRenderGeometry(out, svgSettings);
+        currentShape->createRenderGeometry(buffers, svgSettings);
+
+    for (GeometryBuffer* buffer : buffers)
+    {
+        const GeometryBuffer::VertexData& vertexData = buffer->getVertexData();
+        const int stride = buffer->getVertexAttributeElementCount();
+
+        if (!vertexData.empty() && stride >= 3)
+        {
+            // stencilled fills have to stay separate since the stencil pass
+            // covers everything in front of the post stencil vertices
+            const bool canAppend = !tessellation.d_batches.empty() &&
+                tessellation.d_batches.back().d_fillRule == PolygonFillRule::NoFilling &&
+                buffer->getStencilRenderingFillRule() == PolygonFillRule::NoFilling &&
+                tessellation.d_batches.back().d_blendMode == buffer->getBlendMode() &&
+                tessellation.d_batches.back().d_vertexStride == stride;
+
+            if (!canAppend)
+            {
+                TessellationBatch batch;
+                batch.d_vertexStride = stride;
+                batch.d_fillRule = buffer->getStencilRenderingFillRule();
+                batch.d_postStencilVertexCount = buffer->getStencilPostRenderingVertexCount();
+                batch.d_blendMode = buffer->getBlendMode();
+                tessellation.d_batches.push_back(std::move(batch));
+            }
+
+            // bake the shape's transformation into the vertex positions
+            std::vector<float>& batchData = tessellation.d_batches.back().d_vertexData;
+            const size_t first = batchData.size();
+            batchData.insert(batchData.end(), vertexData.begin(), vertexData.end());
+
+            const glm::mat4& shapeTransformation = buffer->getCustomTransform();
+            for (size_t i = first; i < batchData.size(); i += stride)
+            {
+                const glm::vec4 position = shapeTransformation *
+                    glm::vec4(batchData[i], batchData[i + 1], batchData[i + 2], 1.0f);
+                batchData[i] = position.x;
+                batchData[i + 1] = position.y;
+                batchData[i + 2] = position.z;
+            }
+        }
+
+        renderer.destroyGeometryBuffer(*buffer);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -138,6 +332,13 @@ void SVGImage::setUseGeometryAntialiasing(bool use_geometry_antialiasing)
     d_useGeometryAntialiasing = use_geometry_antialiasing;
 }
 
+//----------------------------------------------------------------------------//
+void SVGImage::invalidateGeometryCache()
+{
+    std::lock_guard<std::mutex> lock(d_tessellationMutex);
+    d_tessellations.clear();
+}
+
 //----------------------------------------------------------------------------//
 }
 
@@ -285,6 +285,7 @@ void Font::writeXMLToStream(XMLSerializer& xml_stream) const
 //----------------------------------------------------------------------------//
 void Font::onRenderSizeChanged(FontEventArgs& e)
 {
+    ++d_renderRevision;
     fireEvent(EventRenderSizeChanged, e, EventNamespace);
 }
 
@@ -168,7 +168,7 @@ void FreeTypeFont::resizeAndUpdateTexture(Texture* texture, uint32_t newSize)
             "resizing the glyph atlas");
 
     const uint32_t oldTexSize = d_lastTextureSize;
-    std::vector<argb_t> oldTextureData;
+    TextureBuffer oldTextureData;
     std::swap(oldTextureData, d_lastTextureBuffer);
 
     const float newTexSize = static_cast<float>(newSize);
@@ -178,13 +178,16 @@ void FreeTypeFont::resizeAndUpdateTexture(Texture* texture, uint32_t newSize)
     std::fill(d_lastTextureBuffer.begin(), d_lastTextureBuffer.end(), 0);
 
     // Copy our memory buffer into the texture and free it
-    updateTextureBufferSubImage(d_lastTextureBuffer.data(), oldTexSize, oldTexSize, oldTextureData);
+    updateTextureBufferSubImage(d_lastTextureBuffer.data(), oldTexSize, oldTexSize, oldTextureData.data());
 
     // TODO: use single channel 8-bit format! Blit/clear with GPU instead of loading from memory?
     texture->loadFromMemory(d_lastTextureBuffer.data(), Sizef(newTexSize, newTexSize), Texture::PixelFormat::Rgba);
 
     // Fix glyph texcoords in existing text geometry buffers
     System::getSingleton().getRenderer()->updateGeometryBufferTexCoords(texture, oldTexSize / newTexSize);
+
+    // Geometry kept outside of geometry buffers can't be fixed this way
+    ++d_renderRevision;
 }
 
 //----------------------------------------------------------------------------//
@@ -265,7 +268,7 @@ BitmapImage* FreeTypeFont::rasterise(const String& name, const FT_Bitmap& ft_bit
     // Update the cached texture data in memory
     size_t bufferDataGlyphPos = (glyphTexLine.d_lastYPos * d_lastTextureSize) + glyphTexLine.d_lastXPos;
     updateTextureBufferSubImage(d_lastTextureBuffer.data() + bufferDataGlyphPos,
-        glyphWidth, glyphHeight, subTextureData);
+        glyphWidth, glyphHeight, subTextureData.data());
 
     // Update the sub-image in the texture on the GPU
     const Rectf imageArea(
@@ -314,7 +317,7 @@ void FreeTypeFont::createGlyphAtlasTexture()
         texture_name, newTextureSize);
     d_glyphTextures.push_back(&texture);
 
-    d_lastTextureBuffer = std::vector<argb_t>(d_lastTextureSize * d_lastTextureSize, 0);
+    d_lastTextureBuffer = TextureBuffer(d_lastTextureSize * d_lastTextureSize, 0);
 
     // Clear texture
     // TODO: use single channel 8-bit format, clear with GPU clear op instead of loading from memory!
@@ -360,7 +363,7 @@ std::vector<argb_t> FreeTypeFont::createGlyphTextureData(const FT_Bitmap& glyphB
 
 //----------------------------------------------------------------------------//
 void FreeTypeFont::updateTextureBufferSubImage(argb_t* destTextureData, uint32_t bitmapWidth,
-    uint32_t bitmapHeight, const std::vector<argb_t>& subImageData) const
+    uint32_t bitmapHeight, const argb_t* subImageData) const
 {
     argb_t* curDestPixelLine = destTextureData;
 
@@ -384,6 +387,8 @@ void FreeTypeFont::free()
     if (!d_fontFace)
         return;
 
+    ++d_renderRevision;
+
     d_outlines.clear();
 
     for (const auto& glyph : d_glyphs)
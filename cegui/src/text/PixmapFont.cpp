@@ -104,6 +104,8 @@ void PixmapFont::reinit()
 //----------------------------------------------------------------------------//
 void PixmapFont::updateFont()
 {
+    ++d_renderRevision;
+
     const float factor = (d_autoScaled != AutoScaledMode::Disabled ? d_horzScaling : 1.0f) / d_origHorzScaling;
 
     d_ascender = 0;
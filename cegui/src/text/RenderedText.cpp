@@ -29,6 +29,11 @@
 #include "CEGUI/text/RenderedTextStyle.h"
 #include "CEGUI/text/TextParser.h"
 #include "CEGUI/text/TextUtils.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/FrameProfiler.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
 #ifdef CEGUI_BIDI_SUPPORT
 #include "CEGUI/text/BidiVisualMapping.h"
 #endif
@@ -271,6 +276,9 @@ static bool layoutParagraphWithRaqm(RenderedTextParagraph& out, const std::u32st
 bool RenderedText::renderText(const String& text, TextParser* parser,
     Font* defaultFont, DefaultParagraphDirection defaultParagraphDir)
 {
+    CEGUI_PROFILE_SCOPE("RenderedText::renderText");
+
+    d_geometryCacheValid = false;
     d_paragraphs.clear();
     d_elements.clear();
     d_defaultFont = defaultFont;
@@ -383,6 +391,8 @@ void RenderedText::updateDynamicObjectExtents(const Window* hostWindow)
     for (size_t i = 0; i < d_elements.size(); ++i)
     {
         const auto diff = d_elements[i]->updateMetrics(hostWindow);
+        if (diff.d_width || diff.d_height)
+            d_geometryCacheValid = false;
         if (diff.d_width)
             for (auto& p : d_paragraphs)
                 p.onElementWidthChanged(i, diff.d_width);
@@ -395,6 +405,8 @@ void RenderedText::updateDynamicObjectExtents(const Window* hostWindow)
 //----------------------------------------------------------------------------//
 bool RenderedText::updateFormatting(float areaWidth)
 {
+    CEGUI_PROFILE_SCOPE("RenderedText::updateFormatting");
+
     if (areaWidth < 0.f)
         areaWidth = 0.f;
 
@@ -407,6 +419,9 @@ bool RenderedText::updateFormatting(float areaWidth)
     bool fitsIntoAreaWidth = true;
     for (auto& p : d_paragraphs)
     {
+        if (areaWidthChanged || p.isFormattingDirty())
+            d_geometryCacheValid = false;
+
         if (areaWidthChanged)
             p.onAreaWidthChanged();
 
@@ -431,9 +446,168 @@ void RenderedText::createRenderGeometry(std::vector<GeometryBuffer*>& out,
     const glm::vec2& position, const ColourRect* modColours, const Rectf* clipRect,
     const SelectionInfo* selection) const
 {
+    CEGUI_PROFILE_SCOPE("RenderedText::createRenderGeometry");
+
+    // Selection changes too often to be worth caching, and may use a brush image
+    uint32_t revision = 0;
+    const bool cacheable = d_geometryCachingEnabled && !selection && getGeometryCacheRevision(revision);
+    if (cacheable && reuseCachedGeometry(out, position, modColours, clipRect, revision))
+        return;
+
+    const size_t firstBufferIdx = out.size();
+
     glm::vec2 penPosition = position;
     for (const auto& p : d_paragraphs)
         p.createRenderGeometry(out, penPosition, modColours, clipRect, selection, d_elements);
+
+    if (cacheable)
+        updateGeometryCache(out, firstBufferIdx, position, modColours, clipRect);
+}
+
+//----------------------------------------------------------------------------//
+void RenderedText::setGeometryCachingEnabled(bool enable)
+{
+    d_geometryCachingEnabled = enable;
+
+    if (!enable)
+    {
+        d_geometryCacheValid = false;
+        d_geometryCache.clear();
+        d_geometryCache.shrink_to_fit();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderedText::invalidateGeometryCache() const
+{
+    d_geometryCacheValid = false;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderedText::getGeometryCacheRevision(uint32_t& revision) const
+{
+    // Font revisions only ever grow, so their sum changes whenever any of them does.
+    // Glyphs may be loaded during rendering, so this must be evaluated after it.
+    revision = d_defaultFont ? d_defaultFont->getRenderRevision() : 0;
+    for (const auto& element : d_elements)
+    {
+        if (!element->isGeometryCacheable())
+            return false;
+
+        if (const Font* font = element->getFont())
+            revision += font->getRenderRevision();
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderedText::reuseCachedGeometry(std::vector<GeometryBuffer*>& out, const glm::vec2& position,
+    const ColourRect* modColours, const Rectf* clipRect, uint32_t revision) const
+{
+    if (!d_geometryCacheValid || d_geometryCacheRevision != revision)
+        return false;
+
+    if (d_geometryCacheHasColours != !!modColours || (modColours && d_geometryCacheColours != *modColours))
+        return false;
+
+    // Glyphs are aligned to pixels, so only a whole pixel offset gives the same result
+    const glm::vec2 offset = position - d_geometryCachePosition;
+    if (offset.x != std::floor(offset.x) || offset.y != std::floor(offset.y))
+        return false;
+
+    // Clipping is applied to vertices, so the clip rect must stay the same relative to the text
+    if (d_geometryCacheHasClipRect != !!clipRect)
+        return false;
+    if (clipRect)
+    {
+        Rectf relativeClipRect = *clipRect;
+        relativeClipRect.offset(-position);
+        if (relativeClipRect != d_geometryCacheClipRect)
+            return false;
+    }
+
+    // The kept vertices stay relative to d_geometryCachePosition, a move is a transform
+    const glm::mat4 moveTransform = glm::translate(glm::mat4(1.f), glm::vec3(offset, 0.f));
+
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    for (const auto& cached : d_geometryCache)
+    {
+        GeometryBuffer& buffer = cached.textured ?
+            renderer.createGeometryBufferTextured() :
+            renderer.createGeometryBufferColoured();
+
+        if (cached.textured)
+            buffer.setMainTexture(cached.texture);
+        buffer.setClippingActive(cached.clippingActive);
+        if (cached.clippingActive)
+        {
+            Rectf clippingRegion = cached.clippingRegion;
+            clippingRegion.offset(offset);
+            buffer.setClippingRegion(clippingRegion);
+        }
+        buffer.setCustomTransform(moveTransform * cached.customTransform);
+        buffer.setAlpha(cached.alpha);
+        buffer.setBlendMode(cached.blendMode);
+        if (cached.fillRule != PolygonFillRule::NoFilling)
+        {
+            buffer.setStencilRenderingActive(cached.fillRule);
+            buffer.setStencilPostRenderingVertexCount(cached.postStencilVertexCount);
+        }
+
+        buffer.appendGeometry(cached.vertexData.data(), cached.vertexData.size());
+        out.push_back(&buffer);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedText::updateGeometryCache(const std::vector<GeometryBuffer*>& out, size_t firstBufferIdx,
+    const glm::vec2& position, const ColourRect* modColours, const Rectf* clipRect) const
+{
+    d_geometryCacheValid = false;
+
+    // Buffers with effects may depend on more than their vertices and can't be recreated
+    for (size_t i = firstBufferIdx; i < out.size(); ++i)
+        if (out[i]->getRenderEffect())
+            return;
+
+    // Keep existing vectors to reuse their capacity
+    d_geometryCache.resize(out.size() - firstBufferIdx);
+    for (size_t i = firstBufferIdx; i < out.size(); ++i)
+    {
+        const GeometryBuffer& buffer = *out[i];
+        auto& cached = d_geometryCache[i - firstBufferIdx];
+
+        cached.textured = (static_cast<size_t>(buffer.getVertexAttributeElementCount()) == GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT);
+        const GeometryBuffer::VertexData& vertexData = buffer.getVertexData();
+        cached.vertexData.assign(vertexData.begin(), vertexData.end());
+        cached.texture = cached.textured ? buffer.getMainTexture() : nullptr;
+        cached.clippingActive = buffer.isClippingActive();
+        cached.clippingRegion = buffer.getClippingRegion();
+        cached.customTransform = buffer.getCustomTransform();
+        cached.alpha = buffer.getAlpha();
+        cached.blendMode = buffer.getBlendMode();
+        cached.fillRule = buffer.getStencilRenderingFillRule();
+        cached.postStencilVertexCount = buffer.getStencilPostRenderingVertexCount();
+    }
+
+    d_geometryCachePosition = position;
+
+    d_geometryCacheHasColours = !!modColours;
+    if (modColours)
+        d_geometryCacheColours = *modColours;
+
+    d_geometryCacheHasClipRect = !!clipRect;
+    if (clipRect)
+    {
+        d_geometryCacheClipRect = *clipRect;
+        d_geometryCacheClipRect.offset(-position);
+    }
+
+    getGeometryCacheRevision(d_geometryCacheRevision);
+    d_geometryCacheValid = true;
 }
 
 //----------------------------------------------------------------------------//
@@ -454,6 +628,9 @@ RenderedText RenderedText::clone() const
 //----------------------------------------------------------------------------//
 void RenderedText::setHorizontalFormatting(HorizontalTextFormatting fmt)
 {
+    if (d_horzFormatting != fmt)
+        d_geometryCacheValid = false;
+
     d_horzFormatting = fmt;
 
     for (auto& p : d_paragraphs)
@@ -464,6 +641,9 @@ void RenderedText::setHorizontalFormatting(HorizontalTextFormatting fmt)
 //----------------------------------------------------------------------------//
 void RenderedText::setLastJustifiedLineFormatting(HorizontalTextFormatting fmt)
 {
+    if (d_lastJustifiedLineFormatting != fmt)
+        d_geometryCacheValid = false;
+
     d_lastJustifiedLineFormatting = fmt;
 
     for (auto& p : d_paragraphs)
@@ -474,6 +654,9 @@ void RenderedText::setLastJustifiedLineFormatting(HorizontalTextFormatting fmt)
 //----------------------------------------------------------------------------//
 void RenderedText::setWordWrapEnabled(bool wrap)
 {
+    if (d_wordWrap != wrap)
+        d_geometryCacheValid = false;
+
     d_wordWrap = wrap;
 
     for (auto& p : d_paragraphs)
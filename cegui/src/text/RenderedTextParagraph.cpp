@@ -544,6 +544,19 @@ void RenderedTextParagraph::updateHorizontalFormatting(float areaWidth)
     }
 }
 
+//----------------------------------------------------------------------------//
+bool RenderedTextParagraph::isFormattingDirty() const
+{
+    if (d_linesDirty)
+        return true;
+
+    for (const auto& line : d_lines)
+        if (line.heightDirty || line.horzFmtDirty)
+            return true;
+
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 void RenderedTextParagraph::accumulateExtents(Rectf& extents) const
 {
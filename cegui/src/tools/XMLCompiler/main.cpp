@@ -0,0 +1,195 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+
+    purpose:    Command line compiler for the XMLBinaryCache
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+/*
+    Compiles CEGUI XML resources (schemes, imagesets, looknfeels, fonts,
+    layouts...) into the blobs used by CEGUI::XMLBinaryCache, so that they can
+    be generated at build / packaging time instead of on the first run.
+
+    Usage:
+        CEGUIXMLCompiler [-p parser] [-g group] [-d sourcedir] [-o outdir] file...
+
+    The file names must be given exactly as the application passes them to
+    CEGUI (for example "TaharezLook.imageset"), together with the resource
+    group they are loaded from, since both are part of the blob file name.
+*/
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/DefaultLogger.h"
+#include "CEGUI/DynamicModule.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/XMLParser.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------//
+void printUsage(const char* exe)
+{
+    std::cerr <<
+        "Usage: " << exe << " [options] file...\n"
+        "Compiles CEGUI XML resource files for the XMLBinaryCache.\n\n"
+        "Options:\n"
+        "  -p <parser>  XMLParser module used to parse the files\n"
+        "               (default: " << CEGUI::System::getDefaultXMLParserName() << ")\n"
+        "  -g <group>   resource group the files are loaded from at runtime\n"
+        "  -d <dir>     directory the files are read from (default: .)\n"
+        "  -o <dir>     directory the compiled files are written to (default: .)\n";
+}
+
+//----------------------------------------------------------------------------//
+bool readFile(const std::string& path, std::vector<std::uint8_t>& out)
+{
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+        return false;
+
+    out.assign(std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>());
+    return true;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+int main(int argc, char* argv[])
+{
+    CEGUI::String parserName(CEGUI::System::getDefaultXMLParserName());
+    CEGUI::String resourceGroup;
+    std::string sourceDir;
+    CEGUI::String outputDir(".");
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+
+        if (!std::strcmp(argv[i], "-p") && hasValue)
+            parserName = argv[++i];
+        else if (!std::strcmp(argv[i], "-g") && hasValue)
+            resourceGroup = argv[++i];
+        else if (!std::strcmp(argv[i], "-d") && hasValue)
+            sourceDir = std::string(argv[++i]) + '/';
+        else if (!std::strcmp(argv[i], "-o") && hasValue)
+            outputDir = argv[++i];
+        else if (argv[i][0] == '-')
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+        else
+            files.push_back(argv[i]);
+    }
+
+    if (files.empty())
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // parser modules and the cache report problems through the logger
+    CEGUI::DefaultLogger logger;
+    logger.setLogFilename("CEGUIXMLCompiler.log");
+
+    int failures = 0;
+
+    try
+    {
+        CEGUI::DynamicModule parserModule(parserName);
+
+        CEGUI::XMLParser* (*createFunc)(void) =
+            reinterpret_cast<CEGUI::XMLParser*(*)(void)>(
+                parserModule.getSymbolAddress("createParser"));
+        void (*destroyFunc)(CEGUI::XMLParser*) =
+            reinterpret_cast<void(*)(CEGUI::XMLParser*)>(
+                parserModule.getSymbolAddress("destroyParser"));
+
+        CEGUI::XMLParser* parser = createFunc();
+        parser->initialise();
+
+        CEGUI::XMLBinaryCache cache;
+        cache.setCacheDirectory(outputDir);
+
+        for (const auto& file : files)
+        {
+            std::vector<std::uint8_t> source;
+            if (!readFile(sourceDir + file, source))
+            {
+                std::cerr << "Unable to read '" << sourceDir + file << "'.\n";
+                ++failures;
+                continue;
+            }
+
+            CEGUI::RawDataContainer data;
+            data.setData(source.data());
+            data.setSize(source.size());
+
+            try
+            {
+                CEGUI::XMLBinaryCache::Recorder recorder(nullptr,
+                    CEGUI::XMLBinaryCache::hashSource(source.data(), source.size()));
+
+                // schemas are resolved through the System's resource provider,
+                // which does not exist here; validation happens at runtime
+                // when the source changes and is recompiled anyway.
+                parser->parseXML(recorder, data, "", false);
+                cache.store(file, resourceGroup, recorder.getBlob());
+
+                std::cout << file << " -> " <<
+                    CEGUI::XMLBinaryCache::getCacheFileName(file, resourceGroup) << '\n';
+            }
+            catch (const CEGUI::Exception& e)
+            {
+                std::cerr << "Failed to compile '" << file << "': " <<
+                    e.getMessage() << '\n';
+                ++failures;
+            }
+
+            // the data belongs to the vector
+            data.setData(nullptr);
+            data.setSize(0);
+        }
+
+        parser->cleanup();
+        destroyFunc(parser);
+    }
+    catch (const CEGUI::Exception& e)
+    {
+        std::cerr << e.getMessage() << '\n';
+        return 1;
+    }
+
+    return failures ? 1 : 0;
+}
@@ -206,6 +206,9 @@ void DragContainer::endDragging(bool restorePosition)
         // restore normal state of the window
         d_dragging = false;
 
+        if (d_guiContext)
+            d_guiContext->markAsDirty();
+
         if (restorePosition)
             setPosition(d_startPosition);
 
@@ -375,6 +378,10 @@ void DragContainer::onDragStarted(CursorInputEventArgs& e)
 
     d_dragging = true;
 
+    // we now render to a different queue
+    if (d_guiContext)
+        d_guiContext->markAsDirty();
+
     fireEvent(EventDragStarted, e, EventNamespace);
 
     // Handle possible endDragging() caused by event handlers
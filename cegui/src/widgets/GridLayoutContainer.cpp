@@ -35,24 +35,14 @@ namespace CEGUI
 const String GridLayoutContainer::WidgetTypeName("GridLayoutContainer");
 const String GridLayoutContainer::EventNamespace("GridLayoutContainer");
 
-// name for dummies, a number is added to the end of that
+// name for empty cells in layout XML
 const String GridLayoutContainer::DummyName("__auto_dummy_");
 
-//----------------------------------------------------------------------------//
-static inline bool isDummy(const Element& child)
-{
-    // all auto windows inside grid are dummies
-    return static_cast<const Window&>(child).isAutoWindow();
-}
-
 //----------------------------------------------------------------------------//
 GridLayoutContainer::GridLayoutContainer(const String& type, const String& name) :
     LayoutContainer(type, name),
     d_requestedChildIdx(std::numeric_limits<size_t>().max())
 {
-    // grid size is 0x0 that means 0 child windows,
-    // no need to populate d_children with dummies
-
     addGridLayoutContainerProperties();
 }
 
@@ -71,98 +61,47 @@ void GridLayoutContainer::setGridDimensions(size_t width, size_t height)
     d_gridWidth = width;
     d_gridHeight = height;
 
-    // Empty cells will be filled with dummies after loading
+    // Children are assigned to cells in the new grid after loading
     if (d_initialising)
         return;
 
-    std::vector<Element*> oldChildren;
-    std::swap(oldChildren, d_children);
-
-    d_children.reserve(width * height);
-
-    // To handle majority we operate not on rows & columns, but on major & minor dimensions
-    const size_t oldMajorDim = d_rowMajor ? oldWidth : oldHeight;
-    const size_t newMajorDim = d_rowMajor ? width : height;
-    const size_t oldMinorDim = d_rowMajor ? oldHeight : oldWidth;
-    const size_t newMinorDim = d_rowMajor ? height : width;
-    const size_t majorTransferSize = std::min(oldMajorDim, newMajorDim);
-    const size_t minorTransferSize = std::min(oldMinorDim, newMinorDim);
-    const size_t majorTailSize = (newMajorDim > oldMajorDim) ? (newMajorDim - oldMajorDim) : 0;
-    const size_t minorTailSize = (newMinorDim > oldMinorDim) ? (newMinorDim - oldMinorDim) : 0;
+    // Move occupied cells to their new indices. Cells keep their coordinates,
+    // so only the children that don't fit into the new grid are affected.
+    CellMap oldCells;
+    std::swap(oldCells, d_cells);
 
-    // Copy existing data row by row or column by column
-    auto itMajorStart = oldChildren.begin();
-    for (size_t y = 0; y < minorTransferSize; ++y)
+    std::vector<Window*> unusedChildren;
+    for (const auto& cell : oldCells)
     {
-        // Move transferrable part of the line
-        if (majorTransferSize)
+        size_t x, y;
+        if (d_rowMajor)
         {
-            d_children.insert(d_children.end(), itMajorStart, itMajorStart + majorTransferSize);
-            std::fill(itMajorStart, itMajorStart + majorTransferSize, nullptr);
+            y = cell.first / oldWidth;
+            x = cell.first - y * oldWidth;
         }
-
-        // Fill the remaining part of the line with dummies. Set nullptr
-        // for now, fill with real dummies later.
-        if (majorTailSize)
-            d_children.insert(d_children.end(), majorTailSize, nullptr);
-
-        itMajorStart += oldMajorDim;
-    }
-
-    // Remove empty records from oldChildren, leaving only unused children there
-    oldChildren.erase(std::remove(oldChildren.begin(), oldChildren.end(), nullptr), oldChildren.end());
-
-    // Fill remaining cells with dummies. Set nullptr for now, fill with real
-    // dummies later. That's not necessary but done this way for code unification.
-    if (minorTailSize)
-        d_children.insert(d_children.end(), minorTailSize * newMajorDim, nullptr);
-
-    // Do a second pass over new children, fixing nullptrs with real dummies
-    auto itUnusedChild = oldChildren.begin();
-    for (auto& child : d_children)
-    {
-        if (child)
-            continue;
-
-        // Find a reusable dummy if there is one
-        while (itUnusedChild != oldChildren.end())
+        else
         {
-            auto& unusedChild = *itUnusedChild;
-            ++itUnusedChild;
-            if (isDummy(*unusedChild))
-            {
-                child = unusedChild;
-                unusedChild = nullptr;
-                break;
-            }
+            x = cell.first / oldHeight;
+            y = cell.first - x * oldHeight;
         }
 
-        // If there are no reusable dummies left, the new one is created but not
-        // added yet, because nullptrs in a d_children may confuse Window code
-        if (!child)
-            child = createDummy();
+        if (x < width && y < height)
+            d_cells.emplace(mapCellToIndex(x, y), cell.second);
+        else
+            unusedChildren.push_back(cell.second);
     }
 
-    // Register new dummies as our childs. This will not insert a second copy
-    // of the child into d_children, but will do all necessary setup.
-    for (Element* child : d_children)
-        if (!child->getParentElement())
-            addChild(child);
-
-    // Now remove children that are left unused and do not fit into the new grid
-    for (Element* child : oldChildren)
+    // Now remove children that do not fit into the new grid. They are not
+    // in d_cells any more, so removeChild_impl will not look for them there.
+    for (Window* child : unusedChildren)
     {
-        // Skip reused dummies, we replaced them with nullptrs above
-        if (!child)
-            continue;
-
-        // Grid will not repace this child with a dummy because it isn't present
-        // in the actual child list. This is done intentionally and is a key point.
         removeChild(child);
 
-        if (static_cast<Window*>(child)->isDestroyedByParent())
-            WindowManager::getSingleton().destroyWindow(static_cast<Window*>(child));
+        if (child->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(child);
     }
+
+    markNeedsLayouting();
 }
 
 //----------------------------------------------------------------------------//
@@ -195,12 +134,7 @@ void GridLayoutContainer::setAutoGrowing(bool enabled)
 //----------------------------------------------------------------------------//
 size_t GridLayoutContainer::getActualChildCount() const
 {
-    size_t count = 0;
-    for (const Element* child : d_children)
-        if (!isDummy(*child))
-            ++count;
-
-    return count;
+    return d_cells.size();
 }
 
 //----------------------------------------------------------------------------//
@@ -208,21 +142,14 @@ void GridLayoutContainer::getMinimalSizeInCells(size_t& width, size_t& height) c
 {
     width = 0;
     height = 0;
-    for (size_t y = 0; y < d_gridHeight; ++y)
+    for (const auto& cell : d_cells)
     {
-        for (size_t x = 0; x < d_gridWidth; ++x)
+        size_t x, y;
+        mapIndexToCell(cell.first, x, y);
+        if (x < d_gridWidth && y < d_gridHeight)
         {
-            if (x >= width || y >= height)
-            {
-                const Window* child = getChildAtIndex(mapCellToIndex(x, y));
-                if (child && !isDummy(*child))
-                {
-                    if (x >= width)
-                        width = x + 1;
-                    if (y >= height)
-                        height = y + 1;
-                }
-            }
+            width = std::max(width, x + 1);
+            height = std::max(height, y + 1);
         }
     }
 }
@@ -230,28 +157,28 @@ void GridLayoutContainer::getMinimalSizeInCells(size_t& width, size_t& height) c
 //----------------------------------------------------------------------------//
 size_t GridLayoutContainer::getFirstFreeIndex(size_t start) const
 {
-    for (size_t i = start; i < d_children.size(); ++i)
-        if (isDummy(*getChildAtIndex(i)))
-            return i;
+    // Skip the run of occupied cells starting at 'start', if any
+    size_t idx = start;
+    for (auto it = d_cells.lower_bound(start); it != d_cells.end() && it->first == idx; ++it)
+        ++idx;
 
-    return std::numeric_limits<size_t>().max();
+    return (idx < d_gridWidth * d_gridHeight) ? idx : std::numeric_limits<size_t>().max();
 }
 
 //----------------------------------------------------------------------------//
 size_t GridLayoutContainer::getLastBusyIndex() const
 {
-    bool found = false;
-    size_t lastIdx = 0;
-    for (size_t i = 0; i < d_children.size(); ++i)
-    {
-        if (!isDummy(*getChildAtIndex(i)))
-        {
-            lastIdx = i;
-            found = true;
-        }
-    }
+    return d_cells.empty() ? std::numeric_limits<size_t>().max() : d_cells.rbegin()->first;
+}
 
-    return found ? lastIdx : std::numeric_limits<size_t>().max();
+//----------------------------------------------------------------------------//
+size_t GridLayoutContainer::getChildCellIndex(const Element* child) const
+{
+    for (const auto& cell : d_cells)
+        if (cell.second == child)
+            return cell.first;
+
+    return std::numeric_limits<size_t>().max();
 }
 
 //----------------------------------------------------------------------------//
@@ -268,17 +195,18 @@ void GridLayoutContainer::addChildAtIndex(Element* element, size_t index)
     validateGridCell(x, y);
 
     // The target cell is not free
-    if (!isDummy(*getChildAtIndex(index)))
+    if (d_cells.count(index))
     {
         // Find the first free cell from the requested position
+        const size_t capacity = d_gridWidth * d_gridHeight;
         size_t freeIdx = getFirstFreeIndex(index + 1);
 
-        if (freeIdx >= getChildCount())
+        if (freeIdx >= capacity)
         {
             // The grid is full
             if (d_autoGrow)
             {
-                freeIdx = getChildCount();
+                freeIdx = capacity;
                 growByOneLine();
             }
             else
@@ -300,22 +228,49 @@ void GridLayoutContainer::addChildAtIndex(Element* element, size_t index)
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::removeChildAtIndex(size_t index)
 {
-    auto child = getChildAtIndex(index);
-    if (child && !isDummy(*child))
-        removeChild(child);
+    auto it = d_cells.find(index);
+    if (it != d_cells.end())
+        removeChild(it->second);
 }
 
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::moveChildToIndex(size_t indexFrom, size_t indexTo)
 {
-    if (indexFrom >= getChildCount())
+    if (indexFrom >= d_gridWidth * d_gridHeight)
         return;
 
     size_t x, y;
     mapIndexToCell(indexTo, x, y);
     validateGridCell(x, y);
 
-    LayoutContainer::moveChildToIndex(indexFrom, indexTo);
+    if (indexFrom == indexTo)
+        return;
+
+    // The cell at indexFrom goes to indexTo, cells in between shift by one
+    // towards indexFrom. Only occupied cells have to be touched.
+    const size_t first = std::min(indexFrom, indexTo);
+    const size_t last = std::max(indexFrom, indexTo);
+    const auto itFirst = d_cells.lower_bound(first);
+    const auto itLast = d_cells.upper_bound(last);
+
+    std::vector<CellMap::value_type> shifted(itFirst, itLast);
+    d_cells.erase(itFirst, itLast);
+
+    for (const auto& cell : shifted)
+    {
+        size_t idx = cell.first;
+        if (idx == indexFrom)
+            idx = indexTo;
+        else if (indexFrom < indexTo)
+            --idx;
+        else
+            ++idx;
+
+        d_cells.emplace(idx, cell.second);
+    }
+
+    ElementEventArgs args(this);
+    onChildOrderChanged(args);
 }
 
 //----------------------------------------------------------------------------//
@@ -324,7 +279,7 @@ void GridLayoutContainer::addChildToCell(Window* window, size_t gridX, size_t gr
     validateGridCell(gridX, gridY);
 
     const auto index = mapCellToIndex(gridX, gridY);
-    if (!replace && !isDummy(*getChildAtIndex(index)))
+    if (!replace && d_cells.count(index))
         throw InvalidRequestException("Target cell is busy, set replace to true to replace existing item.");
 
     d_requestedChildIdx = index;
@@ -340,14 +295,39 @@ void GridLayoutContainer::removeChildFromCell(size_t gridX, size_t gridY)
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::moveChildToCell(Window* wnd, size_t gridX, size_t gridY)
 {
-    moveChildToIndex(getChildIndex(wnd), mapCellToIndex(gridX, gridY));
+    moveChildToIndex(getChildCellIndex(wnd), mapCellToIndex(gridX, gridY));
 }
 
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::swapCells(size_t gridX1, size_t gridY1,
                                     size_t gridX2, size_t gridY2)
 {
-    swapChildren(mapCellToIndex(gridX1, gridY1), mapCellToIndex(gridX2, gridY2));
+    const size_t capacity = d_gridWidth * d_gridHeight;
+    const size_t index1 = mapCellToIndex(gridX1, gridY1);
+    const size_t index2 = mapCellToIndex(gridX2, gridY2);
+    if (index1 >= capacity || index2 >= capacity || index1 == index2)
+        return;
+
+    auto it1 = d_cells.find(index1);
+    auto it2 = d_cells.find(index2);
+    Window* window1 = (it1 != d_cells.end()) ? it1->second : nullptr;
+    Window* window2 = (it2 != d_cells.end()) ? it2->second : nullptr;
+
+    // Swapping two empty cells changes nothing
+    if (!window1 && !window2)
+        return;
+
+    if (window1)
+        d_cells.erase(it1);
+    if (window2)
+        d_cells.erase(it2);
+    if (window1)
+        d_cells.emplace(index2, window1);
+    if (window2)
+        d_cells.emplace(index1, window2);
+
+    ElementEventArgs args(this);
+    onChildOrderChanged(args);
 }
 
 //----------------------------------------------------------------------------//
@@ -356,7 +336,8 @@ Window* GridLayoutContainer::getChildAtCell(size_t gridX, size_t gridY) const
     if (gridX >= d_gridWidth || gridY >= d_gridHeight)
         return nullptr;
 
-    return getChildAtIndex(mapCellToIndex(gridX, gridY));
+    auto it = d_cells.find(mapCellToIndex(gridX, gridY));
+    return (it != d_cells.end()) ? it->second : nullptr;
 }
 
 //----------------------------------------------------------------------------//
@@ -367,57 +348,66 @@ void GridLayoutContainer::layout_impl()
     const float absWidth = childContentArea.getWidth();
     const float absHeight = childContentArea.getHeight();
 
-    // First, we need to determine rowSizes and colSizes, this is
-    // needed before any layouting work takes place
+    // First, we need to determine rowSizes and colSizes, this is needed
+    // before any layouting work takes place. Empty cells have zero size,
+    // so only occupied cells need to be looked at.
     std::vector<UDim> colSizes(d_gridWidth, UDim(0, 0));
     std::vector<UDim> rowSizes(d_gridHeight, UDim(0, 0));
-    for (size_t y = 0; y < d_gridHeight; ++y)
+    for (const auto& cell : d_cells)
     {
-        for (size_t x = 0; x < d_gridWidth; ++x)
-        {
-            Window* window = getChildAtIndex(mapCellToIndex(x, y));
-            const UVector2 size = getBoundingSizeForWindow(window);
+        size_t x, y;
+        mapIndexToCell(cell.first, x, y);
+        if (x >= d_gridWidth || y >= d_gridHeight)
+            continue;
 
-            if (CoordConverter::asAbsolute(colSizes[x], absWidth) <
-                CoordConverter::asAbsolute(size.d_x, absWidth))
-            {
-                colSizes[x] = size.d_x;
-            }
+        const UVector2 size = getBoundingSizeForWindow(cell.second);
 
-            if (CoordConverter::asAbsolute(rowSizes[y], absHeight) <
-                CoordConverter::asAbsolute(size.d_y, absHeight))
-            {
-                rowSizes[y] = size.d_y;
-            }
+        if (CoordConverter::asAbsolute(colSizes[x], absWidth) <
+            CoordConverter::asAbsolute(size.d_x, absWidth))
+        {
+            colSizes[x] = size.d_x;
+        }
+
+        if (CoordConverter::asAbsolute(rowSizes[y], absHeight) <
+            CoordConverter::asAbsolute(size.d_y, absHeight))
+        {
+            rowSizes[y] = size.d_y;
         }
     }
 
-    // OK, now rowSizes[y] is the height of y-th row
-    //         colSizes[x] is the width of x-th column
+    // Turn sizes into positions of the columns and rows, the last element
+    // being the total width and height
+    std::vector<UDim> colPositions(d_gridWidth + 1, UDim(0, 0));
+    for (size_t x = 0; x < d_gridWidth; ++x)
+        colPositions[x + 1] = colPositions[x] + colSizes[x];
 
-    // Second layouting phase starts now
-    UDim cellX;
-    UDim cellY(0.f, 0.f);
+    std::vector<UDim> rowPositions(d_gridHeight + 1, UDim(0, 0));
     for (size_t y = 0; y < d_gridHeight; ++y)
+        rowPositions[y + 1] = rowPositions[y] + rowSizes[y];
+
+    // Second layouting phase starts now. Sizes are known already, so area
+    // changes of the children and of the grid itself can be applied at once,
+    // and children are not updated twice when the grid gets resized.
+    AreaChangeBatch batch;
+
+    for (const auto& cell : d_cells)
     {
-        cellX.d_scale = 0.f;
-        cellX.d_offset = 0.f;
-        
-        for (size_t x = 0; x < d_gridWidth; ++x)
-        {
-            Window* window = getChildAtIndex(mapCellToIndex(x, y));
-            const UVector2 offset = getOffsetForWindow(window);
-            window->setPosition(UVector2(cellX, cellY) + offset);
+        size_t x, y;
+        mapIndexToCell(cell.first, x, y);
+        if (x >= d_gridWidth || y >= d_gridHeight)
+            continue;
 
-            cellX += colSizes[x];
-        }
+        Window* window = cell.second;
+        const UVector2 position =
+            UVector2(colPositions[x], rowPositions[y]) + getOffsetForWindow(window);
 
-        cellY += rowSizes[y];
+        // Most children keep their place when a grid is relayouted
+        if (window->getPosition() != position)
+            window->setPosition(position);
     }
 
     // Now we just need to set the total width and height
-
-    setSize(USize(cellX, cellY));
+    setSize(USize(colPositions.back(), rowPositions.back()));
 }
 
 //----------------------------------------------------------------------------//
@@ -452,10 +442,7 @@ void GridLayoutContainer::mapIndexToCell(size_t idx, size_t& gridX, size_t& grid
 //----------------------------------------------------------------------------//
 Window* GridLayoutContainer::createDummy()
 {
-    Window* dummy = WindowManager::getSingleton().createWindow("DefaultWindow",
-                    DummyName + std::to_string(d_nextDummyIdx));
-
-    ++d_nextDummyIdx;
+    Window* dummy = WindowManager::getSingleton().createWindow("DefaultWindow", DummyName);
 
     dummy->setAutoWindow(true);
     dummy->setVisible(false);
@@ -488,10 +475,17 @@ void GridLayoutContainer::growByOneLine()
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::endInitialisation()
 {
-    // After we loaded children from XML, fill remaining free cells with dummies
-    const size_t capacity = d_gridWidth * d_gridHeight;
-    for (size_t i = d_children.size(); i < capacity; ++i)
-        addChild(createDummy());
+    // Empty cells are known from the loaded cell indices, the placeholder
+    // that stood for them in XML is not needed anymore
+    if (d_loadPlaceholder)
+    {
+        Window* placeholder = d_loadPlaceholder;
+        d_loadPlaceholder = nullptr;
+        removeChild(placeholder);
+        WindowManager::getSingleton().destroyWindow(placeholder);
+    }
+
+    d_nextLoadIdx = 0;
 
     LayoutContainer::endInitialisation();
 }
@@ -499,35 +493,40 @@ void GridLayoutContainer::endInitialisation()
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::addChild_impl(Element* element)
 {
-    // Custom logic for dummies. Allow to refresh children already in the list.
-    // It is necessary for rearrangement optimization when resizing the grid.
-    // Skips LayoutContainer's subscriptions on child resizing and draw list
-    // maintaining because dummies have no size and are invisible.
-    // Skips already existing child name check because we guarantee uniqueness.
-    if (isDummy(*element))
-    {
-        Element::addChild_impl(element);
-        return;
-    }
-
-    // Regular logic for the loading time
+    // Custom logic for the loading time. Children take consecutive cells in
+    // the order they are loaded, empty cells being skipped by placeholders.
     if (d_initialising)
     {
+        // Skips LayoutContainer's subscriptions on child resizing and draw list
+        // maintaining because the placeholder has no size and is invisible.
+        if (element == d_loadPlaceholder)
+        {
+            Element::addChild_impl(element);
+            addToChildNameIndex(*static_cast<Window*>(element));
+            return;
+        }
+
+        if (!d_cells.empty())
+            d_nextLoadIdx = std::max(d_nextLoadIdx, d_cells.rbegin()->first + 1);
+
+        d_cells[d_nextLoadIdx++] = static_cast<Window*>(element);
         LayoutContainer::addChild_impl(element);
         return;
     }
 
+    const size_t capacity = d_gridWidth * d_gridHeight;
+
     // If requested index is unspecified (invalid), get the first free index
-    if (d_requestedChildIdx >= getChildCount())
+    if (d_requestedChildIdx >= capacity)
     {
         d_requestedChildIdx = getFirstFreeIndex(d_freeSearchStart);
 
-        if (d_requestedChildIdx >= getChildCount())
+        if (d_requestedChildIdx >= capacity)
         {
             // The grid is full
             if (d_autoGrow)
             {
-                d_requestedChildIdx = getChildCount();
+                d_requestedChildIdx = capacity;
                 growByOneLine();
             }
             else
@@ -541,63 +540,45 @@ void GridLayoutContainer::addChild_impl(Element* element)
         }
 
         // We now know an index of the first free cell. Caching it allows us not to scan the
-        // whole child list each time we insert a child without specifying a location. This
+        // whole cell map each time we insert a child without specifying a location. This
         // cache is invalidated in some situations. Be careful when changing related logic.
         d_freeSearchStart = d_requestedChildIdx + 1;
     }
 
-    // The new child is added to the end of d_children
-    LayoutContainer::addChild_impl(element);
-
-    // We swap the element in the target cell with the added child. This essentially
-    // places the added child to its right position and puts the replaced element at
-    // the end of d_children it will soon get removed from. Note that replaced element
-    // may be a dummy or a regular child. The d_requestedChildIdx pointing to it means
-    // that the user confirmed replacement earlier.
-    std::swap(d_children[d_requestedChildIdx], d_children[d_children.size() - 1]);
+    const size_t index = d_requestedChildIdx;
 
     // Clear the requested index so that it doesn't influence the next call
     d_requestedChildIdx = std::numeric_limits<size_t>().max();
 
-    // Finally remove the child that was in the target cell before
-    Window* toBeRemoved = static_cast<Window*>(d_children[d_children.size() - 1]);
-    removeChild(toBeRemoved);
-    if (toBeRemoved->isDestroyedByParent())
-        WindowManager::getSingleton().destroyWindow(toBeRemoved);
+    LayoutContainer::addChild_impl(element);
+
+    // The d_requestedChildIdx pointing to a busy cell means that the user
+    // confirmed replacement of the child in it earlier.
+    Window*& cellChild = d_cells[index];
+    Window* toBeRemoved = (cellChild != element) ? cellChild : nullptr;
+    cellChild = static_cast<Window*>(element);
+
+    // Finally remove the child that was in the target cell before. It is
+    // not in d_cells any more, so removeChild_impl will not free the cell.
+    if (toBeRemoved)
+    {
+        removeChild(toBeRemoved);
+        if (toBeRemoved->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(toBeRemoved);
+    }
 }
 
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::removeChild_impl(Element* element)
 {
-    // Before we remove the child, we must add a new dummy and place it
-    // instead of the removed child. There are exceptions though:
-    // 1. If the grid is being destroyed, we don't want to maintain its structure anymore.
-    // 2. If the grid is being initialized, structure is not established yet.
-    // 3. If removing a dummy. It is always an intentional internal action.
-    // 4. If the window manager is locked, at which time we can't create a new dummy.
-    // 5. If the child is not in our list, which happens internally when grid is resized.
-
-    if (!d_destructionStarted &&
-        !d_initialising &&
-        !isDummy(*element) &&
-        !WindowManager::getSingleton().isLocked())
+    // Free the cell of the child, if it is still in the grid
+    const size_t idx = getChildCellIndex(element);
+    if (idx != std::numeric_limits<size_t>().max())
     {
-        auto it = std::find(d_children.cbegin(), d_children.cend(), element);
-        if (it != d_children.cend())
-        {
-            const size_t idx = static_cast<size_t>(std::distance(d_children.cbegin(), it));
-            addChild(createDummy());
-            std::swap(d_children[idx], d_children[d_children.size() - 1]);
+        d_cells.erase(idx);
 
-            if (d_freeSearchStart > idx)
-                d_freeSearchStart = idx;
-        }
-    }
-    else if (WindowManager::getSingleton().isLocked())
-    {
-        // Free cells may shift towards the beginning of the child list
-        if (d_freeSearchStart > 0)
-            --d_freeSearchStart;
+        if (d_freeSearchStart > idx)
+            d_freeSearchStart = idx;
     }
 
     LayoutContainer::removeChild_impl(element);
@@ -606,13 +587,23 @@ void GridLayoutContainer::removeChild_impl(Element* element)
 //----------------------------------------------------------------------------//
 Window* GridLayoutContainer::getChildAutoWindow(const String& name)
 {
-    // Since dummies are on-demand and their names may change from one run to
-    // another, we create them right at the loading time and ignore exact names.
+    // Empty cells are written as placeholders with the same name. At the
+    // loading time they only advance the cell index for the next child,
+    // so all of them are given the same window.
     if (d_initialising && name == DummyName)
     {
-        Window* dummy = createDummy();
-        addChild(dummy);
-        return dummy;
+        if (!d_cells.empty())
+            d_nextLoadIdx = std::max(d_nextLoadIdx, d_cells.rbegin()->first + 1);
+
+        ++d_nextLoadIdx;
+
+        if (!d_loadPlaceholder)
+        {
+            d_loadPlaceholder = createDummy();
+            addChild(d_loadPlaceholder);
+        }
+
+        return d_loadPlaceholder;
     }
 
     return LayoutContainer::getChildAutoWindow(name);
@@ -622,30 +613,22 @@ Window* GridLayoutContainer::getChildAutoWindow(const String& name)
 int GridLayoutContainer::writeChildWindowsXML(XMLSerializer& xml_stream) const
 {
     size_t windowsWritten = 0;
-    size_t dummiesSkipped = 0;
-    for (const Element* child : d_children)
+    size_t nextIdx = 0;
+    for (const auto& cell : d_cells)
     {
-        if (isDummy(*child))
+        // Empty cells before a child are written as placeholders, trailing
+        // ones aren't saved. All placeholders are written with the same name.
+        for (; nextIdx < cell.first; ++nextIdx)
         {
-            // Trailing dummies aren't saved
-            ++dummiesSkipped;
+            xml_stream.openTag(AutoWindowXMLElementName);
+            xml_stream.attribute(AutoWindowNamePathXMLAttributeName, DummyName);
+            xml_stream.closeTag();
+            ++windowsWritten;
         }
-        else
-        {
-            windowsWritten += dummiesSkipped + 1;
-
-            while (dummiesSkipped)
-            {
-                // All dummies are written with the same name. It serves
-                // as a type for on-demand creation when loading.
-                xml_stream.openTag(AutoWindowXMLElementName);
-                xml_stream.attribute(AutoWindowNamePathXMLAttributeName, DummyName);
-                xml_stream.closeTag();
-                --dummiesSkipped;
-            }
 
-            static_cast<const Window*>(child)->writeXMLToStream(xml_stream);
-        }
+        cell.second->writeXMLToStream(xml_stream);
+        ++windowsWritten;
+        nextIdx = cell.first + 1;
     }
 
     return static_cast<int>(windowsWritten);
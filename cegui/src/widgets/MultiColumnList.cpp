@@ -83,7 +83,8 @@ MultiColumnList::MultiColumnList(const String& type, const String& name) :
 	d_nominatedSelectRow(0),
 	d_lastSelected(nullptr),
     d_columnCount(0),
-    d_autoSizeColumnUsesHeader(false)
+    d_autoSizeColumnUsesHeader(false),
+    d_rowOffsetsValid(false)
 {
 	// add properties
 	addMultiColumnListProperties();
@@ -1455,14 +1456,40 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 *************************************************************************/
 float MultiColumnList::getTotalRowsHeight(void) const
 {
-	float height = 0.0f;
+	updateRowOffsets();
+	return d_rowOffsets.back();
+}
 
-	for (unsigned int i = 0; i < getRowCount(); ++i)
+
+/*************************************************************************
+	Return the offset of the top of the given row from the top of the
+	first row
+*************************************************************************/
+float MultiColumnList::getRowOffset(unsigned int row_idx) const
+{
+	if (row_idx > getRowCount())
 	{
-		height += getHighestRowItemHeight(i);
+		throw InvalidRequestException(
+            "specified row is out of range.");
 	}
 
-	return height;
+	updateRowOffsets();
+	return d_rowOffsets[row_idx];
+}
+
+
+/*************************************************************************
+	Return the index of the row containing the given vertical offset
+*************************************************************************/
+unsigned int MultiColumnList::getRowAtOffset(float offset) const
+{
+	updateRowOffsets();
+
+	// first row whose bottom edge lies below the offset.
+	const std::vector<float>::const_iterator row_end =
+        std::upper_bound(d_rowOffsets.begin() + 1, d_rowOffsets.end(), offset);
+
+	return static_cast<unsigned int>(row_end - (d_rowOffsets.begin() + 1));
 }
 
 
@@ -1589,32 +1616,31 @@ ListboxItem* MultiColumnList::getItemAtPoint(const glm::vec2& localPos) const
     const ListHeader* header = getListHeader();
     const Rectf listArea(getListRenderArea());
 
-    float y = listArea.d_min.y - getVertScrollbar()->getScrollPosition();
+    const float y = listArea.d_min.y - getVertScrollbar()->getScrollPosition();
     float x = listArea.d_min.x - getHorzScrollbar()->getScrollPosition();
     
     if(y > localPos.y)
         return nullptr;
 
-    for (unsigned int i = 0; i < getRowCount(); ++i)
+    // locate the row
+    const unsigned int i = getRowAtOffset(localPos.y - y);
+
+    if (i >= getRowCount())
+        return nullptr;
+
+    // scan across to find column that was clicked
+    const float header_width = header->getPixelSize().d_width;
+
+    for (unsigned int j = 0; j < getColumnCount(); ++j)
     {
-        y += getHighestRowItemHeight(i);
+        const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
+        x += CoordConverter::asAbsolute(seg.getWidth(), header_width);
 
-        // have we located the row?
-        if (localPos.y < y)
+        // was this the column?
+        if (localPos.x < x)
         {
-            // scan across to find column that was clicked
-            for (unsigned int j = 0; j < getColumnCount(); ++j)
-            {
-                const ListHeaderSegment& seg = header->getSegmentFromColumn(j);
-                x += CoordConverter::asAbsolute(seg.getWidth(), header->getPixelSize().d_width);
-
-                // was this the column?
-                if (localPos.x < x)
-                {
-                    // return contents of grid element that was clicked.
-                    return d_grid[i][j];
-                }
-            }
+            // return contents of grid element that was clicked.
+            return d_grid[i][j];
         }
     }
 
@@ -1833,6 +1859,7 @@ void MultiColumnList::onSelectionChanged(WindowEventArgs& e)
 *************************************************************************/
 void MultiColumnList::onListContentsChanged(WindowEventArgs& e)
 {
+	invalidateRowOffsets();
 	configureScrollbars();
 	invalidate();
 	fireEvent(EventListContentsChanged, e, EventNamespace);
@@ -1895,6 +1922,9 @@ bool MultiColumnList::handleFontRenderSizeChange(const Font& font)
         }
     }
 
+    if (handled)
+        invalidateRowOffsets();
+
     // Always call just in case
     handled |= Window::handleFontRenderSizeChange(font);
 
@@ -1909,6 +1939,9 @@ void MultiColumnList::onFontChanged(WindowEventArgs& e)
     for (unsigned int col = 0; col < getColumnCount(); ++col)
         getHeaderSegmentForColumn(col).setFont(d_font);
 
+    // items using the default font may change size
+    invalidateRowOffsets();
+
     // Call base class handler
     Window::onFontChanged(e);
 }
@@ -2520,17 +2553,11 @@ void MultiColumnList::ensureRowIsVisible(unsigned int row_idx)
     }
     else
     {
-        float bottom;
-        float top = 0.0f;
         float listHeight = getListRenderArea().getHeight();
 
-        // get distance to top of item
-        unsigned int row;
-        for (row = 0; row < row_idx; ++row)
-            top += getHighestRowItemHeight(row);
-
-        // calculate distance to bottom of item
-        bottom = top + getHighestRowItemHeight(row);
+        // get distance to top and bottom of item
+        float top = getRowOffset(row_idx);
+        float bottom = getRowOffset(row_idx + 1);
 
         // account for current scrollbar value
         float currPos = vertScrollbar->getScrollPosition();
@@ -2675,6 +2702,10 @@ bool MultiColumnList::ListRow::operator>(const ListRow& rhs) const
 *************************************************************************/
 void MultiColumnList::resortList()
 {
+    // rows may be reordered, and this is also how changes to item data get
+    // picked up (see handleUpdatedItemData).
+    invalidateRowOffsets();
+
     // re-sort list according to direction
     ListHeaderSegment::SortDirection dir = getSortDirection();
 
@@ -2689,6 +2720,36 @@ void MultiColumnList::resortList()
     // else no (or invalid) direction, so do not sort.
 }
 
+/*************************************************************************
+    Discard the cached row offsets
+*************************************************************************/
+void MultiColumnList::invalidateRowOffsets()
+{
+    d_rowOffsetsValid = false;
+}
+
+/*************************************************************************
+    Rebuild the cached row offsets if needed
+*************************************************************************/
+void MultiColumnList::updateRowOffsets() const
+{
+    if (d_rowOffsetsValid)
+        return;
+
+    const unsigned int row_count = getRowCount();
+    d_rowOffsets.resize(row_count + 1);
+
+    float offset = 0.0f;
+    for (unsigned int i = 0; i < row_count; ++i)
+    {
+        d_rowOffsets[i] = offset;
+        offset += getHighestRowItemHeight(i);
+    }
+    d_rowOffsets[row_count] = offset;
+
+    d_rowOffsetsValid = true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 /*************************************************************************
 	Operators for MCLGridRef
@@ -663,14 +663,17 @@ void ScrollablePane::destroy(void)
 }
 
 //----------------------------------------------------------------------------//
-Window* ScrollablePane::findChildByNamePath_impl(const String& name_path) const
+const Window* ScrollablePane::getChildLookupTarget(const String& name_path,
+                                                   size_t pos) const
 {
     // FIXME: This is horrible
     //
-    if (name_path.substr(0, 7) == "__auto_")
-        return Window::findChildByNamePath_impl(name_path);
-    else
-        return Window::findChildByNamePath_impl(ScrolledContainerName + '/' + name_path);
+    static const String autoPrefix("__auto_");
+
+    if (!name_path.compare(pos, autoPrefix.length(), autoPrefix))
+        return this;
+
+    return findImmediateChild(ScrolledContainerName, 0, ScrolledContainerName.length());
 }
 
 //----------------------------------------------------------------------------//
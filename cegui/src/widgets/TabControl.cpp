@@ -813,14 +813,17 @@ void TabControl::removeTab_impl(Window* window)
     invalidate();
 }
 
-Window* TabControl::findChildByNamePath_impl(const String& name_path) const
+const Window* TabControl::getChildLookupTarget(const String& name_path,
+                                               size_t pos) const
 {
     // FIXME: This is horrible
     //
-    if (name_path.substr(0, 7) == "__auto_")
-        return Window::findChildByNamePath_impl(name_path);
-    else
-        return Window::findChildByNamePath_impl(ContentPaneName + '/' + name_path);
+    static const String autoPrefix("__auto_");
+
+    if (!name_path.compare(pos, autoPrefix.length(), autoPrefix))
+        return this;
+
+    return findImmediateChild(ContentPaneName, 0, ContentPaneName.length());
 }
 
 } // End of  CEGUI namespace section
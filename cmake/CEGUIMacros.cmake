@@ -533,13 +533,6 @@ macro (cegui_add_test_executable_with_extra_files _NAME _EXTRA_HEADER_FILES _EXT
             ${CEGUI_NULL_RENDERER_LIBNAME}
             ${Boost_UNIT_TEST_FRAMEWORK_LIBRARY}
             )
-
-        if (CEGUI_BUILD_PERFORMANCE_TESTS)
-            cegui_target_link_libraries(${CEGUI_TARGET_NAME}
-                ${Boost_TIMER_LIBRARY}
-                ${Boost_SYSTEM_LIBRARY}
-                )
-        endif()
     endif()
 
     if (CEGUI_BUILD_STATIC_CONFIGURATION)
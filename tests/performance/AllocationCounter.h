@@ -0,0 +1,56 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUITestsAllocationCounter_h_
+#define _CEGUITestsAllocationCounter_h_
+
+#include <cstdint>
+
+/*!
+\brief
+    Counts the heap allocations made through the global operator new.
+
+    The performance tests replace the global allocation functions to count
+    every allocation made while a test runs. The replacement applies to the
+    whole program where the platform resolves operator new across shared
+    libraries (ELF and Mach-O). On Windows, the CEGUI DLLs use their own C
+    runtime, so only allocations made by the test executable itself are
+    counted.
+*/
+class AllocationCounter
+{
+public:
+    //! Reset both counters to zero.
+    static void reset();
+
+    //! Return the number of allocations made since the last reset.
+    static std::uint64_t getAllocationCount();
+
+    //! Return the number of bytes requested since the last reset.
+    static std::uint64_t getAllocatedBytes();
+};
+
+#endif
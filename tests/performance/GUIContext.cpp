@@ -0,0 +1,108 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+
+/*!
+\brief
+    Redraws a GUIContext with 10000 buttons after invalidating a single one of
+    them, which is the common case of e.g. a hover effect.
+*/
+class GUIContextRedrawPerformanceTest : public PerformanceTest
+{
+public:
+    GUIContextRedrawPerformanceTest(bool retained, CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_context(CEGUI::System::getSingleton().createGUIContext(
+            CEGUI::System::getSingleton().getRenderer()->getDefaultRenderTarget()))
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        d_root = wmgr.createWindow("DefaultWindow");
+        d_context.setRootWindow(d_root);
+        d_context.setRetainedDrawListEnabled(retained);
+
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            CEGUI::Window* row = d_root->createChild("DefaultWindow");
+
+            for (unsigned int j = 0; j < 100; ++j)
+            {
+                CEGUI::Window* button = row->createChild("TaharezLook/Button");
+                button->setArea(CEGUI::UDim(0, j * 8.0f), CEGUI::UDim(0, i * 6.0f),
+                                CEGUI::UDim(0, 8.0f), CEGUI::UDim(0, 6.0f));
+                d_windows.push_back(button);
+            }
+        }
+
+        d_context.draw();
+    }
+
+    ~GUIContextRedrawPerformanceTest()
+    {
+        d_context.setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::System::getSingleton().destroyGUIContext(d_context);
+    }
+
+    virtual void doTest()
+    {
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            d_windows[(i * 37) % d_windows.size()]->invalidate();
+            d_context.draw();
+        }
+    }
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    std::vector<CEGUI::Window*> d_windows;
+};
+
+BOOST_AUTO_TEST_SUITE(GUIContextPerformance)
+
+BOOST_AUTO_TEST_CASE(RedrawOneWindow)
+{
+    GUIContextRedrawPerformanceTest test(false,
+        "1000x redraw after invalidating 1 window (10000 windows total)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(RedrawOneWindowRetained)
+{
+    GUIContextRedrawPerformanceTest test(true,
+        "1000x retained redraw after invalidating 1 window (10000 windows total)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
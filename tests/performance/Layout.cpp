@@ -0,0 +1,199 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+
+/*!
+\brief
+    Base of the tests using the layouts from the datafiles. It loads the
+    Generic scheme, which the layouts use next to TaharezLook, and gives the
+    renderer a real display size for the duration of the test so that the auto
+    scaled imagery has its usual size.
+*/
+class LayoutPerformanceTest : public PerformanceTest
+{
+public:
+    explicit LayoutPerformanceTest(const CEGUI::String& test_name) :
+        PerformanceTest(test_name),
+        d_previousDisplaySize(CEGUI::System::getSingleton().getRenderer()->getDisplaySize())
+    {
+        CEGUI::SchemeManager& smgr = CEGUI::SchemeManager::getSingleton();
+        if (!smgr.isDefined("Generic"))
+            smgr.createFromFile("Generic.scheme");
+
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(1280.0f, 720.0f));
+    }
+
+    ~LayoutPerformanceTest()
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(d_previousDisplaySize);
+    }
+
+    CEGUI::Sizef d_previousDisplaySize;
+};
+
+/*!
+\brief
+    Loads a layout from the datafiles and destroys it again, which covers XML
+    parsing, window creation, looknfeel initialisation and property setting.
+*/
+class LayoutLoadPerformanceTest : public LayoutPerformanceTest
+{
+public:
+    LayoutLoadPerformanceTest(const CEGUI::String& layout) :
+        LayoutPerformanceTest("10x load and destroy " + layout),
+        d_layout(layout)
+    {
+    }
+
+    virtual void doTest()
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            wmgr.destroyWindow(wmgr.loadLayoutFromFile(d_layout));
+            wmgr.cleanDeadPool();
+        }
+    }
+
+    CEGUI::String d_layout;
+};
+
+/*!
+\brief
+    Drives frames of a GUIContext showing a layout from the datafiles through
+    the renderer: each frame injects a time pulse, optionally some input or a
+    full invalidation, and draws the context.
+*/
+class LayoutFramePerformanceTest : public LayoutPerformanceTest
+{
+public:
+    enum FrameWork
+    {
+        //! nothing changes between frames.
+        Idle,
+        //! the mouse cursor sweeps across the layout, hovering widgets.
+        MouseSweep,
+        //! the whole layout is invalidated every frame.
+        FullRedraw
+    };
+
+    LayoutFramePerformanceTest(const CEGUI::String& layout, FrameWork work,
+                               const CEGUI::String& test_name) :
+        LayoutPerformanceTest(test_name),
+        d_context(CEGUI::System::getSingleton().createGUIContext(
+            CEGUI::System::getSingleton().getRenderer()->getDefaultRenderTarget())),
+        d_work(work),
+        d_frame(0)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().loadLayoutFromFile(layout);
+        d_context.setRootWindow(d_root);
+        d_context.injectTimePulse(0);
+        d_context.draw();
+    }
+
+    ~LayoutFramePerformanceTest()
+    {
+        d_context.setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::WindowManager::getSingleton().cleanDeadPool();
+        CEGUI::System::getSingleton().destroyGUIContext(d_context);
+    }
+
+    virtual void doTest()
+    {
+        const CEGUI::Sizef size(d_context.getSurfaceSize());
+
+        for (unsigned int i = 0; i < Frames; ++i, ++d_frame)
+        {
+            if (d_work == MouseSweep)
+                d_context.injectMousePosition(
+                    static_cast<float>((d_frame * 7) % static_cast<unsigned int>(size.d_width)),
+                    static_cast<float>((d_frame * 13) % static_cast<unsigned int>(size.d_height)));
+            else if (d_work == FullRedraw)
+                d_root->invalidate(true);
+
+            d_context.injectTimePulse(1.0f / 60.0f);
+            d_context.draw();
+        }
+    }
+
+    static const unsigned int Frames = 100;
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    FrameWork d_work;
+    unsigned int d_frame;
+};
+
+BOOST_AUTO_TEST_SUITE(LayoutPerformance)
+
+BOOST_AUTO_TEST_CASE(LoadTaharezLookOverview)
+{
+    LayoutLoadPerformanceTest test("TaharezLookOverview.layout");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(LoadTreeSampleTaharez)
+{
+    LayoutLoadPerformanceTest test("TreeSampleTaharez.layout");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(IdleFramesTaharezLookOverview)
+{
+    LayoutFramePerformanceTest test("TaharezLookOverview.layout",
+        LayoutFramePerformanceTest::Idle,
+        "100x idle frame (TaharezLookOverview.layout)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(MouseSweepFramesTaharezLookOverview)
+{
+    LayoutFramePerformanceTest test("TaharezLookOverview.layout",
+        LayoutFramePerformanceTest::MouseSweep,
+        "100x frame with mouse movement (TaharezLookOverview.layout)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(FullRedrawFramesTaharezLookOverview)
+{
+    LayoutFramePerformanceTest test("TaharezLookOverview.layout",
+        LayoutFramePerformanceTest::FullRedraw,
+        "100x full redraw frame (TaharezLookOverview.layout)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
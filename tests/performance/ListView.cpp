@@ -89,7 +89,13 @@ public:
 
     virtual void sortItems()
     {
-        d_window->setSortMode(VSM_Ascending);
+        d_window->setSortMode(ViewSortMode::Ascending);
+    }
+
+    virtual void prepareSample()
+    {
+        d_window->setSortMode(ViewSortMode::NoSorting);
+        d_model.clear(true);
     }
 
     StandardItemModel d_model;
@@ -0,0 +1,330 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+PerformanceHarness* PerformanceHarness::s_instance = nullptr;
+
+namespace
+{
+//----------------------------------------------------------------------------//
+// nearest-rank percentile of sorted values
+template<typename T>
+T percentile(const std::vector<T>& sorted, double p)
+{
+    if (sorted.empty())
+        return T();
+
+    const size_t rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+T median(const std::vector<T>& sorted)
+{
+    if (sorted.empty())
+        return T();
+
+    const size_t mid = sorted.size() / 2;
+    return (sorted.size() % 2) ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2;
+}
+
+//----------------------------------------------------------------------------//
+CEGUI::String escapeJSON(const CEGUI::String& str)
+{
+    CEGUI::String result;
+    result.reserve(str.size());
+
+    for (auto c : str)
+    {
+        if (c == '"' || c == '\\')
+            result.push_back('\\');
+        result.push_back(c);
+    }
+
+    return result;
+}
+
+//----------------------------------------------------------------------------//
+// finds "key": in line and returns the position of the value, or npos.
+size_t findJSONValue(const std::string& line, const std::string& key)
+{
+    const std::string pattern("\"" + key + "\":");
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos)
+        return pos;
+
+    pos += pattern.size();
+    while (pos < line.size() && line[pos] == ' ')
+        ++pos;
+
+    return pos;
+}
+
+//----------------------------------------------------------------------------//
+bool readJSONString(const std::string& line, const std::string& key, std::string& value)
+{
+    size_t pos = findJSONValue(line, key);
+    if (pos == std::string::npos || pos >= line.size() || line[pos] != '"')
+        return false;
+
+    value.clear();
+    for (++pos; pos < line.size() && line[pos] != '"'; ++pos)
+    {
+        if (line[pos] == '\\' && pos + 1 < line.size())
+            ++pos;
+        value += line[pos];
+    }
+
+    return pos < line.size();
+}
+
+//----------------------------------------------------------------------------//
+template<typename T>
+bool readJSONNumber(const std::string& line, const std::string& key, T& value)
+{
+    const size_t pos = findJSONValue(line, key);
+    if (pos == std::string::npos)
+        return false;
+
+    std::istringstream stream(line.substr(pos));
+    return static_cast<bool>(stream >> value);
+}
+
+//----------------------------------------------------------------------------//
+bool readArgument(const std::string& arg, const std::string& name, std::string& value)
+{
+    const std::string prefix("--" + name + "=");
+    if (arg.compare(0, prefix.size(), prefix) != 0)
+        return false;
+
+    value = arg.substr(prefix.size());
+    return true;
+}
+
+}
+
+//----------------------------------------------------------------------------//
+PerformanceStatistics PerformanceStatistics::compute(
+    std::vector<double> times,
+    std::vector<std::uint64_t> allocations,
+    std::vector<std::uint64_t> allocatedBytes)
+{
+    PerformanceStatistics stats;
+    stats.d_sampleCount = times.size();
+
+    if (times.empty())
+        return stats;
+
+    std::sort(times.begin(), times.end());
+    std::sort(allocations.begin(), allocations.end());
+    std::sort(allocatedBytes.begin(), allocatedBytes.end());
+
+    stats.d_min = times.front();
+    stats.d_median = median(times);
+    stats.d_p95 = percentile(times, 0.95);
+    stats.d_p99 = percentile(times, 0.99);
+
+    double sum = 0;
+    for (double time : times)
+        sum += time;
+    stats.d_mean = sum / times.size();
+
+    double variance = 0;
+    for (double time : times)
+        variance += (time - stats.d_mean) * (time - stats.d_mean);
+    stats.d_stdDev = std::sqrt(variance / times.size());
+
+    stats.d_allocations = median(allocations);
+    stats.d_allocatedBytes = median(allocatedBytes);
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------//
+PerformanceHarness::PerformanceHarness() :
+    d_warmupRuns(1),
+    d_sampleCount(10),
+    d_outputFile("performance-test-results.json"),
+    d_timeThreshold(5),
+    d_allocationThreshold(0)
+{
+    s_instance = this;
+
+    parseArguments(boost::unit_test::framework::master_test_suite().argc,
+                   boost::unit_test::framework::master_test_suite().argv);
+
+    if (!d_baselineFile.empty())
+        loadBaseline();
+}
+
+//----------------------------------------------------------------------------//
+PerformanceHarness::~PerformanceHarness()
+{
+    writeReport();
+    s_instance = nullptr;
+}
+
+//----------------------------------------------------------------------------//
+PerformanceHarness& PerformanceHarness::getSingleton()
+{
+    return *s_instance;
+}
+
+//----------------------------------------------------------------------------//
+void PerformanceHarness::parseArguments(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg(argv[i]);
+        std::string value;
+
+        if (readArgument(arg, "warmup", value))
+            d_warmupRuns = static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10));
+        else if (readArgument(arg, "samples", value))
+            d_sampleCount = std::max(1u, static_cast<unsigned int>(std::strtoul(value.c_str(), nullptr, 10)));
+        else if (readArgument(arg, "output", value))
+            d_outputFile = value;
+        else if (readArgument(arg, "baseline", value))
+            d_baselineFile = value;
+        else if (readArgument(arg, "threshold", value))
+            d_timeThreshold = std::strtod(value.c_str(), nullptr);
+        else if (readArgument(arg, "alloc-threshold", value))
+            d_allocationThreshold = std::strtod(value.c_str(), nullptr);
+        else if (arg != "--")
+            std::cout << "Ignoring unknown argument " << arg << std::endl;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void PerformanceHarness::loadBaseline()
+{
+    std::ifstream fin(d_baselineFile.c_str());
+    if (!fin)
+    {
+        std::cout << "Could not open baseline " << d_baselineFile << std::endl;
+        return;
+    }
+
+    // reads the format written by writeReport: one result object per line.
+    std::string line;
+    while (std::getline(fin, line))
+    {
+        std::string name;
+        if (!readJSONString(line, "name", name))
+            continue;
+
+        PerformanceStatistics& stats = d_baseline[CEGUI::String(name)];
+        readJSONNumber(line, "samples", stats.d_sampleCount);
+        readJSONNumber(line, "min_ms", stats.d_min);
+        readJSONNumber(line, "median_ms", stats.d_median);
+        readJSONNumber(line, "p95_ms", stats.d_p95);
+        readJSONNumber(line, "p99_ms", stats.d_p99);
+        readJSONNumber(line, "mean_ms", stats.d_mean);
+        readJSONNumber(line, "stddev_ms", stats.d_stdDev);
+        readJSONNumber(line, "allocations", stats.d_allocations);
+        readJSONNumber(line, "allocated_bytes", stats.d_allocatedBytes);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void PerformanceHarness::addResult(const CEGUI::String& testName,
+                                   const PerformanceStatistics& stats)
+{
+    d_results.push_back(std::make_pair(testName, stats));
+
+    if (d_baselineFile.empty())
+        return;
+
+    const std::map<CEGUI::String, PerformanceStatistics>::const_iterator baseline =
+        d_baseline.find(testName);
+    if (baseline == d_baseline.end())
+    {
+        std::cout << "  not in baseline" << std::endl;
+        return;
+    }
+
+    const double timeChange = baseline->second.d_median > 0 ?
+        (stats.d_median / baseline->second.d_median - 1) * 100 : 0;
+    const double allocationChange = baseline->second.d_allocations > 0 ?
+        (static_cast<double>(stats.d_allocations) / baseline->second.d_allocations - 1) * 100 :
+        (stats.d_allocations > 0 ? 100 : 0);
+
+    std::cout << "  " << std::showpos << std::fixed << std::setprecision(1)
+              << timeChange << "% time, " << allocationChange
+              << "% allocations compared to baseline"
+              << std::noshowpos << std::defaultfloat << std::setprecision(6) << std::endl;
+
+    BOOST_CHECK_MESSAGE(timeChange <= d_timeThreshold,
+        testName << ": median time regressed by " << timeChange << "% ("
+        << baseline->second.d_median << " ms -> " << stats.d_median << " ms)");
+    BOOST_CHECK_MESSAGE(allocationChange <= d_allocationThreshold,
+        testName << ": allocations regressed by " << allocationChange << "% ("
+        << baseline->second.d_allocations << " -> " << stats.d_allocations << ")");
+}
+
+//----------------------------------------------------------------------------//
+void PerformanceHarness::writeReport() const
+{
+    if (d_results.empty())
+        return;
+
+    std::ofstream fout(d_outputFile.c_str(), std::ofstream::out | std::ofstream::trunc);
+    fout << std::setprecision(9);
+
+    fout << "{\n  \"warmup\": " << d_warmupRuns << ",\n  \"results\": [\n";
+
+    for (size_t i = 0; i < d_results.size(); ++i)
+    {
+        const PerformanceStatistics& stats = d_results[i].second;
+
+        fout << "    { \"name\": \"" << escapeJSON(d_results[i].first) << "\""
+             << ", \"samples\": " << stats.d_sampleCount
+             << ", \"min_ms\": " << stats.d_min
+             << ", \"median_ms\": " << stats.d_median
+             << ", \"p95_ms\": " << stats.d_p95
+             << ", \"p99_ms\": " << stats.d_p99
+             << ", \"mean_ms\": " << stats.d_mean
+             << ", \"stddev_ms\": " << stats.d_stdDev
+             << ", \"allocations\": " << stats.d_allocations
+             << ", \"allocated_bytes\": " << stats.d_allocatedBytes
+             << " }" << (i + 1 < d_results.size() ? "," : "") << "\n";
+    }
+
+    fout << "  ]\n}\n";
+}
+
+BOOST_GLOBAL_FIXTURE(PerformanceHarness);
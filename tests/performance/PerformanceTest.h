@@ -27,18 +27,109 @@
 #ifndef _CEGUITestsPerformanceTest_h_
 #define _CEGUITestsPerformanceTest_h_
 
+#include "AllocationCounter.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
 #include "CEGUI/WindowManager.h"
 
-#include <boost/timer/timer.hpp>
-
+#include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+/*!
+\brief
+    Summary of the samples taken by one performance test. Times are in
+    milliseconds per sample; allocation figures are the median per sample.
+*/
+struct PerformanceStatistics
+{
+    size_t d_sampleCount = 0;
+    double d_min = 0;
+    double d_median = 0;
+    double d_p95 = 0;
+    double d_p99 = 0;
+    double d_mean = 0;
+    double d_stdDev = 0;
+    std::uint64_t d_allocations = 0;
+    std::uint64_t d_allocatedBytes = 0;
+
+    //! Compute the statistics of the given per-sample measurements.
+    static PerformanceStatistics compute(std::vector<double> times,
+                                         std::vector<std::uint64_t> allocations,
+                                         std::vector<std::uint64_t> allocatedBytes);
+};
+
+/*!
+\brief
+    Global fixture holding the settings of a performance test run and the
+    results of all tests.
+
+    The settings are read from the command line arguments that follow "--"
+    (which Boost.Test passes through unchanged):
+    - --warmup=N       untimed runs before sampling (default 1)
+    - --samples=N      number of timed samples (default 10)
+    - --output=FILE    JSON report written at exit
+                       (default performance-test-results.json)
+    - --baseline=FILE  JSON report of an earlier run to compare against
+    - --threshold=P    allowed increase of the median time over the baseline,
+                       in percent (default 5)
+    - --alloc-threshold=P  allowed increase of the allocations per sample over
+                       the baseline, in percent (default 0)
+
+    A test whose median time or allocation count exceeds its baseline by more
+    than the threshold fails. Tests that are missing from the baseline are
+    only reported.
+*/
+class PerformanceHarness
+{
+public:
+    PerformanceHarness();
+    ~PerformanceHarness();
+
+    //! Return the harness of the running test program.
+    static PerformanceHarness& getSingleton();
+
+    unsigned int getWarmupRuns() const { return d_warmupRuns; }
+    unsigned int getSampleCount() const { return d_sampleCount; }
+
+    //! Record the result of a test and compare it with the baseline.
+    void addResult(const CEGUI::String& testName, const PerformanceStatistics& stats);
+
+private:
+    void parseArguments(int argc, char** argv);
+    void loadBaseline();
+    void writeReport() const;
+
+    unsigned int d_warmupRuns;
+    unsigned int d_sampleCount;
+    std::string d_outputFile;
+    std::string d_baselineFile;
+    double d_timeThreshold;
+    double d_allocationThreshold;
+
+    std::map<CEGUI::String, PerformanceStatistics> d_baseline;
+    std::vector<std::pair<CEGUI::String, PerformanceStatistics> > d_results;
+
+    static PerformanceHarness* s_instance;
+};
 
 /*!
 \brief
     General structure of a performance test.
 
-    It will print to console the total running time in seconds, and output the
-    result(s), by appending them in the performance-test-results.csv file.
+    execute runs the test a few times to warm up caches and then takes a
+    number of timed samples, counting the heap allocations made by each. It
+    prints the median, 95th and 99th percentile times and the allocations per
+    sample and hands them to the PerformanceHarness, which writes them to the
+    JSON report and compares them with the baseline.
+
+    doTest is called once per sample, so it must leave the test in a state in
+    which it can run again. Any state that needs resetting can be reset in
+    prepareSample, which is not timed.
 */
 class PerformanceTest
 {
@@ -54,40 +145,63 @@ public:
         std::cout
             << "Running performance test " << d_testName << "..." << std::endl;
 
-        boost::timer::auto_cpu_timer timer;
+        PerformanceHarness& harness = PerformanceHarness::getSingleton();
 
-        doTest();
+        for (unsigned int i = 0; i < harness.getWarmupRuns(); ++i)
+        {
+            prepareSample();
+            doTest();
+        }
 
-        logRunningTime(boost::timer::format(timer.elapsed(), timer.places(), "%u, %w"));
-    }
+        const unsigned int sampleCount = harness.getSampleCount();
+        std::vector<double> times;
+        std::vector<std::uint64_t> allocations;
+        std::vector<std::uint64_t> allocatedBytes;
+        times.reserve(sampleCount);
+        allocations.reserve(sampleCount);
+        allocatedBytes.reserve(sampleCount);
 
-protected:
-    virtual void doTest() = 0;
+        for (unsigned int i = 0; i < sampleCount; ++i)
+        {
+            prepareSample();
 
-private:
-    void logRunningTime(std::string result)
-    {
-        std::ofstream fout("performance-test-results.csv",
-            std::ofstream::out | std::ofstream::app);
+            AllocationCounter::reset();
+            const std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
 
-        // fill column names if file is empty.
-        fout.seekp(0, std::ios::end);
-        const std::streamoff length = fout.tellp();
-        if (length == 0)
-        {
-            fout << "test name, user time (seconds), wall time (seconds)" << std::endl;
+            doTest();
+
+            const std::chrono::steady_clock::time_point end =
+                std::chrono::steady_clock::now();
+            allocations.push_back(AllocationCounter::getAllocationCount());
+            allocatedBytes.push_back(AllocationCounter::getAllocatedBytes());
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
         }
 
-        fout << d_testName << ", " << result << std::endl;
-        fout.close();
+        const PerformanceStatistics stats(
+            PerformanceStatistics::compute(times, allocations, allocatedBytes));
+
+        std::cout << "  median " << stats.d_median << " ms, p95 " << stats.d_p95
+                  << " ms, p99 " << stats.d_p99 << " ms, " << stats.d_allocations
+                  << " allocations (" << stats.d_allocatedBytes << " bytes) per sample"
+                  << std::endl;
+
+        harness.addResult(d_testName, stats);
     }
+
+protected:
+    virtual void doTest() = 0;
+
+    //! Reset any state changed by the previous sample. Not timed.
+    virtual void prepareSample() {}
 };
 
 /*!
 \brief
     Generic test on a Window. It will automatically create the specified
-    window type and set the renderer on it, so that the rendering phase's logic
-    is tested as well (using the NullRenderer - so no actual rendering is done).
+    window type as the root of its own GUIContext and set the renderer on it,
+    so that the rendering phase's logic is tested as well (using the
+    NullRenderer - so no actual rendering is done).
 */
 template<typename TWindow>
 class WindowPerformanceTest : public PerformanceTest
@@ -95,12 +209,23 @@ class WindowPerformanceTest : public PerformanceTest
 public:
     WindowPerformanceTest(CEGUI::String window_type, CEGUI::String renderer) :
         PerformanceTest(window_type),
+        d_context(CEGUI::System::getSingleton().createGUIContext(
+            CEGUI::System::getSingleton().getRenderer()->getDefaultRenderTarget())),
         d_window(0)
     {
         d_window = static_cast<TWindow*>(
             CEGUI::WindowManager::getSingleton().createWindow(
                 window_type, window_type + "-perf-test"));
         d_window->setWindowRenderer(renderer);
+        d_window->setFont("DejaVuSans-12");
+        d_context.setRootWindow(d_window);
+    }
+
+    ~WindowPerformanceTest()
+    {
+        d_context.setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_window);
+        CEGUI::System::getSingleton().destroyGUIContext(d_context);
     }
 
     virtual void render()
@@ -108,6 +233,7 @@ public:
         d_window->draw();
     }
 
+    CEGUI::GUIContext& d_context;
     TWindow* d_window;
 };
 
@@ -46,6 +46,15 @@ public:
         d_window->setModel(&d_model);
     }
 
+    virtual void prepareSample()
+    {
+        // detach the model while it is emptied so the view starts afresh
+        d_window->setModel(nullptr);
+        d_window->setSortMode(ViewSortMode::NoSorting);
+        d_model.clear(true);
+        d_window->setModel(&d_model);
+    }
+
     virtual void doTest()
     {
         size_t id = 0;
@@ -77,7 +86,7 @@ public:
         }
         d_window->draw();
 
-        d_window->setSortMode(VSM_Ascending);
+        d_window->setSortMode(ViewSortMode::Ascending);
     }
 
     StandardItemModel d_model;
@@ -0,0 +1,180 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/VertexBufferArena.h"
+#include "CEGUI/Window.h"
+
+#include <iterator>
+#include <unordered_map>
+
+/*!
+\brief
+    Feeds the geometry of a GUIContext with 10000 buttons into the vertex
+    upload path of a big-buffer renderer every frame, either by copying all
+    vertices (as the OpenGL3 renderer used to) or through a VertexBufferArena
+    that only copies what changed, and reports the bytes copied per frame.
+*/
+class VertexUploadPerformanceTest : public PerformanceTest
+{
+public:
+    VertexUploadPerformanceTest(bool useArena, unsigned int changedWindowsPerFrame,
+                                CEGUI::String test_name) :
+        PerformanceTest(test_name),
+        d_context(CEGUI::System::getSingleton().createGUIContext(
+            CEGUI::System::getSingleton().getRenderer()->getDefaultRenderTarget())),
+        d_useArena(useArena),
+        d_changedWindowsPerFrame(changedWindowsPerFrame),
+        d_arena(CEGUI::GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT),
+        d_bytesCopied(0),
+        d_framesRun(0)
+    {
+        CEGUI::WindowManager& wmgr = CEGUI::WindowManager::getSingleton();
+
+        d_root = wmgr.createWindow("DefaultWindow");
+        d_context.setRootWindow(d_root);
+
+        for (unsigned int i = 0; i < 10000; ++i)
+        {
+            CEGUI::Window* button = d_root->createChild("TaharezLook/Button");
+            button->setArea(CEGUI::UDim(0, (i % 100) * 8.0f), CEGUI::UDim(0, (i / 100) * 6.0f),
+                            CEGUI::UDim(0, 8.0f), CEGUI::UDim(0, 6.0f));
+            d_windows.push_back(button);
+        }
+
+        d_context.draw();
+        uploadFrame();
+        d_bytesCopied = 0;
+    }
+
+    ~VertexUploadPerformanceTest()
+    {
+        std::cout << "  bytes copied per frame: " << d_bytesCopied / (d_framesRun ? d_framesRun : 1) << std::endl;
+
+        d_context.setRootWindow(nullptr);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::System::getSingleton().destroyGUIContext(d_context);
+    }
+
+    virtual void doTest()
+    {
+        for (unsigned int frame = 0; frame < Frames; ++frame)
+        {
+            for (unsigned int i = 0; i < d_changedWindowsPerFrame; ++i)
+            {
+                CEGUI::Window* window = d_windows[(frame * 37 + i) % d_windows.size()];
+                window->invalidate();
+
+                // what the renderer's GeometryBuffers do in onGeometryChanged
+                for (CEGUI::GeometryBuffer* buffer : window->getGeometryBuffers())
+                    d_allocations[buffer].markAllDirty();
+            }
+
+            d_context.draw();
+            uploadFrame();
+        }
+
+        d_framesRun += Frames;
+    }
+
+    void uploadFrame()
+    {
+        if (!d_useArena)
+            d_vertexData.clear();
+
+        for (CEGUI::Window* window : d_windows)
+        {
+            for (CEGUI::GeometryBuffer* buffer : window->getGeometryBuffers())
+            {
+                const CEGUI::GeometryBuffer::VertexData& data = buffer->getVertexData();
+                if (data.empty() || buffer->getVertexAttributeElementCount() !=
+                        static_cast<int>(CEGUI::GeometryBuffer::TEXTURED_VERTEX_FLOAT_COUNT))
+                    continue;
+
+                if (d_useArena)
+                    d_arena.update(d_allocations[buffer], data.data(), data.size());
+                else
+                {
+                    std::copy(data.begin(), data.end(), std::back_inserter(d_vertexData));
+                    d_bytesCopied += data.size() * sizeof(float);
+                }
+            }
+        }
+
+        if (d_useArena)
+        {
+            d_arena.getUploadRanges();
+            d_arena.clearUploadRanges();
+            d_bytesCopied += d_arena.getStatistics().bytesCopied;
+            d_arena.resetStatistics();
+        }
+    }
+
+    static const unsigned int Frames = 1000;
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    std::vector<CEGUI::Window*> d_windows;
+    bool d_useArena;
+    unsigned int d_changedWindowsPerFrame;
+    std::vector<float> d_vertexData;
+    CEGUI::VertexBufferArena d_arena;
+    std::unordered_map<CEGUI::GeometryBuffer*, CEGUI::VertexBufferArena::Allocation> d_allocations;
+    size_t d_bytesCopied;
+    size_t d_framesRun;
+};
+
+BOOST_AUTO_TEST_SUITE(VertexUploadPerformance)
+
+BOOST_AUTO_TEST_CASE(IdleFullCopy)
+{
+    VertexUploadPerformanceTest test(false, 0,
+        "1000x full vertex copy, idle UI (10000 windows)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(IdleArena)
+{
+    VertexUploadPerformanceTest test(true, 0,
+        "1000x arena vertex update, idle UI (10000 windows)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(OneChangedArena)
+{
+    VertexUploadPerformanceTest test(true, 1,
+        "1000x arena vertex update, 1 changed window (10000 windows)");
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -31,10 +31,12 @@
 #include "CEGUI/Window.h"
 #include "CEGUI/UVector.h"
 
+#include <functional>
+
 class DefaultWindowPerformanceTest : public PerformanceTest
 {
 public:
-    DefaultWindowPerformanceTest(void (CEGUI::Window::*function)(), CEGUI::String test_name) :
+    DefaultWindowPerformanceTest(std::function<void(CEGUI::Window*)> function, CEGUI::String test_name) :
         PerformanceTest(test_name),
         d_function(function)
     {
@@ -54,14 +56,14 @@ public:
         {
             for (unsigned int i = 0; i < 100; ++i)
             {
-                (d_windows[i]->*d_function)();
+                d_function(d_windows[i]);
             }
         }
     }
 
     CEGUI::Window* d_root;
     std::vector<CEGUI::Window*> d_windows;
-    void (CEGUI::Window::* d_function)();
+    std::function<void(CEGUI::Window*)> d_function;
 };
 
 BOOST_AUTO_TEST_SUITE(WindowPerformance)
@@ -0,0 +1,135 @@
+/***********************************************************************
+ *    created:    Mon Oct 19 2026
+ *    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "PerformanceTest.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include "CEGUI/Window.h"
+
+#if defined(__GLIBC__)
+#   include <malloc.h>
+#endif
+
+/*!
+\brief
+    Measures the heap memory used per Window, once with the property tables
+    shared between windows of the same type and look (the default) and once
+    with every window holding a private copy, as it did before property
+    tables were shared.
+*/
+class WindowMemoryTest : public PerformanceTest
+{
+public:
+    WindowMemoryTest(const CEGUI::String& windowType, bool privateTables) :
+        PerformanceTest(windowType + (privateTables ?
+            " memory per window (private property tables)" :
+            " memory per window (shared property tables)")),
+        d_windowType(windowType),
+        d_privateTables(privateTables)
+    {
+    }
+
+    virtual void doTest()
+    {
+        static const CEGUI::String dummyName("WindowMemoryTestProperty");
+        static CEGUI::TplWindowProperty<CEGUI::Window, float> dummy(dummyName, "",
+            "WindowMemoryTest", &CEGUI::Window::setAlpha, &CEGUI::Window::getAlpha, 1.f);
+
+        const size_t windowCount = 2000;
+
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        CEGUI::Window* root = winMgr.createWindow("DefaultWindow");
+
+        const size_t before = getAllocatedBytes();
+
+        for (size_t i = 0; i < windowCount; ++i)
+        {
+            CEGUI::Window* window = winMgr.createWindow(d_windowType);
+            root->addChild(window);
+
+            // adding and removing a property unshares the table
+            if (d_privateTables)
+            {
+                window->addProperty(&dummy);
+                window->removeProperty(dummyName);
+            }
+        }
+
+        const size_t after = getAllocatedBytes();
+
+        winMgr.destroyWindow(root);
+        winMgr.cleanDeadPool();
+
+        if (after > before)
+            std::cout << "  " << (after - before) / windowCount << " bytes per window" << std::endl;
+        else
+            std::cout << "  heap usage not available on this platform" << std::endl;
+    }
+
+private:
+    static size_t getAllocatedBytes()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+        return static_cast<size_t>(mallinfo().uordblks);
+#else
+        return 0;
+#endif
+    }
+
+    CEGUI::String d_windowType;
+    bool d_privateTables;
+};
+
+BOOST_AUTO_TEST_SUITE(WindowMemory)
+
+BOOST_AUTO_TEST_CASE(ButtonSharedTables)
+{
+    WindowMemoryTest test("TaharezLook/Button", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(ButtonPrivateTables)
+{
+    WindowMemoryTest test("TaharezLook/Button", true);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(FrameWindowSharedTables)
+{
+    WindowMemoryTest test("TaharezLook/FrameWindow", false);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_CASE(FrameWindowPrivateTables)
+{
+    WindowMemoryTest test("TaharezLook/FrameWindow", true);
+    test.execute();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
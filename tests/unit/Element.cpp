@@ -27,6 +27,7 @@
 
 #include "CEGUI/Element.h"
 #include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
 
 #include <boost/test/unit_test.hpp>
 #include <boost/timer.hpp>
@@ -320,4 +321,48 @@ BOOST_AUTO_TEST_CASE(PixelAlignment)
     delete root;
 }
 
+BOOST_AUTO_TEST_CASE(AreaChangeBatch)
+{
+    CEGUI::Element* root = new CEGUI::Element();
+    root->setSize(CEGUI::USize(100.0f * CEGUI::UDim::px(), 100.0f * CEGUI::UDim::px()));
+    CEGUI::Element* child = new CEGUI::Element();
+    root->addChild(child);
+    child->setSize(CEGUI::USize(50.0f * CEGUI::UDim::percent(), 50.0f * CEGUI::UDim::percent()));
+
+    int moveCount = 0;
+    int sizeCount = 0;
+    child->subscribeEvent(CEGUI::Element::EventMoved, [&moveCount]() { ++moveCount; });
+    child->subscribeEvent(CEGUI::Element::EventSized, [&sizeCount]() { ++sizeCount; });
+
+    {
+        CEGUI::Element::AreaChangeBatch batch;
+
+        for (int i = 1; i <= 10; ++i)
+            child->setPosition(CEGUI::UVector2(i * CEGUI::UDim::px(), i * CEGUI::UDim::px()));
+        root->setSize(CEGUI::USize(200.0f * CEGUI::UDim::px(), 200.0f * CEGUI::UDim::px()));
+
+        // nothing is applied until the batch ends
+        BOOST_CHECK_EQUAL(child->getUnclippedOuterRect().get(), CEGUI::Rectf(0, 0, 50, 50));
+        BOOST_CHECK_EQUAL(moveCount, 0);
+    }
+
+    BOOST_CHECK_EQUAL(child->getUnclippedOuterRect().get(), CEGUI::Rectf(10, 10, 110, 110));
+    BOOST_CHECK_EQUAL(moveCount, 1);
+    BOOST_CHECK_EQUAL(sizeCount, 1);
+
+    // an element destroyed inside a batch is forgotten
+    {
+        CEGUI::Element::AreaChangeBatch batch;
+        CEGUI::Element* temp = new CEGUI::Element();
+        temp->setSize(CEGUI::USize(10.0f * CEGUI::UDim::px(), 10.0f * CEGUI::UDim::px()));
+        delete temp;
+    }
+
+    BOOST_CHECK(!CEGUI::Element::isBatchingAreaChanges());
+    BOOST_CHECK_THROW(CEGUI::Element::endAreaChangeBatch(), CEGUI::InvalidRequestException);
+
+    delete child;
+    delete root;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
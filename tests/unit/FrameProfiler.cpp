@@ -0,0 +1,136 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/FrameProfiler.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+//! Return the number of occurrences of \a text in \a str.
+size_t countOccurrences(const std::string& str, const std::string& text)
+{
+    size_t count = 0;
+    for (size_t pos = str.find(text); pos != std::string::npos; pos = str.find(text, pos + 1))
+        ++count;
+    return count;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(FrameProfiler)
+
+BOOST_AUTO_TEST_CASE(CallTree)
+{
+    using CEGUI::FrameProfiler;
+    FrameProfiler::clearFrames();
+    FrameProfiler::setActive(true);
+
+    {
+        CEGUI::ProfileScope frame("Test::frame");
+        for (int i = 0; i < 3; ++i)
+        {
+            CEGUI::ProfileScope window("Test::window", CEGUI::String(i == 2 ? "Type/B" : "Type/A"));
+            CEGUI::ProfileScope text("Test::text");
+        }
+    }
+
+    // scopes on other threads become roots
+    std::thread([] { CEGUI::ProfileScope worker("Test::worker"); }).join();
+
+    FrameProfiler::markFrameEnd();
+    FrameProfiler::setActive(false);
+
+    // not recorded while inactive
+    {
+        CEGUI::ProfileScope ignored("Test::ignored");
+    }
+    FrameProfiler::markFrameEnd();
+
+    const std::vector<FrameProfiler::Frame> frames = FrameProfiler::getFrames();
+    BOOST_REQUIRE_EQUAL(frames.size(), 1u);
+
+    const FrameProfiler::Frame& frame = frames.back();
+    BOOST_CHECK_EQUAL(frame.d_events.size(), 8u);
+    BOOST_CHECK_EQUAL(frame.d_droppedEvents, 0u);
+
+    // frame, window A, window B, text below each window and the worker
+    const std::vector<FrameProfiler::ScopeStatistics>& tree = frame.d_callTree;
+    BOOST_REQUIRE_EQUAL(tree.size(), 6u);
+    BOOST_CHECK_EQUAL(tree[0].d_name, "Test::frame");
+    BOOST_CHECK_EQUAL(tree[0].d_parent, FrameProfiler::NoParent);
+    BOOST_CHECK_EQUAL(tree[1].d_parent, 0u);
+    BOOST_CHECK_EQUAL(tree[1].d_calls, 2u);
+    BOOST_CHECK(FrameProfiler::getDetail(tree[1].d_detail) == "Type/A");
+    BOOST_CHECK_EQUAL(tree.back().d_name, "Test::worker");
+    BOOST_CHECK_EQUAL(tree.back().d_parent, FrameProfiler::NoParent);
+    BOOST_CHECK_LE(tree[0].d_selfTime, tree[0].d_totalTime);
+    BOOST_CHECK_LE(tree[0].d_totalTime, frame.d_duration);
+
+    const std::vector<FrameProfiler::ScopeStatistics> totals = FrameProfiler::getScopeTotals(frame);
+    BOOST_REQUIRE_EQUAL(totals.size(), 5u);
+    for (const FrameProfiler::ScopeStatistics& total : totals)
+        if (std::strcmp(total.d_name, "Test::text") == 0)
+            BOOST_CHECK_EQUAL(total.d_calls, 3u);
+
+    std::ostringstream trace;
+    FrameProfiler::writeChromeTrace(trace);
+    BOOST_CHECK_EQUAL(countOccurrences(trace.str(), "\"ph\":\"X\""), 9u);
+    BOOST_CHECK_EQUAL(countOccurrences(trace.str(), "\"detail\":\"Type/A\""), 2u);
+    BOOST_CHECK_EQUAL(countOccurrences(trace.str(), "Test::ignored"), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(History)
+{
+    using CEGUI::FrameProfiler;
+    FrameProfiler::clearFrames();
+    FrameProfiler::setFrameHistorySize(4);
+    FrameProfiler::setActive(true);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        CEGUI::ProfileScope scope("Test::frame");
+        FrameProfiler::markFrameEnd();
+    }
+
+    FrameProfiler::setActive(false);
+
+    const std::vector<FrameProfiler::Frame> frames = FrameProfiler::getFrames();
+    BOOST_REQUIRE_EQUAL(frames.size(), 4u);
+    BOOST_CHECK_EQUAL(frames.back().d_number, frames.front().d_number + 3);
+    // scopes still open at the end of a frame are cut off there
+    BOOST_CHECK_EQUAL(frames.back().d_events.size(), 1u);
+    BOOST_CHECK_EQUAL(frames.back().d_events[0].d_duration + frames.back().d_events[0].d_start,
+                      frames.back().d_start + frames.back().d_duration);
+
+    FrameProfiler::setFrameHistorySize(120);
+    FrameProfiler::clearFrames();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,235 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/CEGUI.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+
+using namespace CEGUI;
+
+/*
+ * Used to draw a small window hierarchy into the default GUIContext.
+ */
+struct GUIContextFixture
+{
+    GUIContextFixture() :
+        d_guiContext(&System::getSingleton().createGUIContext(
+            System::getSingleton().getRenderer()->getDefaultRenderTarget()))
+    {
+        System::getSingleton().notifyDisplaySizeChanged(Sizef(200, 200));
+        d_guiContext->setCursorPosition(glm::vec2(0, 0));
+
+        WindowManager& winMgr = WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_panel1 = winMgr.createWindow("DefaultWindow");
+        d_panel2 = winMgr.createWindow("DefaultWindow");
+        d_root->setSize(USize(cegui_absdim(200), cegui_absdim(200)));
+        d_panel1->setArea(URect(cegui_absdim(0), cegui_absdim(0),
+                                cegui_absdim(100), cegui_absdim(100)));
+        d_panel2->setArea(URect(cegui_absdim(100), cegui_absdim(0),
+                                cegui_absdim(200), cegui_absdim(100)));
+        d_root->addChild(d_panel1);
+        d_root->addChild(d_panel2);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            d_buttons[i] = winMgr.createWindow("TaharezLook/Button");
+            d_buttons[i]->setArea(URect(cegui_absdim(0), cegui_absdim(i * 20.0f),
+                                        cegui_absdim(50), cegui_absdim(i * 20.0f + 15)));
+            (i % 2 ? d_panel2 : d_panel1)->addChild(d_buttons[i]);
+        }
+
+        d_dragContainer = static_cast<DragContainer*>(
+            winMgr.createWindow("DragContainer"));
+        d_dragContainer->setArea(URect(cegui_absdim(0), cegui_absdim(120),
+                                       cegui_absdim(50), cegui_absdim(150)));
+        Window* dragged = winMgr.createWindow("TaharezLook/Button");
+        dragged->setSize(USize(cegui_reldim(1), cegui_reldim(1)));
+        dragged->setCursorPassThroughEnabled(true);
+        d_dragContainer->addChild(dragged);
+        d_root->addChild(d_dragContainer);
+
+        d_guiContext->setRootWindow(d_root);
+    }
+
+    ~GUIContextFixture()
+    {
+        d_guiContext->setRetainedDrawListEnabled(false);
+        d_guiContext->setAutoCachingEnabled(false);
+        d_guiContext->setRootWindow(nullptr);
+        System::getSingleton().destroyGUIContext(*d_guiContext);
+        WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    typedef std::map<RenderQueueID, RenderQueue::BufferList> QueueContents;
+
+    QueueContents getQueueContents()
+    {
+        QueueContents contents;
+        for (auto& queue : d_guiContext->getRenderQueueList())
+            contents[queue.first] = queue.second.getBuffers();
+
+        return contents;
+    }
+
+    /*
+     * Draw the pending changes, then check that a full redraw queues the same
+     * buffers in the same order.
+     */
+    void checkMatchesFullRedraw()
+    {
+        d_guiContext->draw();
+        const QueueContents retained(getQueueContents());
+        BOOST_CHECK(!retained.at(RenderQueueID::Base).empty());
+
+        d_guiContext->setRetainedDrawListEnabled(false);
+        d_guiContext->draw();
+        BOOST_CHECK(getQueueContents() == retained);
+
+        d_guiContext->setRetainedDrawListEnabled(true);
+        d_guiContext->draw();
+        BOOST_CHECK(getQueueContents() == retained);
+    }
+
+    const GUIContext::AutoCacheEntry* getAutoCacheEntry(const Window* window)
+    {
+        for (const auto& entry : d_guiContext->getAutoCacheEntries())
+            if (entry.window == window)
+                return &entry;
+
+        return nullptr;
+    }
+
+    void drawFrames(int count)
+    {
+        for (int i = 0; i < count; ++i)
+            d_guiContext->draw();
+    }
+
+    GUIContext* d_guiContext;
+    Window* d_root;
+    Window* d_panel1;
+    Window* d_panel2;
+    Window* d_buttons[4];
+    DragContainer* d_dragContainer;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GUIContext, GUIContextFixture)
+
+BOOST_AUTO_TEST_CASE(RetainedDrawList)
+{
+    d_guiContext->setRetainedDrawListEnabled(true);
+    BOOST_CHECK(d_guiContext->isRetainedDrawListEnabled());
+    d_guiContext->draw();
+
+    // content changes only
+    d_buttons[0]->invalidate();
+    d_buttons[3]->setText("changed");
+    checkMatchesFullRedraw();
+
+    d_buttons[1]->hide();
+    d_buttons[2]->invalidate();
+    checkMatchesFullRedraw();
+
+    d_buttons[1]->show();
+    d_buttons[1]->invalidate();
+    checkMatchesFullRedraw();
+
+    // reparent
+    d_panel1->removeChild(d_buttons[2]);
+    d_panel2->addChild(d_buttons[2]);
+    d_buttons[2]->invalidate();
+    checkMatchesFullRedraw();
+
+    // drag, which draws the dragged window on top of everything else
+    d_guiContext->injectMousePosition(25, 135);
+    d_guiContext->injectMouseButtonDown(MouseButton::Left);
+    d_guiContext->injectMousePosition(60, 170);
+    BOOST_REQUIRE(d_dragContainer->isBeingDragged());
+    d_dragContainer->getChildAtIndex(0)->invalidate();
+    checkMatchesFullRedraw();
+
+    d_guiContext->injectMousePosition(65, 175);
+    d_buttons[0]->invalidate();
+    checkMatchesFullRedraw();
+
+    d_guiContext->injectMouseButtonUp(MouseButton::Left);
+    BOOST_REQUIRE(!d_dragContainer->isBeingDragged());
+    d_buttons[3]->invalidate();
+    checkMatchesFullRedraw();
+}
+
+BOOST_AUTO_TEST_CASE(AutoCaching)
+{
+    d_guiContext->setAutoCacheEvaluationInterval(1);
+    d_guiContext->setAutoCachePromotionDelay(2);
+    d_guiContext->setAutoCacheDemotionThreshold(1);
+    d_guiContext->setAutoCacheMinVertexCount(1);
+    d_guiContext->setAutoCachingEnabled(true);
+
+    // only the panels draw enough to be cached
+    drawFrames(2);
+    BOOST_REQUIRE(getAutoCacheEntry(d_panel1));
+    d_guiContext->setAutoCacheMinVertexCount(getAutoCacheEntry(d_panel1)->vertexCount);
+
+    // promotion
+    drawFrames(4);
+    BOOST_REQUIRE(getAutoCacheEntry(d_panel1));
+    BOOST_CHECK(getAutoCacheEntry(d_panel1)->cached);
+    BOOST_CHECK(d_panel1->isUsingAutoRenderingSurface());
+    BOOST_CHECK(d_panel1->getRenderingSurface());
+    BOOST_CHECK(d_panel2->getRenderingSurface());
+    BOOST_CHECK(!getAutoCacheEntry(d_buttons[0]));
+    BOOST_CHECK(d_guiContext->getAutoCacheTextureMemory() > 0);
+
+    // demotion when the content changes
+    d_buttons[0]->invalidate();
+    drawFrames(2);
+    BOOST_CHECK(!d_panel1->isUsingAutoRenderingSurface());
+    BOOST_CHECK(!d_panel1->getRenderingSurface());
+
+    drawFrames(4);
+    BOOST_REQUIRE(d_panel1->getRenderingSurface());
+
+    // a surface enabled by the user is left alone
+    d_panel1->setUsingAutoRenderingSurface(true);
+    d_buttons[0]->invalidate();
+    drawFrames(2);
+    BOOST_CHECK(d_panel1->isUsingAutoRenderingSurface());
+    BOOST_CHECK(d_panel1->getRenderingSurface());
+    BOOST_CHECK(!getAutoCacheEntry(d_panel1));
+
+    d_guiContext->setAutoCachingEnabled(false);
+    BOOST_CHECK(d_panel1->getRenderingSurface());
+    BOOST_CHECK(!d_panel2->getRenderingSurface());
+    BOOST_CHECK_EQUAL(d_guiContext->getAutoCacheTextureMemory(), 0u);
+
+    d_panel1->setUsingAutoRenderingSurface(false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderMaterial.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+
+struct GeometryBufferFixture
+{
+    GeometryBufferFixture() :
+        d_renderer(*CEGUI::System::getSingleton().getRenderer()),
+        d_retained(d_renderer.createGeometryBufferTextured()),
+        d_fresh(d_renderer.createGeometryBufferTextured()),
+        d_texture1(d_renderer.createTexture("GeometryBufferTexture1", CEGUI::Sizef(8.f, 8.f))),
+        d_texture2(d_renderer.createTexture("GeometryBufferTexture2", CEGUI::Sizef(8.f, 8.f)))
+    {
+    }
+
+    ~GeometryBufferFixture()
+    {
+        d_renderer.destroyGeometryBuffer(d_retained);
+        d_renderer.destroyGeometryBuffer(d_fresh);
+        d_renderer.destroyTexture(d_texture1);
+        d_renderer.destroyTexture(d_texture2);
+    }
+
+    //! Replace the geometry of the buffer by a quad of the given colour.
+    static void setQuad(CEGUI::GeometryBuffer& buffer, const CEGUI::Colour& colour)
+    {
+        CEGUI::TexturedColouredVertex vertices[6];
+        for (int i = 0; i < 6; ++i)
+        {
+            vertices[i].d_position = glm::vec3(static_cast<float>(i % 2) * 10.f,
+                                               static_cast<float>(i / 2) * 10.f, 0.f);
+            vertices[i].setColour(colour);
+            vertices[i].d_texCoords = glm::vec2(0.f, 0.f);
+        }
+
+        buffer.reset();
+        buffer.appendGeometry(vertices, 6);
+    }
+
+    CEGUI::Renderer& d_renderer;
+    CEGUI::GeometryBuffer& d_retained;
+    CEGUI::GeometryBuffer& d_fresh;
+    CEGUI::Texture& d_texture1;
+    CEGUI::Texture& d_texture2;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GeometryBuffer, GeometryBufferFixture)
+
+BOOST_AUTO_TEST_CASE(UpdateFromCopiesMaterial)
+{
+    setQuad(d_retained, CEGUI::Colour(1.f, 0.f, 0.f));
+    d_retained.setMainTexture(&d_texture1);
+    d_retained.getRenderMaterial()->getShaderParamBindings()->setParameter("stale", 1.f);
+
+    setQuad(d_fresh, CEGUI::Colour(0.f, 1.f, 0.f));
+    d_fresh.setMainTexture(&d_texture2);
+    d_fresh.setTexture("overlay", &d_texture1);
+    d_fresh.getRenderMaterial()->getShaderParamBindings()->setParameter("weight", 0.25f);
+    d_fresh.setAlpha(0.5f);
+
+    // the textures differ, but are copied along with the rest of the material
+    BOOST_REQUIRE(d_retained.isLayoutCompatible(d_fresh));
+    d_retained.updateFrom(d_fresh);
+
+    BOOST_CHECK(d_retained.getVertexData() == d_fresh.getVertexData());
+    BOOST_CHECK_EQUAL(d_retained.getAlpha(), 0.5f);
+    BOOST_CHECK_EQUAL(d_retained.getMainTexture(), &d_texture2);
+    BOOST_CHECK_EQUAL(d_retained.getTexture("overlay"), &d_texture1);
+
+    const auto& retainedParams =
+        d_retained.getRenderMaterial()->getShaderParamBindings()->getShaderParameterBindings();
+    const auto& freshParams =
+        d_fresh.getRenderMaterial()->getShaderParamBindings()->getShaderParameterBindings();
+    BOOST_REQUIRE_EQUAL(retainedParams.size(), freshParams.size());
+    for (const auto& pair : freshParams)
+    {
+        const auto it = retainedParams.find(pair.first);
+        BOOST_REQUIRE(it != retainedParams.end());
+        BOOST_CHECK(it->second != pair.second);
+        BOOST_CHECK(it->second->equal(pair.second));
+    }
+
+    // the material of the retained buffer remains its own
+    d_fresh.setMainTexture(&d_texture1);
+    BOOST_CHECK_EQUAL(d_retained.getMainTexture(), &d_texture2);
+    d_retained.setMainTexture(nullptr);
+    BOOST_CHECK_EQUAL(d_fresh.getMainTexture(), &d_texture1);
+}
+
+BOOST_AUTO_TEST_CASE(UpdateFromRequiresSameLayout)
+{
+    setQuad(d_retained, CEGUI::Colour(1.f, 0.f, 0.f));
+    setQuad(d_fresh, CEGUI::Colour(0.f, 1.f, 0.f));
+    const std::vector<float> quad(d_fresh.getVertexData().begin(), d_fresh.getVertexData().end());
+    d_fresh.appendGeometry(quad.data(), quad.size());
+
+    BOOST_CHECK(!d_retained.isLayoutCompatible(d_fresh));
+    BOOST_CHECK_THROW(d_retained.updateFrom(d_fresh), CEGUI::InvalidRequestException);
+
+    CEGUI::GeometryBuffer& coloured = d_renderer.createGeometryBufferColoured();
+    BOOST_CHECK(!d_retained.isLayoutCompatible(coloured));
+    d_renderer.destroyGeometryBuffer(coloured);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,143 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/GridLayoutContainer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/XMLSerializer.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+struct GridLayoutContainerFixture
+{
+    GridLayoutContainerFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_grid = static_cast<CEGUI::GridLayoutContainer*>(winMgr.createWindow("GridLayoutContainer"));
+        d_grid->setGridDimensions(3, 2);
+
+        for (size_t i = 0; i < 3; ++i)
+            d_children[i] = winMgr.createWindow("DefaultWindow", "Child" + std::to_string(i));
+    }
+
+    ~GridLayoutContainerFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        winMgr.destroyWindow(d_grid);
+
+        for (CEGUI::Window* child : d_children)
+            if (!child->getParent())
+                winMgr.destroyWindow(child);
+    }
+
+    CEGUI::GridLayoutContainer* d_grid;
+    CEGUI::Window* d_children[3];
+};
+
+BOOST_FIXTURE_TEST_SUITE(GridLayoutContainer, GridLayoutContainerFixture)
+
+BOOST_AUTO_TEST_CASE(EmptyCellsAreNotChildren)
+{
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 0u);
+
+    d_grid->addChildToCell(d_children[0], 2, 1);
+    d_grid->addChild(d_children[1]);
+
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 2u);
+    BOOST_CHECK_EQUAL(d_grid->getActualChildCount(), 2u);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(2, 1), d_children[0]);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(0, 0), d_children[1]);
+    BOOST_CHECK(d_grid->getChildAtCell(1, 0) == nullptr);
+    BOOST_CHECK_EQUAL(d_grid->getFirstFreeIndex(), 1u);
+    BOOST_CHECK_EQUAL(d_grid->getLastBusyIndex(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(InsertionShiftsCells)
+{
+    d_grid->addChild(d_children[0]);
+    d_grid->addChild(d_children[1]);
+    d_grid->addChildAtIndex(d_children[2], 0);
+
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(0, 0), d_children[2]);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(1, 0), d_children[0]);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(2, 0), d_children[1]);
+
+    d_grid->moveChildToCell(d_children[2], 0, 1);
+
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(0, 0), d_children[0]);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(1, 0), d_children[1]);
+    BOOST_CHECK(d_grid->getChildAtCell(2, 0) == nullptr);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(0, 1), d_children[2]);
+}
+
+BOOST_AUTO_TEST_CASE(ResizeKeepsCoordinates)
+{
+    d_grid->addChildToCell(d_children[0], 1, 1);
+    d_grid->addChildToCell(d_children[1], 2, 0);
+
+    d_grid->setGridDimensions(2, 3);
+
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 1u);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtCell(1, 1), d_children[0]);
+}
+
+BOOST_AUTO_TEST_CASE(Layout)
+{
+    d_children[0]->setSize(CEGUI::USize(cegui_absdim(10), cegui_absdim(20)));
+    d_children[1]->setSize(CEGUI::USize(cegui_absdim(30), cegui_absdim(5)));
+    d_grid->addChildToCell(d_children[0], 0, 0);
+    d_grid->addChildToCell(d_children[1], 2, 1);
+
+    d_grid->layoutIfNecessary();
+
+    BOOST_CHECK_EQUAL(d_children[1]->getPosition(), CEGUI::UVector2(cegui_absdim(10), cegui_absdim(20)));
+    BOOST_CHECK_EQUAL(d_grid->getSize(), CEGUI::USize(cegui_absdim(40), cegui_absdim(25)));
+}
+
+BOOST_AUTO_TEST_CASE(XMLRoundTrip)
+{
+    d_grid->addChildToCell(d_children[0], 1, 0);
+    d_grid->addChildToCell(d_children[1], 2, 1);
+
+    std::ostringstream stream;
+    CEGUI::XMLSerializer xml(stream);
+    d_grid->writeXMLToStream(xml);
+
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    auto loaded = static_cast<CEGUI::GridLayoutContainer*>(winMgr.loadLayoutFromString(stream.str()));
+
+    BOOST_CHECK_EQUAL(loaded->getChildCount(), 2u);
+    BOOST_CHECK(loaded->getChildAtCell(0, 0) == nullptr);
+    BOOST_REQUIRE(loaded->getChildAtCell(1, 0) != nullptr);
+    BOOST_CHECK_EQUAL(loaded->getChildAtCell(1, 0)->getName(), d_children[0]->getName());
+    BOOST_REQUIRE(loaded->getChildAtCell(2, 1) != nullptr);
+    BOOST_CHECK_EQUAL(loaded->getChildAtCell(2, 1)->getName(), d_children[1]->getName());
+
+    winMgr.destroyWindow(loaded);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,278 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+
+namespace
+{
+
+struct AtlasTestImage
+{
+    const char* d_file;
+    float d_width;
+    float d_height;
+};
+
+// small enough to be packed with the default maximum image size
+const AtlasTestImage AtlasTestImages[] =
+{
+    { "WindowsLook.png", 128.f, 128.f },
+    { "ic_launcher.png", 100.f, 100.f },
+    { "logo.png", 183.f, 89.f },
+    { "FairChar.png", 256.f, 128.f },
+    { "TaharezLook.png", 256.f, 256.f },
+};
+
+CEGUI::String getAtlasTestImageName(const AtlasTestImage& image)
+{
+    return CEGUI::String("AtlasTest/") + image.d_file;
+}
+
+void addAtlasTestImages(bool reverse)
+{
+    CEGUI::ImageManager& images = CEGUI::ImageManager::getSingleton();
+    const size_t count = sizeof(AtlasTestImages) / sizeof(AtlasTestImages[0]);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const AtlasTestImage& image = AtlasTestImages[reverse ? count - 1 - i : i];
+        images.addBitmapImageFromFile(getAtlasTestImageName(image), image.d_file);
+    }
+}
+
+void destroyAtlasTestImages()
+{
+    for (const AtlasTestImage& image : AtlasTestImages)
+        CEGUI::ImageManager::getSingleton().destroy(getAtlasTestImageName(image));
+}
+
+const CEGUI::BitmapImage& getAtlasTestImage(const AtlasTestImage& image)
+{
+    return static_cast<const CEGUI::BitmapImage&>(
+        CEGUI::ImageManager::getSingleton().get(getAtlasTestImageName(image)));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(ImageManager)
+
+BOOST_AUTO_TEST_CASE(ImageCollections)
+{
+    CEGUI::ImageManager& images = CEGUI::ImageManager::getSingleton();
+
+    images.loadImageset("WindowsLook.imageset");
+    const size_t count = images.getImageCollectionSize("WindowsLook");
+    BOOST_CHECK(count > 0);
+    BOOST_CHECK(images.isDefined("WindowsLook/Background"));
+
+    // each load is counted, so the images stay until the last unload
+    images.loadImageset("WindowsLook.imageset");
+    BOOST_CHECK_EQUAL(images.getImageCollectionSize("WindowsLook"), count);
+    images.unloadImageset("WindowsLook.imageset");
+    BOOST_CHECK(images.isDefined("WindowsLook/Background"));
+
+    images.unloadImageset("WindowsLook.imageset");
+    BOOST_CHECK(!images.isDefined("WindowsLook/Background"));
+    BOOST_CHECK_EQUAL(images.getImageCollectionSize("WindowsLook"), 0u);
+
+    // loading again works, and destroying the collection directly resets
+    // the load count
+    images.loadImageset("WindowsLook.imageset");
+    BOOST_CHECK_EQUAL(images.getImageCollectionSize("WindowsLook"), count);
+    images.destroyImageCollection("WindowsLook");
+    BOOST_CHECK(!images.isDefined("WindowsLook/Background"));
+    images.unloadImageset("WindowsLook.imageset");
+}
+
+BOOST_AUTO_TEST_CASE(NestedCollections)
+{
+    CEGUI::ImageManager& images = CEGUI::ImageManager::getSingleton();
+
+    // an imageset whose name is a collection inside another one
+    images.loadImagesetFromString(
+        "<Imageset version=\"2\" name=\"NestedTest/Small\" imagefile=\"WindowsLook.png\">"
+        "<Image name=\"First\" xPos=\"0\" yPos=\"0\" width=\"2\" height=\"2\" />"
+        "<Image name=\"Second\" xPos=\"2\" yPos=\"0\" width=\"2\" height=\"2\" />"
+        "</Imageset>");
+    BOOST_CHECK_EQUAL(images.getImageCollectionSize("NestedTest/Small"), 2u);
+    BOOST_CHECK_EQUAL(images.getImageCollectionSize("NestedTest"), 2u);
+
+    // destroying the outer collection takes the images of the inner one
+    images.destroyImageCollection("NestedTest", false);
+    BOOST_CHECK(!images.isDefined("NestedTest/Small/First"));
+    BOOST_CHECK(!images.isDefined("NestedTest/Small/Second"));
+    BOOST_CHECK_EQUAL(images.getImageCollectionSize("NestedTest/Small"), 0u);
+
+    CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+    if (renderer.isTextureDefined("NestedTest/Small"))
+        renderer.destroyTexture("NestedTest/Small");
+}
+
+BOOST_AUTO_TEST_CASE(SchemesKeepTheirImagesets)
+{
+    CEGUI::ImageManager& images = CEGUI::ImageManager::getSingleton();
+    CEGUI::SchemeManager& schemes = CEGUI::SchemeManager::getSingleton();
+
+    // windows may still use the images, so unloading a scheme keeps them
+    schemes.createFromFile("VanillaSkin.scheme");
+    BOOST_REQUIRE(images.isDefined("Vanilla-Images/GenericBrush"));
+    schemes.destroy("VanillaSkin");
+    BOOST_CHECK(images.isDefined("Vanilla-Images/GenericBrush"));
+
+    images.destroyImageCollection("Vanilla-Images");
+
+    // the scheme can release them when it is known they are no longer used
+    schemes.createFromFile("VanillaSkin.scheme");
+    schemes.get("VanillaSkin").unloadXMLImagesets();
+    BOOST_CHECK(!images.isDefined("Vanilla-Images/GenericBrush"));
+    schemes.destroy("VanillaSkin");
+
+    // unloading VanillaSkin also unregistered the Core window renderers the
+    // TaharezLook scheme shares with it, which the following tests need
+    schemes.get("TaharezLook").loadResources();
+}
+
+BOOST_AUTO_TEST_CASE(AtlasPacking)
+{
+    CEGUI::ImageManager& images = CEGUI::ImageManager::getSingleton();
+    images.setAtlasPackingEnabled(true);
+    images.setAtlasPageSize(512);
+
+    addAtlasTestImages(false);
+
+    const CEGUI::ImageManager::AtlasStatistics stats = images.getAtlasStatistics();
+    BOOST_CHECK_EQUAL(stats.d_imageCount, 5u);
+    BOOST_CHECK_EQUAL(stats.d_rejectedImages, 0u);
+    // the last image doesn't fit on the shelves left on the first page
+    BOOST_CHECK_EQUAL(stats.d_pageCount, 2u);
+    BOOST_CHECK_EQUAL(stats.d_totalPixels, 2u * 512u * 512u);
+
+    const CEGUI::Texture* page = getAtlasTestImage(AtlasTestImages[0]).getTexture();
+    BOOST_CHECK_EQUAL(getAtlasTestImage(AtlasTestImages[3]).getTexture(), page);
+    BOOST_CHECK(getAtlasTestImage(AtlasTestImages[4]).getTexture() != page);
+
+    // every image keeps its size and gets a padded area of its own
+    size_t usedPixels = 0;
+    for (const AtlasTestImage& image : AtlasTestImages)
+    {
+        const CEGUI::BitmapImage& bitmap = getAtlasTestImage(image);
+        const CEGUI::Rectf& area = bitmap.getImageArea();
+        BOOST_CHECK_EQUAL(area.getWidth(), image.d_width);
+        BOOST_CHECK_EQUAL(area.getHeight(), image.d_height);
+        BOOST_CHECK(area.left() >= 1.f && area.top() >= 1.f);
+        BOOST_CHECK(area.right() <= 511.f && area.bottom() <= 511.f);
+
+        usedPixels += static_cast<size_t>((image.d_width + 2.f) * (image.d_height + 2.f));
+
+        for (const AtlasTestImage& other : AtlasTestImages)
+        {
+            if (&other == &image || getAtlasTestImage(other).getTexture() != bitmap.getTexture())
+                continue;
+
+            CEGUI::Rectf padded = getAtlasTestImage(other).getImageArea();
+            padded.d_min -= glm::vec2(1.f, 1.f);
+            padded.d_max += glm::vec2(1.f, 1.f);
+            BOOST_CHECK(area.getIntersection(padded).empty());
+        }
+    }
+    BOOST_CHECK_EQUAL(stats.d_usedPixels, usedPixels);
+
+    // images larger than the limit get their own texture
+    images.setAtlasMaxImageSize(64);
+    images.addBitmapImageFromFile("AtlasTest/Large", "WindowsLook.png");
+    const CEGUI::BitmapImage& large =
+        static_cast<const CEGUI::BitmapImage&>(images.get("AtlasTest/Large"));
+    BOOST_CHECK(large.getTexture() != page);
+    BOOST_CHECK_EQUAL(images.getAtlasStatistics().d_rejectedImages, 1u);
+    BOOST_CHECK_EQUAL(images.getAtlasStatistics().d_imageCount, 5u);
+    images.destroy("AtlasTest/Large");
+    images.setAtlasMaxImageSize(256);
+
+    // the page is released along with its last image
+    destroyAtlasTestImages();
+    BOOST_CHECK_EQUAL(images.getAtlasStatistics().d_imageCount, 0u);
+    BOOST_CHECK_EQUAL(images.getAtlasStatistics().d_pageCount, 0u);
+
+    images.setAtlasPackingEnabled(false);
+    images.setAtlasPageSize(1024);
+}
+
+BOOST_AUTO_TEST_CASE(AtlasLayoutRoundTrip)
+{
+    CEGUI::ImageManager& images = CEGUI::ImageManager::getSingleton();
+    images.setAtlasPackingEnabled(true);
+    images.setAtlasPageSize(512);
+
+    addAtlasTestImages(false);
+
+    std::vector<CEGUI::Rectf> packedAreas;
+    for (const AtlasTestImage& image : AtlasTestImages)
+        packedAreas.push_back(getAtlasTestImage(image).getImageArea());
+
+    images.saveAtlasLayout("AtlasLayoutTest.xml");
+    destroyAtlasTestImages();
+
+    static_cast<CEGUI::DefaultResourceProvider*>(
+        CEGUI::System::getSingleton().getResourceProvider())->
+            setResourceGroupDirectory("AtlasLayoutTest", "./");
+    images.loadAtlasLayout("AtlasLayoutTest.xml", "AtlasLayoutTest");
+
+    // the loaded layout places the images regardless of the loading order
+    addAtlasTestImages(true);
+
+    const CEGUI::ImageManager::AtlasStatistics stats = images.getAtlasStatistics();
+    BOOST_CHECK_EQUAL(stats.d_imageCount, 5u);
+    BOOST_CHECK_EQUAL(stats.d_layoutPlacements, 5u);
+    BOOST_CHECK_EQUAL(stats.d_pageCount, 2u);
+
+    for (size_t i = 0; i < packedAreas.size(); ++i)
+        BOOST_CHECK(getAtlasTestImage(AtlasTestImages[i]).getImageArea() == packedAreas[i]);
+    BOOST_CHECK_EQUAL(getAtlasTestImage(AtlasTestImages[0]).getTexture(),
+                      getAtlasTestImage(AtlasTestImages[3]).getTexture());
+    BOOST_CHECK(getAtlasTestImage(AtlasTestImages[0]).getTexture() !=
+                getAtlasTestImage(AtlasTestImages[4]).getTexture());
+
+    // a layout can't be loaded while images are packed
+    BOOST_CHECK_THROW(images.loadAtlasLayout("AtlasLayoutTest.xml", "AtlasLayoutTest"),
+                      CEGUI::InvalidRequestException);
+
+    destroyAtlasTestImages();
+    std::remove("AtlasLayoutTest.xml");
+
+    images.setAtlasPackingEnabled(false);
+    images.setAtlasPageSize(1024);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
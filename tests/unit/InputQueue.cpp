@@ -0,0 +1,155 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/InputQueue.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+//! Records injected input as text so that the order can be checked.
+class InputRecorder : public CEGUI::InjectedInputReceiver
+{
+public:
+    bool injectMouseMove(float dx, float dy) override { return add("move " + num(dx) + " " + num(dy)); }
+    bool injectMouseLeaves() override { return add("leaves"); }
+    bool injectMouseButtonDown(CEGUI::MouseButton) override { return add("down"); }
+    bool injectMouseButtonUp(CEGUI::MouseButton) override { return add("up"); }
+    bool injectKeyDown(CEGUI::Key::Scan scanCode) override { return add("keydown " + num(static_cast<int>(scanCode))); }
+    bool injectKeyUp(CEGUI::Key::Scan) override { return add("keyup"); }
+    bool injectChar(char32_t codePoint) override { return add("char " + num(static_cast<int>(codePoint))); }
+    bool injectMouseWheelChange(float delta) override { return add("wheel " + num(delta)); }
+    bool injectMousePosition(float x, float y) override { return add("position " + num(x) + " " + num(y)); }
+    bool injectMouseButtonClick(CEGUI::MouseButton) override { return add("click"); }
+    bool injectMouseButtonDoubleClick(CEGUI::MouseButton) override { return add("doubleclick"); }
+    bool injectMouseButtonTripleClick(CEGUI::MouseButton) override { return add("tripleclick"); }
+
+    std::vector<std::string> d_inputs;
+
+private:
+    template<typename T> static std::string num(T value) { return std::to_string(static_cast<int>(value)); }
+    bool add(const std::string& input) { d_inputs.push_back(input); return true; }
+};
+}
+
+BOOST_AUTO_TEST_SUITE(InputQueue)
+
+BOOST_AUTO_TEST_CASE(Coalescing)
+{
+    CEGUI::InputQueue queue;
+    queue.injectMouseMove(1, 2);
+    queue.injectMouseMove(3, 4);
+    queue.injectMouseWheelChange(1);
+    queue.injectMouseWheelChange(2);
+    queue.injectMouseButtonDown(CEGUI::MouseButton::Left);
+    queue.injectMouseMove(5, 5);
+    queue.injectMousePosition(10, 20);
+    queue.injectMouseMove(1, 1);
+    queue.injectMouseButtonUp(CEGUI::MouseButton::Left);
+    queue.injectMouseMove(2, 2);
+
+    InputRecorder recorder;
+    BOOST_CHECK_EQUAL(queue.drain(recorder), 6u);
+
+    const std::vector<std::string> expected {
+        "move 4 6", "wheel 3", "down", "position 11 21", "up", "move 2 2" };
+    BOOST_CHECK_EQUAL_COLLECTIONS(recorder.d_inputs.begin(), recorder.d_inputs.end(),
+                                  expected.begin(), expected.end());
+
+    // the queue is empty now
+    BOOST_CHECK_EQUAL(queue.drain(recorder), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(NoCoalescing)
+{
+    CEGUI::InputQueue queue;
+    queue.setCursorMoveCoalescing(false);
+    queue.setWheelCoalescing(false);
+    queue.injectMouseMove(1, 2);
+    queue.injectMouseMove(3, 4);
+    queue.injectMouseWheelChange(1);
+    queue.injectMouseWheelChange(2);
+
+    InputRecorder recorder;
+    BOOST_CHECK_EQUAL(queue.drain(recorder), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(Overflow)
+{
+    CEGUI::InputQueue queue(4);
+    BOOST_CHECK_EQUAL(queue.getCapacity(), 4u);
+
+    for (int i = 0; i < 6; ++i)
+        queue.injectChar(U'a' + i);
+
+    BOOST_CHECK_EQUAL(queue.getDroppedCount(), 2u);
+
+    InputRecorder recorder;
+    BOOST_CHECK_EQUAL(queue.drain(recorder), 4u);
+    BOOST_CHECK_EQUAL(recorder.d_inputs.back(), "char 100");
+
+    // slots are reusable after draining
+    BOOST_CHECK(queue.injectChar(U'z'));
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentProducers)
+{
+    const int threadCount = 4;
+    const int keysPerThread = 1000;
+    CEGUI::InputQueue queue(256);
+    queue.setCursorMoveCoalescing(false);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&queue, t]()
+        {
+            // each thread injects its own key
+            for (int i = 0; i < keysPerThread; ++i)
+                while (!queue.injectKeyDown(static_cast<CEGUI::Key::Scan>(t + 1)))
+                    std::this_thread::yield();
+        });
+    }
+
+    InputRecorder recorder;
+    while (recorder.d_inputs.size() < threadCount * keysPerThread)
+        queue.drain(recorder);
+
+    for (auto& thread : threads)
+        thread.join();
+
+    BOOST_CHECK_EQUAL(recorder.d_inputs.size(), static_cast<size_t>(threadCount * keysPerThread));
+    for (int t = 0; t < threadCount; ++t)
+        BOOST_CHECK_EQUAL(std::count(recorder.d_inputs.begin(), recorder.d_inputs.end(),
+                                     "keydown " + std::to_string(t + 1)), keysPerThread);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
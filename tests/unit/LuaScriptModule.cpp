@@ -0,0 +1,159 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_LUA_MODULE
+
+#include "CEGUI/ScriptModules/Lua/ScriptModule.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+/*
+ * Used to set up a Lua script module with a few handlers that record the
+ * order they were called in.
+ */
+class LuaScriptModuleFixture
+{
+public:
+    LuaScriptModuleFixture() :
+        d_module(CEGUI::LuaScriptModule::create())
+    {
+        CEGUI::System::getSingleton().setScriptingModule(&d_module);
+
+        d_module.executeString(
+            "order = 0\n"
+            "function first(e) order = order * 10 + 1 return true end\n"
+            "function second(e) order = order * 10 + 2 return true end\n"
+            "function unhandled(e) order = order * 10 + 3 return false end\n"
+            "function getOrder() return order end\n");
+
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_window1 = winMgr.createWindow("DefaultWindow", "window1");
+        d_window2 = winMgr.createWindow("DefaultWindow", "window2");
+    }
+
+    ~LuaScriptModuleFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        if (d_window1)
+            winMgr.destroyWindow(d_window1);
+        winMgr.destroyWindow(d_window2);
+        winMgr.cleanDeadPool();
+
+        CEGUI::System::getSingleton().setScriptingModule(nullptr);
+        CEGUI::LuaScriptModule::destroy(d_module);
+    }
+
+    int getOrder()
+    {
+        return d_module.executeScriptGlobal("getOrder");
+    }
+
+    bool fire(CEGUI::Window* window, const CEGUI::String& event_name)
+    {
+        CEGUI::WindowEventArgs args(window);
+        window->fireEvent(event_name, args);
+        return args.handled != 0;
+    }
+
+    CEGUI::LuaScriptModule& d_module;
+    CEGUI::Window* d_window1;
+    CEGUI::Window* d_window2;
+};
+
+BOOST_FIXTURE_TEST_SUITE(LuaScriptModule, LuaScriptModuleFixture)
+
+BOOST_AUTO_TEST_CASE(ImmediateHandlers)
+{
+    d_module.subscribeEvent(d_window1, "Immediate", "first");
+    d_module.subscribeEvent(d_window2, "Immediate", "unhandled");
+
+    BOOST_CHECK(fire(d_window1, "Immediate"));
+    BOOST_CHECK(!fire(d_window2, "Immediate"));
+    BOOST_CHECK_EQUAL(getOrder(), 13);
+
+    // flushing does nothing for handlers that are not batched
+    d_module.flushBatchedEvents();
+    BOOST_CHECK_EQUAL(getOrder(), 13);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedHandlers)
+{
+    d_module.setEventBatched("Batched", true);
+    BOOST_CHECK(d_module.isEventBatched("Batched"));
+    d_module.subscribeEvent(d_window1, "Batched", "first");
+    d_module.subscribeEvent(d_window2, "Batched", "second");
+
+    // queued calls never mark the event as handled
+    BOOST_CHECK(!fire(d_window2, "Batched"));
+    BOOST_CHECK(!fire(d_window1, "Batched"));
+    BOOST_CHECK_EQUAL(getOrder(), 0);
+
+    // a handler that is already queued is called once, at its first position
+    BOOST_CHECK(!fire(d_window2, "Batched"));
+
+    d_module.flushBatchedEvents();
+    BOOST_CHECK_EQUAL(getOrder(), 21);
+
+    d_module.flushBatchedEvents();
+    BOOST_CHECK_EQUAL(getOrder(), 21);
+
+    BOOST_CHECK(!fire(d_window1, "Batched"));
+    d_module.flushBatchedEvents();
+    BOOST_CHECK_EQUAL(getOrder(), 211);
+
+    // handlers subscribed after batching is turned off are called right away
+    d_module.setEventBatched("Batched", false);
+    d_module.subscribeEvent(d_window1, "Batched", "unhandled");
+    BOOST_CHECK(!fire(d_window1, "Batched"));
+    BOOST_CHECK_EQUAL(getOrder(), 2113);
+    d_module.flushBatchedEvents();
+    BOOST_CHECK_EQUAL(getOrder(), 21131);
+}
+
+BOOST_AUTO_TEST_CASE(BatchedCallsOfDestroyedWindows)
+{
+    d_module.setEventBatched("Batched", true);
+    d_module.subscribeEvent(d_window1, "Batched", "first");
+    d_module.subscribeEvent(d_window2, "Batched", "second");
+
+    fire(d_window1, "Batched");
+    fire(d_window2, "Batched");
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(d_window1);
+    d_window1 = nullptr;
+
+    d_module.flushBatchedEvents();
+    BOOST_CHECK_EQUAL(getOrder(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,92 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/MemoryTracker.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(MemoryTracker)
+
+BOOST_AUTO_TEST_CASE(Allocator)
+{
+    using CEGUI::MemoryTag;
+    typedef CEGUI::MemoryTrackingAllocator<int, MemoryTag::XML> Allocator;
+
+    const CEGUI::MemoryStatistics before = CEGUI::MemoryTracker::getStatistics(MemoryTag::XML);
+    {
+        std::vector<int, Allocator> data(1000);
+
+        const CEGUI::MemoryStatistics during = CEGUI::MemoryTracker::getStatistics(MemoryTag::XML);
+        BOOST_CHECK_EQUAL(during.d_liveBytes, before.d_liveBytes + 1000 * sizeof(int));
+        BOOST_CHECK_EQUAL(during.d_liveAllocations, before.d_liveAllocations + 1);
+        BOOST_CHECK_EQUAL(during.d_totalAllocations, before.d_totalAllocations + 1);
+        BOOST_CHECK_GE(during.d_peakBytes, during.d_liveBytes);
+    }
+
+    const CEGUI::MemoryStatistics after = CEGUI::MemoryTracker::getStatistics(MemoryTag::XML);
+    BOOST_CHECK_EQUAL(after.d_liveBytes, before.d_liveBytes);
+    BOOST_CHECK_EQUAL(after.d_liveAllocations, before.d_liveAllocations);
+
+    CEGUI::MemoryTracker::resetPeaks();
+    BOOST_CHECK_EQUAL(CEGUI::MemoryTracker::getStatistics(MemoryTag::XML).d_peakBytes, after.d_liveBytes);
+}
+
+BOOST_AUTO_TEST_CASE(WindowBudget)
+{
+    using CEGUI::MemoryTag;
+    CEGUI::System& system = CEGUI::System::getSingleton();
+
+    system.resetMemoryPeaks();
+    const size_t before = system.getMemoryStatistics(MemoryTag::Window).d_liveBytes;
+
+    CEGUI::Window* window = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    const size_t during = system.getMemoryStatistics(MemoryTag::Window).d_liveBytes;
+    if (CEGUI::MemoryTracker::isEnabled())
+        BOOST_CHECK_GE(during, before + sizeof(CEGUI::Window));
+    else
+        BOOST_CHECK_EQUAL(during, 0u);
+
+    system.setMemoryBudget(MemoryTag::Window, during + 1);
+    BOOST_CHECK(!system.isMemoryBudgetExceeded());
+    if (CEGUI::MemoryTracker::isEnabled())
+    {
+        system.setMemoryBudget(MemoryTag::Window, before + 1);
+        BOOST_CHECK(system.isMemoryBudgetExceeded());
+    }
+    system.logMemoryStatistics();
+    system.setMemoryBudget(MemoryTag::Window, 0);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(window);
+    CEGUI::WindowManager::getSingleton().cleanDeadPool();
+    BOOST_CHECK_EQUAL(system.getMemoryStatistics(MemoryTag::Window).d_liveBytes, before);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,121 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/SchemeManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+struct MultiColumnListFixture
+{
+    MultiColumnListFixture()
+    {
+        if (!CEGUI::SchemeManager::getSingleton().isDefined("TaharezLook"))
+            CEGUI::SchemeManager::getSingleton().createFromFile("TaharezLook.scheme");
+
+        d_list = static_cast<CEGUI::MultiColumnList*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/MultiColumnList"));
+        d_list->setFont(&CEGUI::FontManager::getSingleton().get("DejaVuSans-12"));
+        d_list->setArea(CEGUI::URect(CEGUI::UDim(0, 0), CEGUI::UDim(0, 0),
+                                     CEGUI::UDim(0, 300), CEGUI::UDim(0, 200)));
+        d_list->addColumn("Name", 0, CEGUI::UDim(0.5f, 0));
+        d_list->addColumn("Value", 1, CEGUI::UDim(0.5f, 0));
+    }
+
+    ~MultiColumnListFixture()
+    {
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_list);
+    }
+
+    //! add a row whose items have the given number of lines.
+    void addRow(const CEGUI::String& name, int lines)
+    {
+        CEGUI::String value(name);
+        for (int i = 1; i < lines; ++i)
+            value += "\n" + name;
+
+        const unsigned int row = d_list->addRow();
+        d_list->setItem(new CEGUI::ListboxTextItem(name), 0, row);
+        d_list->setItem(new CEGUI::ListboxTextItem(value), 1, row);
+    }
+
+    //! check the cached row offsets against the height of each row.
+    void checkRowOffsets() const
+    {
+        float offset = 0.0f;
+        for (unsigned int i = 0; i < d_list->getRowCount(); ++i)
+        {
+            BOOST_CHECK_EQUAL(d_list->getRowOffset(i), offset);
+            BOOST_CHECK_EQUAL(d_list->getRowAtOffset(offset), i);
+            offset += d_list->getHighestRowItemHeight(i);
+            BOOST_CHECK_EQUAL(d_list->getRowAtOffset(offset - 0.5f), i);
+        }
+
+        BOOST_CHECK_EQUAL(d_list->getRowOffset(d_list->getRowCount()), offset);
+        BOOST_CHECK_EQUAL(d_list->getTotalRowsHeight(), offset);
+        BOOST_CHECK_EQUAL(d_list->getRowAtOffset(offset), d_list->getRowCount());
+    }
+
+    CEGUI::MultiColumnList* d_list;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiColumnList, MultiColumnListFixture)
+
+BOOST_AUTO_TEST_CASE(RowOffsets)
+{
+    BOOST_CHECK_EQUAL(d_list->getTotalRowsHeight(), 0.0f);
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(10.0f), 0u);
+    BOOST_CHECK_THROW(d_list->getRowOffset(1), CEGUI::InvalidRequestException);
+
+    addRow("c", 1);
+    addRow("a", 3);
+    addRow("b", 2);
+    BOOST_REQUIRE(d_list->getHighestRowItemHeight(1) > d_list->getHighestRowItemHeight(0));
+    checkRowOffsets();
+    BOOST_CHECK_EQUAL(d_list->getRowAtOffset(-5.0f), 0u);
+
+    // sorting reorders the rows
+    d_list->setSortColumn(0);
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::SortDirection::Ascending);
+    BOOST_CHECK_EQUAL(d_list->getItemAtGridReference(CEGUI::MCLGridRef(0, 0))->getText(), "a");
+    checkRowOffsets();
+
+    d_list->removeRow(0);
+    checkRowOffsets();
+
+    // externally modified items are only picked up by handleUpdatedItemData
+    const float height = d_list->getTotalRowsHeight();
+    d_list->getItemAtGridReference(CEGUI::MCLGridRef(1, 1))->setText("c\nc\nc\nc");
+    BOOST_CHECK_EQUAL(d_list->getTotalRowsHeight(), height);
+    d_list->handleUpdatedItemData();
+    BOOST_CHECK(d_list->getTotalRowsHeight() > height);
+    checkRowOffsets();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
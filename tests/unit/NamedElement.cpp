@@ -25,6 +25,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 
+#include "CEGUI/ChildHandle.h"
 #include "CEGUI/Window.h"
 #include "CEGUI/WindowManager.h"
 
@@ -46,9 +47,8 @@ BOOST_AUTO_TEST_CASE(Children)
     root->addChild(child2);
     BOOST_CHECK_THROW(root->addChild(child1), CEGUI::AlreadyExistsException);
 
-    delete child2;
-    delete child1;
-    delete root;
+    CEGUI::WindowManager::getSingleton().destroyWindow(child1);
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
 }
 
 BOOST_AUTO_TEST_CASE(NamePath)
@@ -68,9 +68,7 @@ BOOST_AUTO_TEST_CASE(NamePath)
     BOOST_CHECK_EQUAL(child->getChild("inner_child"), inner_child);
     BOOST_CHECK_THROW(child->getChild("nonexistant"), CEGUI::UnknownObjectException);
 
-    delete inner_child;
-    delete child;
-    delete root;
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
 }
 
 BOOST_AUTO_TEST_CASE(FindRecursive)
@@ -91,9 +89,33 @@ BOOST_AUTO_TEST_CASE(FindRecursive)
 
     BOOST_CHECK(0 == root->getChildRecursive("blah")); // blah-tantly wrong
 
-    delete inner_child;
-    delete child;
-    delete root;
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_CASE(ChildHandle)
+{
+    CEGUI::Window* root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow", "root");
+    CEGUI::Window* child = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow", "child");
+    CEGUI::Window* inner_child = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow", "inner_child");
+    root->addChild(child);
+    child->addChild(inner_child);
+
+    CEGUI::ChildHandle handle(root, "child/inner_child");
+    BOOST_CHECK_EQUAL(handle.find(), inner_child);
+
+    inner_child->setName("renamed");
+    BOOST_CHECK(0 == handle.find());
+    BOOST_CHECK_THROW(handle.get(), CEGUI::UnknownObjectException);
+    BOOST_CHECK_EQUAL(root->getChild("child/renamed"), inner_child);
+
+    inner_child->setName("inner_child");
+    BOOST_CHECK_EQUAL(handle.get(), inner_child);
+
+    child->removeChild(inner_child);
+    BOOST_CHECK(0 == handle.find());
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(inner_child);
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,358 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/GeometryRecorder.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/WindowRenderer.h"
+#include "CEGUI/WindowRendererManager.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+//! Thread-safe window renderer drawing a coloured and, optionally, a textured quad.
+class TestGeometryRenderer : public CEGUI::WindowRenderer
+{
+public:
+    static const CEGUI::String TypeName;
+    static std::atomic<int> s_recordedWindows;
+    static int s_serialRecordedWindows;
+    static const CEGUI::GeometryRecorder* s_serialRecorder;
+    static const CEGUI::Texture* s_texture;
+    static bool s_threadSafe;
+
+    TestGeometryRenderer(const CEGUI::String& type) : WindowRenderer(type) {}
+
+    void createRenderGeometry() override
+    {
+        // the context records serially drawn windows that have buffers
+        const CEGUI::GeometryRecorder* recorder = CEGUI::GeometryRecorder::getCurrent();
+        if (recorder == s_serialRecorder)
+            ++s_serialRecordedWindows;
+        else if (recorder)
+            ++s_recordedWindows;
+
+        CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+        const CEGUI::Rectf area(d_window->getUnclippedOuterRect().get());
+
+        CEGUI::GeometryBuffer& solid = renderer.createGeometryBufferColoured();
+        solid.setClippingRegion(d_window->getOuterRectClipper());
+        solid.appendSolidRect(area, CEGUI::ColourRect(CEGUI::Colour(area.left() / 800.f, 0.5f, 1.f)));
+        d_window->getGeometryBuffers().push_back(&solid);
+
+        if (!s_texture)
+            return;
+
+        CEGUI::TexturedColouredVertex vertices[3];
+        vertices[0].d_position = glm::vec3(area.left(), area.top(), 0.f);
+        vertices[1].d_position = glm::vec3(area.left(), area.bottom(), 0.f);
+        vertices[2].d_position = glm::vec3(area.right(), area.bottom(), 0.f);
+        for (auto& vertex : vertices)
+        {
+            vertex.setColour(CEGUI::Colour(1.f, 1.f, 1.f));
+            vertex.d_texCoords = glm::vec2(vertex.d_position.x / 800.f, vertex.d_position.y / 600.f);
+        }
+
+        CEGUI::GeometryBuffer& textured = renderer.createGeometryBufferTextured();
+        textured.setMainTexture(s_texture);
+        textured.setAlpha(0.5f);
+        textured.appendGeometry(vertices, 3);
+        d_window->getGeometryBuffers().push_back(&textured);
+    }
+
+    bool isGeometryGenerationThreadSafe() const override { return s_threadSafe; }
+
+    // there is no look to define the inner area or the fonts in use
+    CEGUI::Rectf getUnclippedInnerRect() const override { return d_window->getUnclippedOuterRect().get(); }
+    bool handleFontRenderSizeChange(const CEGUI::Font* const) override { return false; }
+};
+
+const CEGUI::String TestGeometryRenderer::TypeName("Test/ParallelGeometry");
+std::atomic<int> TestGeometryRenderer::s_recordedWindows(0);
+int TestGeometryRenderer::s_serialRecordedWindows = 0;
+const CEGUI::GeometryRecorder* TestGeometryRenderer::s_serialRecorder = nullptr;
+const CEGUI::Texture* TestGeometryRenderer::s_texture = nullptr;
+bool TestGeometryRenderer::s_threadSafe = true;
+
+//! Window renderer that doesn't say whether it is thread-safe.
+class PlainRenderer : public CEGUI::WindowRenderer
+{
+public:
+    PlainRenderer() : WindowRenderer("Test/Plain") {}
+
+    void createRenderGeometry() override {}
+};
+
+//! Looks whose imagery and named areas use font metrics in different places.
+const char* const ThreadSafetyLooks =
+    "<Falagard version=\"7\">"
+    "<WidgetLook name=\"ThreadSafetyTest/Plain\">"
+    "<ImagerySection name=\"image\"><ImageryComponent>"
+    "<Area><Dim type=\"Width\"><AbsoluteDim value=\"10\" /></Dim></Area>"
+    "<Image name=\"TaharezLook/StaticBackdrop\" />"
+    "</ImageryComponent></ImagerySection>"
+    "<StateImagery name=\"Enabled\"><Layer><Section section=\"image\" /></Layer></StateImagery>"
+    "</WidgetLook>"
+    "<WidgetLook name=\"ThreadSafetyTest/TextExtent\">"
+    "<ImagerySection name=\"image\"><ImageryComponent>"
+    "<Area><Dim type=\"Width\"><OperatorDim op=\"Add\">"
+    "<AbsoluteDim value=\"10\" /><FontDim type=\"HorzExtent\" />"
+    "</OperatorDim></Dim></Area>"
+    "<Image name=\"TaharezLook/StaticBackdrop\" />"
+    "</ImageryComponent></ImagerySection>"
+    "<StateImagery name=\"Enabled\"><Layer><Section section=\"image\" /></Layer></StateImagery>"
+    "</WidgetLook>"
+    "<WidgetLook name=\"ThreadSafetyTest/NamedArea\">"
+    "<NamedArea name=\"TextArea\">"
+    "<Area><Dim type=\"Height\"><FontDim type=\"LineSpacing\" /></Dim></Area>"
+    "</NamedArea>"
+    "<StateImagery name=\"Enabled\"><Layer><Section look=\"ThreadSafetyTest/Plain\" section=\"image\" /></Layer></StateImagery>"
+    "</WidgetLook>"
+    "</Falagard>";
+
+//! Everything about a GeometryBuffer that affects what is drawn.
+struct BufferState
+{
+    CEGUI::GeometryBuffer::VertexData d_vertices;
+    const CEGUI::Texture* d_texture;
+    CEGUI::Rectf d_clippingRegion;
+    bool d_clippingActive;
+    float d_alpha;
+    glm::vec3 d_translation;
+};
+
+bool operator==(const BufferState& a, const BufferState& b)
+{
+    return a.d_vertices.size() == b.d_vertices.size() &&
+        !std::memcmp(a.d_vertices.data(), b.d_vertices.data(), a.d_vertices.size() * sizeof(float)) &&
+        a.d_texture == b.d_texture &&
+        a.d_clippingRegion == b.d_clippingRegion &&
+        a.d_clippingActive == b.d_clippingActive &&
+        a.d_alpha == b.d_alpha &&
+        a.d_translation == b.d_translation;
+}
+}
+
+struct ParallelGeometryGenerationFixture
+{
+    ParallelGeometryGenerationFixture() :
+        d_context(CEGUI::System::getSingleton().createGUIContext(
+            CEGUI::System::getSingleton().getRenderer()->getDefaultRenderTarget()))
+    {
+        CEGUI::WindowRendererManager& wrMgr = CEGUI::WindowRendererManager::getSingleton();
+        if (!wrMgr.isFactoryPresent(TestGeometryRenderer::TypeName))
+            wrMgr.addWindowRendererType<TestGeometryRenderer>();
+
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+        d_root = winMgr.createWindow("DefaultWindow");
+        d_context.setRootWindow(d_root);
+
+        for (int i = 0; i < 64; ++i)
+        {
+            CEGUI::Window* wnd = winMgr.createWindow("DefaultWindow");
+            wnd->setWindowRenderer(TestGeometryRenderer::TypeName);
+            wnd->setArea(CEGUI::URect(cegui_absdim(i * 11.5f), cegui_absdim(i * 7.25f),
+                                      cegui_absdim(i * 11.5f + 100.f), cegui_absdim(i * 7.25f + 40.f)));
+            d_root->addChild(wnd);
+        }
+
+        d_texture = &CEGUI::System::getSingleton().getRenderer()->createTexture(
+            "ParallelGeometryTexture", CEGUI::Sizef(32.f, 32.f));
+
+        TestGeometryRenderer::s_serialRecorder = &d_context.getGeometryRecorder();
+    }
+
+    ~ParallelGeometryGenerationFixture()
+    {
+        TestGeometryRenderer::s_texture = nullptr;
+        TestGeometryRenderer::s_threadSafe = true;
+        TestGeometryRenderer::s_serialRecorder = nullptr;
+        d_context.setRootWindow(nullptr);
+        CEGUI::System::getSingleton().destroyGUIContext(d_context);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+        CEGUI::System::getSingleton().getRenderer()->destroyTexture(*d_texture);
+    }
+
+    //! Redraw all the windows and return the state of their geometry.
+    std::vector<BufferState> draw()
+    {
+        d_root->invalidate(true);
+        d_context.draw();
+
+        std::vector<BufferState> result;
+        for (size_t i = 0; i < d_root->getChildCount(); ++i)
+        {
+            for (const CEGUI::GeometryBuffer* buffer : d_root->getChildAtIndex(i)->getGeometryBuffers())
+            {
+                result.push_back({ buffer->getVertexData(), buffer->getMainTexture(),
+                    buffer->getClippingRegion(), buffer->isClippingActive(),
+                    buffer->getAlpha(), buffer->getTranslation() });
+            }
+        }
+
+        return result;
+    }
+
+    //! Return the geometry buffers of all the windows.
+    std::vector<const CEGUI::GeometryBuffer*> getBuffers() const
+    {
+        std::vector<const CEGUI::GeometryBuffer*> result;
+        for (size_t i = 0; i < d_root->getChildCount(); ++i)
+            for (const CEGUI::GeometryBuffer* buffer : d_root->getChildAtIndex(i)->getGeometryBuffers())
+                result.push_back(buffer);
+
+        return result;
+    }
+
+    CEGUI::GUIContext& d_context;
+    CEGUI::Window* d_root;
+    CEGUI::Texture* d_texture;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ParallelGeometryGeneration, ParallelGeometryGenerationFixture)
+
+BOOST_AUTO_TEST_CASE(MatchesSerialGeneration)
+{
+    const std::vector<BufferState> serial = draw();
+    BOOST_REQUIRE_EQUAL(serial.size(), 64u);
+
+    d_context.setParallelGeometryGenerationEnabled(true, 4);
+    TestGeometryRenderer::s_recordedWindows = 0;
+
+    // same layout: the previous buffers are updated in place
+    BOOST_CHECK(draw() == serial);
+    BOOST_CHECK_EQUAL(TestGeometryRenderer::s_recordedWindows, 64);
+
+    // new layout: the recorded buffers are copied into new ones
+    TestGeometryRenderer::s_texture = d_texture;
+    const std::vector<BufferState> parallel = draw();
+    BOOST_CHECK_EQUAL(parallel.size(), 128u);
+    BOOST_CHECK_EQUAL(TestGeometryRenderer::s_recordedWindows, 128);
+
+    d_context.setParallelGeometryGenerationEnabled(false);
+    BOOST_CHECK(draw() == parallel);
+    BOOST_CHECK_EQUAL(TestGeometryRenderer::s_recordedWindows, 128);
+
+    TestGeometryRenderer::s_texture = nullptr;
+    BOOST_CHECK(draw() == serial);
+}
+
+BOOST_AUTO_TEST_CASE(SerialRedrawUpdatesBuffersInPlace)
+{
+    // the first geometry goes straight into buffers created by the renderer
+    TestGeometryRenderer::s_serialRecordedWindows = 0;
+    const std::vector<BufferState> first = draw();
+    const std::vector<const CEGUI::GeometryBuffer*> buffers = getBuffers();
+
+    // same layout: the new geometry is recorded and copied into the buffers
+    TestGeometryRenderer::s_serialRecordedWindows = 0;
+    BOOST_CHECK(draw() == first);
+    BOOST_CHECK_EQUAL(TestGeometryRenderer::s_serialRecordedWindows, 64);
+    BOOST_CHECK(getBuffers() == buffers);
+
+    // new layout: the recorded buffers are copied into new ones
+    TestGeometryRenderer::s_texture = d_texture;
+    TestGeometryRenderer::s_serialRecordedWindows = 0;
+    const std::vector<BufferState> textured = draw();
+    BOOST_CHECK_EQUAL(textured.size(), 128u);
+    BOOST_CHECK_EQUAL(TestGeometryRenderer::s_serialRecordedWindows, 64);
+    for (const CEGUI::GeometryBuffer* buffer : getBuffers())
+        BOOST_CHECK(!TestGeometryRenderer::s_serialRecorder->isRecorded(*buffer));
+
+    TestGeometryRenderer::s_texture = nullptr;
+    BOOST_CHECK(draw() == first);
+}
+
+BOOST_AUTO_TEST_CASE(UnsafeRenderersAreSkipped)
+{
+    const std::vector<BufferState> serial = draw();
+
+    d_context.setParallelGeometryGenerationEnabled(true, 2);
+    TestGeometryRenderer::s_threadSafe = false;
+    TestGeometryRenderer::s_recordedWindows = 0;
+
+    BOOST_CHECK(draw() == serial);
+    BOOST_CHECK_EQUAL(TestGeometryRenderer::s_recordedWindows, 0);
+}
+
+BOOST_AUTO_TEST_CASE(LookDecidesThreadSafety)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+
+    // renderers that only render their look are safe unless it contains text
+    CEGUI::Window* progressBar = winMgr.createWindow("TaharezLook/ProgressBar");
+    BOOST_CHECK(progressBar->getWindowRenderer()->isGeometryGenerationThreadSafe());
+    CEGUI::Window* scrollbar = winMgr.createWindow("TaharezLook/HorizontalScrollbar");
+    BOOST_CHECK(scrollbar->getWindowRenderer()->isGeometryGenerationThreadSafe());
+    CEGUI::Window* button = winMgr.createWindow("TaharezLook/Button");
+    BOOST_CHECK(!button->getWindowRenderer()->isGeometryGenerationThreadSafe());
+
+    // renderers that render text themselves never are
+    CEGUI::Window* editbox = winMgr.createWindow("TaharezLook/Editbox");
+    BOOST_CHECK(!editbox->getWindowRenderer()->isGeometryGenerationThreadSafe());
+    CEGUI::Window* listView = winMgr.createWindow("TaharezLook/ListView");
+    BOOST_CHECK(!listView->getWindowRenderer()->isGeometryGenerationThreadSafe());
+
+    winMgr.destroyWindow(progressBar);
+    winMgr.destroyWindow(scrollbar);
+    winMgr.destroyWindow(button);
+    winMgr.destroyWindow(editbox);
+    winMgr.destroyWindow(listView);
+}
+
+BOOST_AUTO_TEST_CASE(FontMetricsAreNotThreadSafe)
+{
+    CEGUI::WidgetLookManager& looks = CEGUI::WidgetLookManager::getSingleton();
+    looks.parseLookNFeelSpecificationFromString(ThreadSafetyLooks);
+
+    BOOST_CHECK(looks.isGeometryGenerationThreadSafe("ThreadSafetyTest/Plain"));
+    BOOST_CHECK(!looks.isGeometryGenerationThreadSafe("ThreadSafetyTest/TextExtent"));
+    BOOST_CHECK(!looks.isGeometryGenerationThreadSafe("ThreadSafetyTest/NamedArea"));
+
+    // the kept results go when the looks change
+    looks.eraseWidgetLook("ThreadSafetyTest/Plain");
+    BOOST_CHECK(!looks.isGeometryGenerationThreadSafe("ThreadSafetyTest/Plain"));
+
+    looks.eraseWidgetLook("ThreadSafetyTest/TextExtent");
+    looks.eraseWidgetLook("ThreadSafetyTest/NamedArea");
+
+    // renderers must opt in
+    BOOST_CHECK(!PlainRenderer().isGeometryGenerationThreadSafe());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/BitmapImage.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <set>
+#include <sstream>
+
+namespace
+{
+//! Return a description of every image of the collection \a prefix.
+std::set<std::string> describeImages(const CEGUI::String& prefix)
+{
+    std::set<std::string> result;
+
+    for (CEGUI::ImageManager::ImageIterator i =
+             CEGUI::ImageManager::getSingleton().getIterator(); !i.isAtEnd(); ++i)
+    {
+        const CEGUI::Image& image = *i.getCurrentValue().first;
+        if (image.getName().find(prefix + '/') != 0)
+            continue;
+
+        std::ostringstream out;
+        const CEGUI::Rectf& area = image.getImageArea();
+        out << image.getName() << ' ' << area.left() << ' ' << area.top() << ' '
+            << area.getWidth() << ' ' << area.getHeight() << ' '
+            << image.getRenderedSize().d_width << ' '
+            << image.getRenderedSize().d_height;
+
+        if (auto bitmap = dynamic_cast<const CEGUI::BitmapImage*>(&image))
+        {
+            const CEGUI::Texture* texture = bitmap->getTexture();
+            out << ' ' << texture->getName() << ' '
+                << texture->getOriginalDataSize().d_width << ' '
+                << texture->getOriginalDataSize().d_height;
+        }
+
+        result.insert(out.str());
+    }
+
+    return result;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(ParallelResourceLoader)
+
+BOOST_AUTO_TEST_CASE(MatchesSequentialLoading)
+{
+    CEGUI::SchemeManager& schemes = CEGUI::SchemeManager::getSingleton();
+    CEGUI::ImageManager& images = CEGUI::ImageManager::getSingleton();
+    CEGUI::XMLBinaryCache& cache = CEGUI::System::getSingleton().getXMLBinaryCache();
+
+    // parsed XML is only handed over while the binary cache is enabled
+    cache.setCacheDirectory(".");
+
+    schemes.createFromFile("VanillaSkin.scheme");
+    const std::set<std::string> sequential(describeImages("Vanilla-Images"));
+    schemes.destroy("VanillaSkin");
+    images.destroyImageCollection("Vanilla-Images");
+    BOOST_REQUIRE(!images.isDefined("Vanilla-Images/GenericBrush"));
+
+    schemes.setParallelLoadingEnabled(true);
+    schemes.createFromFile("VanillaSkin.scheme");
+    const std::set<std::string> parallel(describeImages("Vanilla-Images"));
+    schemes.setParallelLoadingEnabled(false);
+
+    BOOST_CHECK_EQUAL(images.getImageCollectionSize("Vanilla-Images"), 51u);
+    BOOST_CHECK_EQUAL(sequential.size(), 51u);
+    BOOST_CHECK(parallel == sequential);
+    BOOST_CHECK(CEGUI::WidgetLookManager::getSingleton().isWidgetLookAvailable("Vanilla/Button"));
+
+    schemes.destroy("VanillaSkin");
+    images.destroyImageCollection("Vanilla-Images");
+    cache.setCacheDirectory("");
+
+    // unloading VanillaSkin also unregistered the Core window renderers the
+    // TaharezLook scheme shares with it, which the following tests need
+    schemes.get("TaharezLook").loadResources();
+
+    const char* const files[] = { "VanillaSkin.scheme", "Vanilla.imageset", "Vanilla.looknfeel" };
+    const char* const groups[] = { "schemes", "imagesets", "looknfeels" };
+    for (int i = 0; i < 3; ++i)
+    {
+        // the names are plain ASCII
+        const CEGUI::String name(
+            CEGUI::XMLBinaryCache::getCacheFileName(files[i], groups[i]));
+        std::remove(std::string(name.begin(), name.end()).c_str());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
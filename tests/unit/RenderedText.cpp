@@ -0,0 +1,177 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/text/RenderedText.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+typedef std::vector<std::vector<float>> RenderedVertices;
+
+struct RenderedTextFixture
+{
+    RenderedTextFixture()
+    {
+        if (!CEGUI::SchemeManager::getSingleton().isDefined("TaharezLook"))
+            CEGUI::SchemeManager::getSingleton().createFromFile("TaharezLook.scheme");
+
+        d_font = &CEGUI::FontManager::getSingleton().get("DejaVuSans-12");
+    }
+
+    //! Prepare a text the way widgets do before rendering it.
+    void setText(CEGUI::RenderedText& text, const CEGUI::String& str, float areaWidth = 300.f)
+    {
+        text.renderText(str, nullptr, d_font);
+        text.updateDynamicObjectExtents();
+        text.updateFormatting(areaWidth);
+    }
+
+    //! Render the text and return the vertices of each generated buffer.
+    static RenderedVertices render(const CEGUI::RenderedText& text,
+                                   const glm::vec2& position = glm::vec2(0.f, 0.f),
+                                   const CEGUI::ColourRect* colours = nullptr)
+    {
+        std::vector<CEGUI::GeometryBuffer*> buffers;
+        text.createRenderGeometry(buffers, position, colours);
+
+        RenderedVertices result;
+        for (CEGUI::GeometryBuffer* buffer : buffers)
+        {
+            result.emplace_back(buffer->getVertexData().begin(), buffer->getVertexData().end());
+            CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*buffer);
+        }
+
+        return result;
+    }
+
+    //! Render the same text without any cached geometry.
+    RenderedVertices renderUncached(const CEGUI::String& str, float areaWidth,
+                                    CEGUI::HorizontalTextFormatting fmt,
+                                    const CEGUI::ColourRect* colours = nullptr)
+    {
+        CEGUI::RenderedText text;
+        text.setGeometryCachingEnabled(false);
+        text.setHorizontalFormatting(fmt);
+        setText(text, str, areaWidth);
+        return render(text, glm::vec2(0.f, 0.f), colours);
+    }
+
+    CEGUI::Font* d_font;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderedText, RenderedTextFixture)
+
+BOOST_AUTO_TEST_CASE(CachedGeometryMatchesGenerated)
+{
+    CEGUI::RenderedText text;
+    setText(text, "Cached geometry");
+
+    const RenderedVertices first = render(text);
+    BOOST_REQUIRE(!first.empty());
+    BOOST_CHECK(render(text) == first);
+    BOOST_CHECK(first == renderUncached("Cached geometry", 300.f,
+                                        CEGUI::HorizontalTextFormatting::LeftAligned));
+
+    // a move by whole pixels keeps the vertices and translates the buffers
+    std::vector<CEGUI::GeometryBuffer*> moved;
+    text.createRenderGeometry(moved, glm::vec2(3.f, 5.f));
+    BOOST_REQUIRE_EQUAL(moved.size(), first.size());
+    for (size_t i = 0; i < first.size(); ++i)
+    {
+        const CEGUI::GeometryBuffer::VertexData& vertices = moved[i]->getVertexData();
+        BOOST_CHECK(std::vector<float>(vertices.begin(), vertices.end()) == first[i]);
+
+        const glm::mat4& transform = moved[i]->getCustomTransform();
+        BOOST_CHECK_EQUAL(transform[3][0], 3.f);
+        BOOST_CHECK_EQUAL(transform[3][1], 5.f);
+        CEGUI::System::getSingleton().getRenderer()->destroyGeometryBuffer(*moved[i]);
+    }
+
+    // and moving back gives the original geometry again
+    BOOST_CHECK(render(text) == first);
+}
+
+BOOST_AUTO_TEST_CASE(TextChangeInvalidatesCache)
+{
+    CEGUI::RenderedText text;
+    setText(text, "First text");
+    const RenderedVertices before = render(text);
+
+    setText(text, "Other words");
+    const RenderedVertices after = render(text);
+
+    BOOST_CHECK(after != before);
+    BOOST_CHECK(after == renderUncached("Other words", 300.f,
+                                        CEGUI::HorizontalTextFormatting::LeftAligned));
+}
+
+BOOST_AUTO_TEST_CASE(FormatChangeInvalidatesCache)
+{
+    const CEGUI::String str("Some text that wraps within the narrow area");
+
+    CEGUI::RenderedText text;
+    setText(text, str);
+    const RenderedVertices leftAligned = render(text);
+
+    text.setHorizontalFormatting(CEGUI::HorizontalTextFormatting::RightAligned);
+    text.updateFormatting(300.f);
+    const RenderedVertices rightAligned = render(text);
+    BOOST_CHECK(rightAligned != leftAligned);
+    BOOST_CHECK(rightAligned == renderUncached(str, 300.f,
+                                               CEGUI::HorizontalTextFormatting::RightAligned));
+
+    text.setWordWrapEnabled(true);
+    text.updateFormatting(80.f);
+    CEGUI::RenderedText wrapped;
+    wrapped.setGeometryCachingEnabled(false);
+    wrapped.setHorizontalFormatting(CEGUI::HorizontalTextFormatting::RightAligned);
+    wrapped.setWordWrapEnabled(true);
+    setText(wrapped, str, 80.f);
+    BOOST_CHECK(render(text) != rightAligned);
+    BOOST_CHECK(render(text) == render(wrapped));
+}
+
+BOOST_AUTO_TEST_CASE(ColourChangeInvalidatesCache)
+{
+    CEGUI::RenderedText text;
+    setText(text, "Coloured text");
+
+    const CEGUI::ColourRect red(CEGUI::Colour(1.f, 0.f, 0.f));
+    const CEGUI::ColourRect blue(CEGUI::Colour(0.f, 0.f, 1.f));
+
+    const RenderedVertices redVertices = render(text, glm::vec2(0.f, 0.f), &red);
+    const RenderedVertices blueVertices = render(text, glm::vec2(0.f, 0.f), &blue);
+    BOOST_CHECK(blueVertices != redVertices);
+    BOOST_CHECK(blueVertices == renderUncached("Coloured text", 300.f,
+                                               CEGUI::HorizontalTextFormatting::LeftAligned, &blue));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
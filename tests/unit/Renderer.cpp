@@ -0,0 +1,101 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/TextureTarget.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(Renderer)
+
+BOOST_AUTO_TEST_CASE(TextureTargetSizeClass)
+{
+    using CEGUI::Sizef;
+
+    BOOST_CHECK(CEGUI::Renderer::getTextureTargetSizeClass(Sizef(1, 1)) == Sizef(64, 64));
+    BOOST_CHECK(CEGUI::Renderer::getTextureTargetSizeClass(Sizef(64, 64)) == Sizef(64, 64));
+    BOOST_CHECK(CEGUI::Renderer::getTextureTargetSizeClass(Sizef(65, 64)) == Sizef(128, 64));
+    BOOST_CHECK(CEGUI::Renderer::getTextureTargetSizeClass(Sizef(200, 700)) == Sizef(256, 1024));
+}
+
+BOOST_AUTO_TEST_CASE(TextureTargetPool)
+{
+    CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+    const CEGUI::Renderer::TextureTargetPoolStats& stats =
+        renderer.getTextureTargetPoolStats();
+    const size_t capacity = renderer.getTextureTargetPoolCapacity();
+    renderer.clearTextureTargetPool();
+
+    // new targets get the full size of their class
+    CEGUI::TextureTarget* target = renderer.acquireTextureTarget(CEGUI::Sizef(100, 30), false);
+    BOOST_REQUIRE(target);
+    BOOST_CHECK(target->getArea().getSize() == CEGUI::Sizef(128, 64));
+
+    // reuse after release, for any size that fits
+    renderer.releaseTextureTarget(target);
+    BOOST_CHECK_EQUAL(stats.pooledTargets, 1u);
+    size_t hits = stats.hits;
+    BOOST_CHECK_EQUAL(renderer.acquireTextureTarget(CEGUI::Sizef(20, 60), false), target);
+    BOOST_CHECK_EQUAL(stats.hits, hits + 1);
+    BOOST_CHECK_EQUAL(stats.pooledTargets, 0u);
+
+    // larger sizes and other stencil settings need another target
+    renderer.releaseTextureTarget(target);
+    CEGUI::TextureTarget* large = renderer.acquireTextureTarget(CEGUI::Sizef(129, 64), false);
+    BOOST_REQUIRE(large);
+    BOOST_CHECK(large != target);
+    BOOST_CHECK(large->getArea().getSize() == CEGUI::Sizef(256, 64));
+    CEGUI::TextureTarget* stencil = renderer.acquireTextureTarget(CEGUI::Sizef(100, 30), true);
+    BOOST_REQUIRE(stencil);
+    BOOST_CHECK(stencil != target);
+    BOOST_CHECK_EQUAL(stats.hits, hits + 1);
+
+    // the smallest target that fits is used
+    renderer.releaseTextureTarget(large);
+    BOOST_CHECK_EQUAL(renderer.acquireTextureTarget(CEGUI::Sizef(64, 64), false), target);
+    BOOST_CHECK_EQUAL(renderer.acquireTextureTarget(CEGUI::Sizef(64, 64), false), large);
+
+    // targets released to a full pool are destroyed
+    renderer.setTextureTargetPoolCapacity(1);
+    const size_t evictions = stats.evictions;
+    renderer.releaseTextureTarget(target);
+    renderer.releaseTextureTarget(large);
+    renderer.releaseTextureTarget(stencil);
+    BOOST_CHECK_EQUAL(stats.pooledTargets, 1u);
+    BOOST_CHECK_EQUAL(stats.evictions, evictions + 2);
+
+    renderer.clearTextureTargetPool();
+    BOOST_CHECK_EQUAL(stats.pooledTargets, 0u);
+    hits = stats.hits;
+    target = renderer.acquireTextureTarget(CEGUI::Sizef(100, 30), false);
+    BOOST_CHECK_EQUAL(stats.hits, hits);
+
+    renderer.destroyTextureTarget(target);
+    renderer.setTextureTargetPoolCapacity(capacity);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
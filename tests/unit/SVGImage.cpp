@@ -0,0 +1,142 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/svg/SVGImage.h"
+#include "CEGUI/svg/SVGData.h"
+#include "CEGUI/svg/SVGBasicShape.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+
+//----------------------------------------------------------------------------//
+std::vector<CEGUI::GeometryBuffer*> renderImage(const CEGUI::Image& image,
+                                                const CEGUI::ImageRenderSettings& settings)
+{
+    std::vector<CEGUI::GeometryBuffer*> buffers;
+    image.createRenderGeometry(buffers, settings);
+    return buffers;
+}
+
+//----------------------------------------------------------------------------//
+void destroyBuffers(std::vector<CEGUI::GeometryBuffer*>& buffers)
+{
+    CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+    for (CEGUI::GeometryBuffer* buffer : buffers)
+        renderer.destroyGeometryBuffer(*buffer);
+
+    buffers.clear();
+}
+
+//----------------------------------------------------------------------------//
+void checkBuffersEqual(const std::vector<CEGUI::GeometryBuffer*>& cached,
+                       const std::vector<CEGUI::GeometryBuffer*>& fresh)
+{
+    BOOST_REQUIRE_EQUAL(cached.size(), fresh.size());
+
+    for (size_t i = 0; i < cached.size(); ++i)
+    {
+        BOOST_CHECK(cached[i]->getCustomTransform() == fresh[i]->getCustomTransform());
+        BOOST_CHECK_EQUAL(cached[i]->getAlpha(), fresh[i]->getAlpha());
+
+        const auto& cachedData = cached[i]->getVertexData();
+        const auto& freshData = fresh[i]->getVertexData();
+        BOOST_CHECK_EQUAL_COLLECTIONS(cachedData.begin(), cachedData.end(),
+                                      freshData.begin(), freshData.end());
+    }
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(SVGImage)
+
+BOOST_AUTO_TEST_CASE(CachedTessellation)
+{
+    CEGUI::SVGData data("SVGImageTestData");
+    data.setWidth(100.0f);
+    data.setHeight(100.0f);
+
+    CEGUI::SVGPaintStyle style;
+    style.d_fill.d_none = false;
+    style.d_fill.d_colour = glm::vec3(0.5f, 1.0f, 0.25f);
+    style.d_stroke.d_none = true;
+    data.addShape(new CEGUI::SVGRect(style, glm::mat3x3(1.0f), 10.0f, 20.0f, 50.0f, 30.0f));
+
+    CEGUI::SVGImage image("SVGImageTest", data);
+    image.setUseGeometryAntialiasing(false);
+
+    // populate the cache at the origin with unmodulated colours
+    std::vector<CEGUI::GeometryBuffer*> plain =
+        renderImage(image, CEGUI::ImageRenderSettings(CEGUI::Rectf(0.0f, 0.0f, 100.0f, 100.0f)));
+    BOOST_REQUIRE(!plain.empty());
+
+    // same scale bucket, but moved and tinted: this reuses the cached tessellation
+    const CEGUI::ColourRect tint(CEGUI::Colour(0.5f, 0.5f, 1.0f, 0.5f));
+    const CEGUI::ImageRenderSettings moved(CEGUI::Rectf(30.0f, 40.0f, 130.0f, 140.0f),
+                                           nullptr, tint);
+
+    std::vector<CEGUI::GeometryBuffer*> cached = renderImage(image, moved);
+
+    image.invalidateGeometryCache();
+    std::vector<CEGUI::GeometryBuffer*> fresh = renderImage(image, moved);
+
+    checkBuffersEqual(cached, fresh);
+
+    // the destination offset lives in the transform, the tint in the vertices
+    BOOST_REQUIRE_EQUAL(plain.size(), cached.size());
+    for (size_t i = 0; i < cached.size(); ++i)
+    {
+        const glm::vec4 origin = cached[i]->getCustomTransform() * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        BOOST_CHECK_CLOSE(origin.x, 30.0f, 0.001f);
+        BOOST_CHECK_CLOSE(origin.y, 40.0f, 0.001f);
+
+        const auto& plainData = plain[i]->getVertexData();
+        const auto& cachedData = cached[i]->getVertexData();
+        BOOST_REQUIRE_EQUAL(plainData.size(), cachedData.size());
+        BOOST_REQUIRE(!plainData.empty());
+
+        for (size_t v = 0; v < plainData.size(); v += 7)
+        {
+            BOOST_CHECK_EQUAL(cachedData[v], plainData[v]);
+            BOOST_CHECK_EQUAL(cachedData[v + 1], plainData[v + 1]);
+            BOOST_CHECK_CLOSE(cachedData[v + 3], plainData[v + 3] * 0.5f, 0.001f);
+            BOOST_CHECK_CLOSE(cachedData[v + 4], plainData[v + 4] * 0.5f, 0.001f);
+            BOOST_CHECK_CLOSE(cachedData[v + 5], plainData[v + 5], 0.001f);
+            BOOST_CHECK_CLOSE(cachedData[v + 6], plainData[v + 6] * 0.5f, 0.001f);
+        }
+    }
+
+    destroyBuffers(plain);
+    destroyBuffers(cached);
+    destroyBuffers(fresh);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
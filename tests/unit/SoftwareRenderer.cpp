@@ -0,0 +1,139 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ModuleConfig.h"
+
+#ifdef CEGUI_BUILD_RENDERER_SOFTWARE
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RenderTarget.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+//! Return the RGBA value of the frame buffer pixel at (x, y) as 0xRRGGBBAA.
+std::uint32_t getPixel(CEGUI::SoftwareRenderer& renderer, int x, int y)
+{
+    const CEGUI::SoftwareTexture& frameBuffer = renderer.getFrameBuffer();
+    const std::uint8_t* pixel =
+        frameBuffer.getPixels() + (y * frameBuffer.getPixelWidth() + x) * 4;
+
+    return (static_cast<std::uint32_t>(pixel[0]) << 24) |
+           (static_cast<std::uint32_t>(pixel[1]) << 16) |
+           (static_cast<std::uint32_t>(pixel[2]) << 8) | pixel[3];
+}
+
+void appendQuad(CEGUI::GeometryBuffer& buffer, const CEGUI::Rectf& rect,
+                const glm::vec4& colour, const CEGUI::Rectf& texRect)
+{
+    const CEGUI::TexturedColouredVertex vertices[] =
+    {
+        { glm::vec3(rect.left(), rect.top(), 0), colour, glm::vec2(texRect.left(), texRect.top()) },
+        { glm::vec3(rect.right(), rect.top(), 0), colour, glm::vec2(texRect.right(), texRect.top()) },
+        { glm::vec3(rect.right(), rect.bottom(), 0), colour, glm::vec2(texRect.right(), texRect.bottom()) },
+        { glm::vec3(rect.left(), rect.top(), 0), colour, glm::vec2(texRect.left(), texRect.top()) },
+        { glm::vec3(rect.right(), rect.bottom(), 0), colour, glm::vec2(texRect.right(), texRect.bottom()) },
+        { glm::vec3(rect.left(), rect.bottom(), 0), colour, glm::vec2(texRect.left(), texRect.bottom()) }
+    };
+
+    buffer.appendGeometry(vertices, 6);
+}
+}
+
+BOOST_AUTO_TEST_SUITE(SoftwareRenderer)
+
+BOOST_AUTO_TEST_CASE(TexturedClippedStencilledQuad)
+{
+    for (unsigned int threadCount : { 1u, 4u })
+    {
+        CEGUI::SoftwareRenderer& renderer =
+            CEGUI::SoftwareRenderer::create(CEGUI::Sizef(200, 100), threadCount);
+
+        // 8x8 texture, red on the left half and blue on the right half
+        std::vector<std::uint8_t> pixels;
+        for (int y = 0; y < 8; ++y)
+        {
+            for (int x = 0; x < 8; ++x)
+            {
+                const std::uint8_t texel[] = { x < 4 ? std::uint8_t(255) : std::uint8_t(0), 0,
+                                               x < 4 ? std::uint8_t(0) : std::uint8_t(255), 255 };
+                pixels.insert(pixels.end(), texel, texel + 4);
+            }
+        }
+
+        CEGUI::Texture& texture = renderer.createTexture("SoftwareRendererTest");
+        texture.loadFromMemory(pixels.data(), CEGUI::Sizef(8, 8),
+                               CEGUI::Texture::PixelFormat::Rgba);
+
+        CEGUI::GeometryBuffer& buffer = renderer.createGeometryBufferTextured(
+            renderer.createRenderMaterial(CEGUI::DefaultShaderType::Textured));
+        buffer.setMainTexture(&texture);
+
+        // the stencil shape comes first, then the textured quad covering the
+        // whole frame buffer
+        const glm::vec4 white(1, 1, 1, 1);
+        appendQuad(buffer, CEGUI::Rectf(40, 20, 160, 80), white, CEGUI::Rectf(0, 0, 1, 1));
+        appendQuad(buffer, CEGUI::Rectf(0, 0, 200, 100), white, CEGUI::Rectf(0, 0, 1, 1));
+        buffer.setStencilRenderingActive(CEGUI::PolygonFillRule::NonZero);
+        buffer.setStencilPostRenderingVertexCount(6);
+
+        buffer.setClippingRegion(CEGUI::Rectf(0, 0, 120, 50));
+        buffer.setClippingActive(true);
+
+        renderer.beginRendering();
+        renderer.getDefaultRenderTarget().activate();
+        buffer.draw();
+        renderer.getDefaultRenderTarget().deactivate();
+        renderer.endRendering();
+
+        // inside the stencil shape and the clipping region
+        BOOST_CHECK_EQUAL(getPixel(renderer, 60, 30), 0xff0000ffu);
+        BOOST_CHECK_EQUAL(getPixel(renderer, 118, 45), 0x0000ffffu);
+        BOOST_CHECK_EQUAL(getPixel(renderer, 40, 20), 0xff0000ffu);
+        // clipped
+        BOOST_CHECK_EQUAL(getPixel(renderer, 130, 30), 0u);
+        BOOST_CHECK_EQUAL(getPixel(renderer, 60, 60), 0u);
+        // outside the stencil shape
+        BOOST_CHECK_EQUAL(getPixel(renderer, 20, 30), 0u);
+        BOOST_CHECK_EQUAL(getPixel(renderer, 60, 10), 0u);
+        BOOST_CHECK_EQUAL(getPixel(renderer, 39, 30), 0u);
+
+        renderer.destroyGeometryBuffer(buffer);
+        renderer.destroyTexture(texture);
+        CEGUI::SoftwareRenderer::destroy(renderer);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
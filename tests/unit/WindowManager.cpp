@@ -0,0 +1,165 @@
+/***********************************************************************
+    created:    Mon Oct 19 2026
+    author:     CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/widgets/FrameWindow.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+namespace
+{
+std::vector<CEGUI::Window*> getAliveWindows()
+{
+    std::vector<CEGUI::Window*> windows;
+    for (CEGUI::WindowManager::WindowIterator it =
+            CEGUI::WindowManager::getSingleton().getIterator();
+         !it.isAtEnd(); ++it)
+        windows.push_back(it.getCurrentValue());
+
+    return windows;
+}
+
+int s_eventCount = 0;
+
+bool countEvent(const CEGUI::EventArgs&)
+{
+    ++s_eventCount;
+    return true;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(WindowManager)
+
+BOOST_AUTO_TEST_CASE(RegistryCompaction)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    const std::vector<CEGUI::Window*> existing(getAliveWindows());
+
+    std::vector<CEGUI::Window*> windows;
+    for (int i = 0; i < 10; ++i)
+        windows.push_back(winMgr.createWindow("DefaultWindow"));
+
+    // destroying most of them leaves enough holes to compact the registry
+    std::vector<CEGUI::Window*> expected(existing);
+    for (size_t i = 0; i < windows.size(); ++i)
+    {
+        if (i % 4)
+            winMgr.destroyWindow(windows[i]);
+        else
+            expected.push_back(windows[i]);
+    }
+
+    for (size_t i = 0; i < windows.size(); ++i)
+        BOOST_CHECK_EQUAL(winMgr.isAlive(windows[i]), i % 4 == 0);
+
+    // the remaining windows keep their order of creation
+    BOOST_CHECK(getAliveWindows() == expected);
+
+    // windows created afterwards go to the end
+    windows.push_back(winMgr.createWindow("DefaultWindow"));
+    expected.push_back(windows.back());
+    BOOST_CHECK(getAliveWindows() == expected);
+
+    for (size_t i = 0; i < windows.size(); i += 4)
+        winMgr.destroyWindow(windows[i]);
+    winMgr.destroyWindow(windows.back());
+    winMgr.cleanDeadPool();
+
+    BOOST_CHECK(getAliveWindows() == existing);
+}
+
+BOOST_AUTO_TEST_CASE(WindowPool)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    const CEGUI::String type("TaharezLook/FrameWindow");
+
+    winMgr.setWindowPoolSize(type, 1);
+    BOOST_CHECK_EQUAL(winMgr.getWindowPoolSize(type), 1u);
+
+    CEGUI::Window* root = winMgr.createWindow("DefaultWindow", "root");
+    CEGUI::Window* frame = winMgr.createWindow(type, "frame");
+    root->addChild(frame);
+
+    CEGUI::Window* titlebar = frame->getChild(CEGUI::FrameWindow::TitlebarName);
+    const size_t autoChildCount = frame->getChildCount();
+    const std::vector<CEGUI::Window*> existing(getAliveWindows());
+
+    frame->setText("changed");
+    frame->setAlpha(0.5f);
+    titlebar->setText("changed");
+    frame->setUserString("test", "value");
+    frame->subscribeEvent("TestEvent", CEGUI::Event::Subscriber(&countEvent));
+    CEGUI::Window* child = winMgr.createWindow("DefaultWindow", "child");
+    frame->addChild(child);
+
+    // release: the window and its auto windows are parked, not alive
+    winMgr.destroyWindow(frame);
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(type), 1u);
+    BOOST_CHECK(!winMgr.isAlive(frame));
+    BOOST_CHECK(!winMgr.isAlive(titlebar));
+    BOOST_CHECK(!winMgr.isAlive(child));
+    BOOST_CHECK_EQUAL(root->getChildCount(), 0u);
+    BOOST_CHECK_EQUAL(getAliveWindows().size(), existing.size() - 1 - autoChildCount);
+
+    // acquire: the same window comes back, reset to its initial state
+    CEGUI::Window* reused = winMgr.createWindow(type, "reused");
+    BOOST_CHECK_EQUAL(reused, frame);
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(type), 0u);
+    BOOST_CHECK(reused->getName() == "reused");
+    BOOST_CHECK(reused->getParent() == nullptr);
+    BOOST_CHECK(reused->getText().empty());
+    BOOST_CHECK_EQUAL(reused->getAlpha(), 1.0f);
+    BOOST_CHECK(titlebar->getText().empty());
+    BOOST_CHECK(!reused->isUserStringDefined("test"));
+    BOOST_CHECK_EQUAL(reused->getChildCount(), autoChildCount);
+    BOOST_CHECK(winMgr.isAlive(reused));
+    BOOST_CHECK(winMgr.isAlive(titlebar));
+    BOOST_CHECK_EQUAL(getAliveWindows().size(), existing.size());
+
+    s_eventCount = 0;
+    CEGUI::WindowEventArgs args(reused);
+    reused->fireEvent("TestEvent", args);
+    BOOST_CHECK_EQUAL(s_eventCount, 0);
+
+    // destroying everything while a window is parked leaves no auto window
+    // of it behind
+    winMgr.destroyWindow(reused);
+    winMgr.destroyAllWindows();
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(type), 1u);
+    BOOST_CHECK(getAliveWindows().empty());
+
+    // reset: disabling the pool destroys the parked windows for good
+    winMgr.setWindowPoolSize(type, 0);
+    BOOST_CHECK_EQUAL(winMgr.getPooledWindowCount(type), 0u);
+    BOOST_CHECK_EQUAL(winMgr.getWindowPoolSize(type), 0u);
+    BOOST_CHECK(getAliveWindows().empty());
+    winMgr.cleanDeadPool();
+    BOOST_CHECK(winMgr.isDeadPoolEmpty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+/***********************************************************************
+ *    created:    19/10/2026
+ *    author:     CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+//! Handler flattening the element stream to strings for easy comparison
+class EventCollector : public CEGUI::XMLHandler
+{
+public:
+    const CEGUI::String& getDefaultResourceGroup() const override
+    {
+        static const CEGUI::String empty;
+        return empty;
+    }
+
+    void elementStart(const CEGUI::String& element,
+                      const CEGUI::XMLAttributes& attributes) override
+    {
+        // attribute order is not significant (nor preserved by XMLAttributes)
+        std::vector<CEGUI::String> attrs;
+        for (size_t i = 0; i < attributes.getCount(); ++i)
+            attrs.push_back(attributes.getName(i) + "=" + attributes.getValue(i));
+        std::sort(attrs.begin(), attrs.end());
+
+        CEGUI::String event("start:" + element);
+        for (const auto& attr : attrs)
+            event += " " + attr;
+
+        d_events.push_back(event);
+    }
+
+    void elementEnd(const CEGUI::String& element) override
+    {
+        d_events.push_back("end:" + element);
+    }
+
+    void text(const CEGUI::String& text) override
+    {
+        d_events.push_back("text:" + text);
+    }
+
+    std::vector<CEGUI::String> d_events;
+};
+
+const char* const TestXML =
+    "<?xml version=\"1.0\" ?>"
+    "<Imageset name=\"Test\" imagefile=\"Test.png\">"
+    "<Image name=\"A\" xPos=\"1\" yPos=\"2\" width=\"3\" height=\"4\" />"
+    "<Image name=\"B\" xPos=\"1\" yPos=\"2\" width=\"3\" height=\"4\" />"
+    "<Text>some text</Text>"
+    "</Imageset>";
+}
+
+BOOST_AUTO_TEST_SUITE(XMLBinaryCache)
+
+BOOST_AUTO_TEST_CASE(RecordAndReplay)
+{
+    const CEGUI::String source(TestXML);
+    const std::uint64_t hash = CEGUI::XMLBinaryCache::hashSource(
+        reinterpret_cast<const std::uint8_t*>(TestXML), std::strlen(TestXML));
+
+    EventCollector parsed;
+    CEGUI::XMLBinaryCache::Recorder recorder(&parsed, hash);
+    CEGUI::System::getSingleton().getXMLParser()->parseXMLString(recorder, source, "");
+
+    const std::vector<std::uint8_t> blob(recorder.getBlob());
+
+    EventCollector replayed;
+    BOOST_REQUIRE(CEGUI::XMLBinaryCache::replayBlob(replayed, blob.data(), blob.size(), hash));
+    BOOST_CHECK(parsed.d_events == replayed.d_events);
+    BOOST_CHECK_EQUAL(replayed.d_events.size(), 9u);
+}
+
+BOOST_AUTO_TEST_CASE(StaleBlobIsRejected)
+{
+    EventCollector parsed;
+    CEGUI::XMLBinaryCache::Recorder recorder(&parsed, 1);
+    CEGUI::System::getSingleton().getXMLParser()->parseXMLString(recorder, TestXML, "");
+
+    std::vector<std::uint8_t> blob(recorder.getBlob());
+
+    EventCollector replayed;
+    BOOST_CHECK(!CEGUI::XMLBinaryCache::replayBlob(replayed, blob.data(), blob.size(), 2));
+
+    // truncated data must be rejected without emitting anything
+    BOOST_CHECK(!CEGUI::XMLBinaryCache::replayBlob(replayed, blob.data(), blob.size() / 2, 1));
+    BOOST_CHECK(replayed.d_events.empty());
+}
+
+BOOST_AUTO_TEST_CASE(PreparedBlobsRequireEnabledCache)
+{
+    const std::uint8_t* const source = reinterpret_cast<const std::uint8_t*>(TestXML);
+    const size_t sourceSize = std::strlen(TestXML);
+
+    EventCollector parsed;
+    CEGUI::XMLBinaryCache::Recorder recorder(&parsed,
+        CEGUI::XMLBinaryCache::hashSource(source, sourceSize));
+    CEGUI::System::getSingleton().getXMLParser()->parseXMLString(recorder, TestXML, "");
+
+    CEGUI::XMLBinaryCache& cache = CEGUI::System::getSingleton().getXMLBinaryCache();
+    cache.addPreparedBlob("Prepared.imageset", "imagesets", recorder.getBlob());
+
+    // replaying skips validation, so nothing is replayed while disabled
+    EventCollector replayed;
+    BOOST_CHECK(!cache.replay(replayed, "Prepared.imageset", "imagesets", source, sourceSize));
+    BOOST_CHECK(replayed.d_events.empty());
+
+    cache.setCacheDirectory(".");
+    BOOST_CHECK(cache.replay(replayed, "Prepared.imageset", "imagesets", source, sourceSize));
+    BOOST_CHECK(parsed.d_events == replayed.d_events);
+
+    cache.setCacheDirectory("");
+    cache.clearPreparedBlobs();
+}
+
+BOOST_AUTO_TEST_CASE(CacheFileName)
+{
+    BOOST_CHECK_EQUAL(
+        CEGUI::XMLBinaryCache::getCacheFileName("sub/Test.imageset", "imagesets"),
+        CEGUI::String("imagesets.sub_Test.imageset.cxb"));
+    BOOST_CHECK_EQUAL(
+        CEGUI::XMLBinaryCache::getCacheFileName("Test.scheme", ""),
+        CEGUI::String("default.Test.scheme.cxb"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()